@@ -0,0 +1,339 @@
+/**
+ * ESP-PIX - Host benchmarks
+ *
+ * Times the hardware-independent parts of the firmware on the build
+ * machine: QR encoding, BR Code assembly, text and screen rendering
+ * against the fake panel, backend response parsing, image decoding and
+ * the state machine.
+ *
+ * Usage: espix_bench [-t ms] [filtro]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <time.h>
+
+#include "qrcode_gen.h"
+#include "brcode.h"
+#include "json_stream.h"
+#include "app_state.h"
+#include "image_codec.h"
+#include "display_st7735.h"
+#include "images/rapport_pix_logo.h"
+#include "fake_panel.h"
+
+// ==========================================================
+// Allocation counting
+//
+// The library objects are linked with --wrap for the allocator, so every
+// allocation made by firmware code passes through here.
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+static uint64_t s_allocs = 0;
+static uint64_t s_alloc_bytes = 0;
+
+void *__wrap_malloc(size_t size)
+{
+    s_allocs++;
+    s_alloc_bytes += size;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t n, size_t size)
+{
+    s_allocs++;
+    s_alloc_bytes += n * size;
+    return __real_calloc(n, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    s_allocs++;
+    s_alloc_bytes += size;
+    return __real_realloc(ptr, size);
+}
+
+// ==========================================================
+// Fixtures
+
+// Dynamic BR Code as returned by the backend for a R$ 0,50 charge
+static const char BRCODE[] =
+    "00020101021226850014br.gov.bcb.pix2563qrpix.bradesco.com.br/qr/v2/"
+    "cobv/9d36b84f-c70b-478f-b95c-12729b90ca255204000053039865404"
+    "0.505802BR5914CAFE EXPRESSO6009SAO PAULO62070503***6304A1B2";
+
+static const char CREATE_RESPONSE[] =
+    "{\"success\":true,\"paymentId\":\"1325789045\",\"status\":\"pending\","
+    "\"qrCode\":\"00020101021226850014br.gov.bcb.pix2563qrpix.bradesco.com.br/qr/v2/"
+    "cobv/9d36b84f-c70b-478f-b95c-12729b90ca255204000053039865404"
+    "0.505802BR5914CAFE EXPRESSO6009SAO PAULO62070503***6304A1B2\","
+    "\"qrCodeBase64\":null,\"amount\":0.5,\"description\":\"Produto teste\","
+    "\"expiresAt\":\"2026-10-17T15:04:05.000Z\",\"metadata\":{\"machine\":\"esp-pix-01\","
+    "\"slot\":3,\"tags\":[\"cafe\",\"expresso\"]}}";
+
+static const char STATUS_RESPONSE[] =
+    "{\"paymentId\":\"1325789045\",\"status\":\"PENDING\",\"statusDetail\":\"pending_waiting_transfer\","
+    "\"updatedAt\":\"2026-10-17T15:04:09.000Z\"}";
+
+// Responses are fed as they arrive from the socket
+#define RESPONSE_CHUNK 128
+
+static qrcode_t s_qrcode;
+static volatile uint32_t s_sink;
+
+// ==========================================================
+// Benchmarks
+static void bench_qrcode_brcode(void)
+{
+    qrcode_generate(&s_qrcode, BRCODE);
+    s_sink += s_qrcode.mask;
+}
+
+// Byte-mode capacity of QRCODE_MAX_VERSION at ECC level L
+#define QRCODE_MAX_BYTES 520
+
+static void bench_qrcode_max(void)
+{
+    static char text[QRCODE_MAX_BYTES + 1];
+    if (text[0] == '\0') {
+        // Lower-case letters are outside the alphanumeric set, so the whole
+        // payload goes in byte mode and fills the largest version
+        for (size_t i = 0; i < sizeof(text) - 1; i++) {
+            text[i] = 'a' + (i * 7) % 26;
+        }
+    }
+    qrcode_generate(&s_qrcode, text);
+    s_sink += s_qrcode.version;
+}
+
+static void bench_brcode_build(void)
+{
+    static char payload[256];
+    brcode_params_t params = {
+        .pix_key = "9d36b84f-c70b-478f-b95c-12729b90ca25",
+        .merchant_name = "CAFE EXPRESSO",
+        .merchant_city = "SAO PAULO",
+        .amount_cents = 50,
+        .txid = "K7Q2M9X4T1B8R5W3Z6N0P4L2J",
+    };
+    brcode_build(&params, payload, sizeof(payload));
+    s_sink += payload[sizeof("000201") - 1];
+}
+
+static void feed_chunked(json_stream_t *js, const char *doc, size_t len)
+{
+    for (size_t off = 0; off < len; off += RESPONSE_CHUNK) {
+        size_t n = len - off < RESPONSE_CHUNK ? len - off : RESPONSE_CHUNK;
+        json_stream_feed(js, doc + off, n);
+    }
+}
+
+static void bench_json_create_charge(void)
+{
+    char payment_id[64];
+    char qr_code[512];
+    double amount;
+    json_field_t fields[] = {
+        { .key = "paymentId", .type = JSON_FIELD_STRING, .dest = payment_id, .size = sizeof(payment_id) },
+        { .key = "qrCode", .type = JSON_FIELD_STRING, .dest = qr_code, .size = sizeof(qr_code) },
+        { .key = "amount", .type = JSON_FIELD_NUMBER, .dest = &amount },
+    };
+    json_stream_t js;
+
+    json_stream_init(&js, fields, 3);
+    feed_chunked(&js, CREATE_RESPONSE, sizeof(CREATE_RESPONSE) - 1);
+    s_sink += json_stream_finish(&js) + fields[1].found;
+}
+
+static void bench_json_status(void)
+{
+    char status[16];
+    json_field_t fields[] = {
+        { .key = "status", .type = JSON_FIELD_STRING, .dest = status, .size = sizeof(status) },
+    };
+    json_stream_t js;
+
+    json_stream_init(&js, fields, 1);
+    feed_chunked(&js, STATUS_RESPONSE, sizeof(STATUS_RESPONSE) - 1);
+    s_sink += json_stream_finish(&js) + status[0];
+}
+
+static void bench_text_line(void)
+{
+    display_set_cursor(4, 40);
+    display_set_text_size(1);
+    display_set_text_colors(ST7735_WHITE, ST7735_BLACK);
+    display_print("Cobran\xC3\xA7" "a de R$ 0,50 - Caf\xC3\xA9");
+    display_flush();
+}
+
+static void bench_text_label(void)
+{
+    static display_label_t label;
+    static int remaining = 0;
+    char text[32];
+
+    if (remaining == 0) {
+        display_label_init(&label, 10, 140, 12, 1, ST7735_BLACK, ST7735_YELLOW);
+        remaining = 60;
+    }
+    snprintf(text, sizeof(text), "Tempo: %ds", remaining--);
+    display_label_set(&label, text);
+    display_flush();
+}
+
+static void bench_show_message(void)
+{
+    display_show_message("Pagamento", "Confirmado!", ST7735_GREEN);
+    display_flush();
+}
+
+static void bench_show_qrcode(void)
+{
+    display_show_qrcode(&s_qrcode, 50);
+    display_flush();
+}
+
+static void bench_image_decode(void)
+{
+    static uint16_t rows[2][128];
+    image_decoder_t dec;
+
+    image_decoder_init(&dec, &RAPPORT_PIX_LOGO);
+    for (int row = 0; row < RAPPORT_PIX_LOGO.height; row++) {
+        image_decode_row(&dec, row > 0 ? rows[(row - 1) & 1] : NULL, rows[row & 1]);
+    }
+    s_sink += rows[0][0];
+}
+
+// Flash footprint against the framebuffer bytes it turns into
+static void report_image_decode(double ns_per_op)
+{
+    const image_t *img = &RAPPORT_PIX_LOGO;
+    uint32_t encoded = img->data_size + img->palette_size * sizeof(uint16_t);
+    uint32_t raw = (uint32_t)img->width * img->height * sizeof(uint16_t);
+
+    printf("    %ux%u: encoded %" PRIu32 " B, RGB565 %" PRIu32 " B, ratio %.2f, "
+           "%.0f bytes/s RGB565 written (%.0f bytes/s read)\n",
+           img->width, img->height, encoded, raw, (double)raw / encoded,
+           raw * 1e9 / ns_per_op, encoded * 1e9 / ns_per_op);
+}
+
+static void bench_app_state(void)
+{
+    // Every event in every state, as a sweep of the transition table
+    for (int state = 0; state < APP_STATE_COUNT; state++) {
+        for (int event = 0; event < APP_EVENT_COUNT; event++) {
+            app_state_t next;
+            s_sink += app_state_next(state, event, &next) + next;
+        }
+    }
+}
+
+static void setup_qrcode(void)
+{
+    qrcode_generate(&s_qrcode, BRCODE);
+}
+
+typedef struct {
+    const char *name;
+    void (*setup)(void);
+    void (*run)(void);
+    void (*report)(double ns_per_op);   // Extra line after the results, may be NULL
+} bench_t;
+
+static const bench_t s_benches[] = {
+    { .name = "qrcode_generate/brcode", .run = bench_qrcode_brcode },
+    { .name = "qrcode_generate/v15", .run = bench_qrcode_max },
+    { .name = "brcode/build", .run = bench_brcode_build },
+    { .name = "json_stream/create_charge", .run = bench_json_create_charge },
+    { .name = "json_stream/status", .run = bench_json_status },
+    { .name = "display/print_line", .run = bench_text_line },
+    { .name = "display/label_countdown", .run = bench_text_label },
+    { .name = "display/show_message", .run = bench_show_message },
+    { .name = "display/show_qrcode", .setup = setup_qrcode, .run = bench_show_qrcode },
+    { .name = "image_decode/logo", .run = bench_image_decode,
+      .report = report_image_decode },
+    { .name = "app_state/sweep", .run = bench_app_state },
+};
+
+// ==========================================================
+// Runner
+static int64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static int64_t run_n(const bench_t *b, uint64_t n)
+{
+    int64_t start = now_ns();
+    for (uint64_t i = 0; i < n; i++) {
+        b->run();
+    }
+    return now_ns() - start;
+}
+
+static void run_bench(const bench_t *b, int64_t budget_ns)
+{
+    if (b->setup != NULL) {
+        b->setup();
+    }
+
+    // Grow the iteration count until a run takes a tenth of the budget,
+    // then size the measured run from that rate
+    uint64_t n = 1;
+    int64_t elapsed = run_n(b, n);
+    while (elapsed < budget_ns / 10 && n < (1ULL << 40)) {
+        n *= 4;
+        elapsed = run_n(b, n);
+    }
+    n = (uint64_t)((double)n * budget_ns / (elapsed > 0 ? elapsed : 1));
+    if (n == 0) n = 1;
+
+    s_allocs = 0;
+    s_alloc_bytes = 0;
+    elapsed = run_n(b, n);
+
+    printf("%-28s %12" PRIu64 " %12.1f %11.2f %11.1f\n", b->name, n,
+           (double)elapsed / n, (double)s_allocs / n, (double)s_alloc_bytes / n);
+    if (b->report != NULL) {
+        b->report((double)elapsed / n);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int64_t budget_ms = 500;
+    const char *filter = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            budget_ms = atoll(argv[++i]);
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "Uso: %s [-t ms] [filtro]\n", argv[0]);
+            return 2;
+        } else {
+            filter = argv[i];
+        }
+    }
+
+    if (display_init() != ESP_OK) {
+        fprintf(stderr, "Falha ao iniciar o display\n");
+        return 1;
+    }
+
+    printf("%-28s %12s %12s %11s %11s\n", "benchmark", "iterations", "ns/op", "allocs/op", "bytes/op");
+    for (size_t i = 0; i < sizeof(s_benches) / sizeof(s_benches[0]); i++) {
+        if (filter == NULL || strstr(s_benches[i].name, filter) != NULL) {
+            run_bench(&s_benches[i], budget_ms * 1000000);
+        }
+    }
+    return 0;
+}
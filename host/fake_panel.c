@@ -0,0 +1,153 @@
+// Memory-backed ST7735 for host builds: implements lcd_bus.h by decoding
+// the column/row address and memory write commands into a pixel array.
+#include <string.h>
+
+#include "lcd_bus.h"
+#include "fake_panel.h"
+
+#define CMD_CASET 0x2A
+#define CMD_RASET 0x2B
+#define CMD_RAMWR 0x2C
+
+static uint16_t s_pixels[FAKE_PANEL_HEIGHT][FAKE_PANEL_WIDTH];
+static uint16_t s_line_buf[2][LCD_BUS_LINE_BUF_PIXELS];
+static int s_line_idx = 0;
+
+static uint8_t s_cmd = 0;
+static uint8_t s_params[4];
+static int s_param_count = 0;
+static int s_x0, s_x1, s_y0, s_y1;    // Address window, inclusive
+static int s_x, s_y;                  // Next pixel written
+static int s_pending = -1;            // First byte of a pixel split across writes
+
+static uint32_t s_seq = 0;
+static uint64_t s_bytes_sent = 0;
+
+static void put_pixel(uint16_t color)
+{
+    if (s_y > s_y1) return;
+    if (s_x < FAKE_PANEL_WIDTH && s_y < FAKE_PANEL_HEIGHT) {
+        s_pixels[s_y][s_x] = color;
+    }
+    if (++s_x > s_x1) {
+        s_x = s_x0;
+        s_y++;
+    }
+}
+
+static void write_byte(uint8_t b)
+{
+    switch (s_cmd) {
+    case CMD_CASET:
+    case CMD_RASET:
+        if (s_param_count < 4) {
+            s_params[s_param_count++] = b;
+        }
+        if (s_param_count == 4) {
+            int lo = (s_params[0] << 8) | s_params[1];
+            int hi = (s_params[2] << 8) | s_params[3];
+            if (s_cmd == CMD_CASET) {
+                s_x0 = lo;
+                s_x1 = hi;
+            } else {
+                s_y0 = lo;
+                s_y1 = hi;
+            }
+        }
+        break;
+    case CMD_RAMWR:
+        if (s_pending < 0) {
+            s_pending = b;
+        } else {
+            put_pixel((uint16_t)((s_pending << 8) | b));
+            s_pending = -1;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+esp_err_t lcd_bus_init(size_t max_transfer)
+{
+    (void)max_transfer;
+    memset(s_pixels, 0, sizeof(s_pixels));
+    s_cmd = 0;
+    return ESP_OK;
+}
+
+void lcd_bus_write_cmd(uint8_t cmd)
+{
+    s_cmd = cmd;
+    s_param_count = 0;
+    s_pending = -1;
+    if (cmd == CMD_RAMWR) {
+        s_x = s_x0;
+        s_y = s_y0;
+    }
+    s_seq++;
+    s_bytes_sent++;
+}
+
+uint32_t lcd_bus_write_data(const void *data, size_t len)
+{
+    if (len == 0) return s_seq;
+
+    const uint8_t *p = data;
+    for (size_t i = 0; i < len; i++) {
+        write_byte(p[i]);
+    }
+    s_bytes_sent += len;
+    return ++s_seq;
+}
+
+void lcd_bus_wait(uint32_t seq)
+{
+    (void)seq;
+}
+
+void lcd_bus_wait_idle(void)
+{
+}
+
+uint16_t *lcd_bus_next_line_buf(void)
+{
+    s_line_idx ^= 1;
+    return s_line_buf[s_line_idx];
+}
+
+void lcd_bus_send_line_buf(const uint16_t *buf, size_t pixels)
+{
+    lcd_bus_write_data(buf, pixels * 2);
+}
+
+void lcd_bus_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+void lcd_bus_reset_stats(void)
+{
+    s_bytes_sent = 0;
+}
+
+void lcd_bus_get_stats(uint64_t *bytes_sent, int64_t *wait_us)
+{
+    *bytes_sent = s_bytes_sent;
+    *wait_us = 0;
+}
+
+const uint16_t *fake_panel_pixels(void)
+{
+    return &s_pixels[0][0];
+}
+
+uint32_t fake_panel_hash(void)
+{
+    const uint8_t *p = (const uint8_t *)s_pixels;
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < sizeof(s_pixels); i++) {
+        h = (h ^ p[i]) * 16777619u;
+    }
+    return h;
+}
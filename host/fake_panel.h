@@ -0,0 +1,21 @@
+#ifndef FAKE_PANEL_H
+#define FAKE_PANEL_H
+
+#include <stdint.h>
+
+#define FAKE_PANEL_WIDTH  128
+#define FAKE_PANEL_HEIGHT 160
+
+/**
+ * @brief Panel contents, row-major RGB565 in host byte order
+ *
+ * Updated synchronously as display_st7735.c writes to the bus.
+ */
+const uint16_t *fake_panel_pixels(void);
+
+/**
+ * @brief FNV-1a hash of the panel contents, to compare rendered screens
+ */
+uint32_t fake_panel_hash(void);
+
+#endif // FAKE_PANEL_H
@@ -0,0 +1,320 @@
+/**
+ * ESP-PIX - FreeRTOS on POSIX threads
+ *
+ * Just enough of the FreeRTOS API for the firmware's task-based modules
+ * (network worker, payment watcher, charge pool, reconciler) to run on the
+ * host. Scheduling is left to the operating system: priorities and stack
+ * sizes are ignored. Timed waits use the monotonic clock, one tick per
+ * millisecond.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
+
+struct host_task {
+    TaskFunction_t fn;
+    void *arg;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t notify;            // Task notification value
+};
+
+struct host_queue {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;        // Signalled on every send and receive
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t head;           // Oldest item
+    UBaseType_t count;
+    uint8_t *items;
+};
+
+static __thread TaskHandle_t t_current = NULL;
+
+static void init_cond(pthread_cond_t *cond)
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+// Absolute CLOCK_MONOTONIC time ticks from now
+static struct timespec deadline_after(TickType_t ticks)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    ts.tv_sec += ticks / 1000;
+    ts.tv_nsec += (long)(ticks % 1000) * 1000000;
+    if (ts.tv_nsec >= 1000000000) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000;
+    }
+    return ts;
+}
+
+/**
+ * @brief Wait on cond until woken or the deadline passes
+ * @return false once the deadline has passed
+ */
+static bool wait_until(pthread_cond_t *cond, pthread_mutex_t *lock, TickType_t ticks,
+                       const struct timespec *deadline)
+{
+    if (ticks == portMAX_DELAY) {
+        pthread_cond_wait(cond, lock);
+        return true;
+    }
+    return pthread_cond_timedwait(cond, lock, deadline) != ETIMEDOUT;
+}
+
+// ==========================================================
+// Tasks
+
+static TaskHandle_t new_task(TaskFunction_t fn, void *arg)
+{
+    TaskHandle_t task = calloc(1, sizeof(*task));
+    if (task == NULL) {
+        return NULL;
+    }
+    task->fn = fn;
+    task->arg = arg;
+    pthread_mutex_init(&task->lock, NULL);
+    init_cond(&task->cond);
+    return task;
+}
+
+static void *task_main(void *arg)
+{
+    TaskHandle_t task = arg;
+    t_current = task;
+    task->fn(task->arg);
+    return NULL;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack_depth,
+                       void *arg, UBaseType_t priority, TaskHandle_t *handle)
+{
+    TaskHandle_t task = new_task(fn, arg);
+    if (task == NULL) {
+        return pdFAIL;
+    }
+
+    // Published before the thread starts, as the caller may notify it at once
+    if (handle != NULL) {
+        *handle = task;
+    }
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, task_main, task) != 0) {
+        return pdFAIL;
+    }
+    pthread_detach(thread);
+    return pdPASS;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    // Threads not started by xTaskCreate(), such as main(), get one on demand
+    if (t_current == NULL) {
+        t_current = new_task(NULL, NULL);
+    }
+    return t_current;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (TickType_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    struct timespec ts = { .tv_sec = ticks / 1000, .tv_nsec = (long)(ticks % 1000) * 1000000 };
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks)
+{
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    struct timespec deadline = deadline_after(ticks);
+
+    pthread_mutex_lock(&task->lock);
+    while (task->notify == 0 && wait_until(&task->cond, &task->lock, ticks, &deadline)) {
+    }
+    uint32_t value = task->notify;
+    if (value > 0) {
+        task->notify = clear_on_exit ? 0 : value - 1;
+    }
+    pthread_mutex_unlock(&task->lock);
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    pthread_mutex_lock(&task->lock);
+    task->notify++;
+    pthread_cond_signal(&task->cond);
+    pthread_mutex_unlock(&task->lock);
+    return pdPASS;
+}
+
+// ==========================================================
+// Semaphores
+
+static SemaphoreHandle_t init_semaphore(StaticSemaphore_t *sem, UBaseType_t max,
+                                        UBaseType_t initial, bool is_static)
+{
+    pthread_mutex_init(&sem->lock, NULL);
+    init_cond(&sem->cond);
+    sem->count = initial;
+    sem->max = max;
+    sem->is_static = is_static;
+    return sem;
+}
+
+static SemaphoreHandle_t new_semaphore(UBaseType_t max, UBaseType_t initial)
+{
+    StaticSemaphore_t *sem = malloc(sizeof(*sem));
+    return sem != NULL ? init_semaphore(sem, max, initial, false) : NULL;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    // Without priority inheritance, which the host scheduler would ignore
+    return new_semaphore(1, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return new_semaphore(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *storage)
+{
+    return init_semaphore(storage, 1, 0, true);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial)
+{
+    return new_semaphore(max, initial);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    pthread_cond_destroy(&sem->cond);
+    pthread_mutex_destroy(&sem->lock);
+    if (!sem->is_static) {
+        free(sem);
+    }
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+    struct timespec deadline = deadline_after(ticks);
+
+    pthread_mutex_lock(&sem->lock);
+    while (sem->count == 0 && wait_until(&sem->cond, &sem->lock, ticks, &deadline)) {
+    }
+    bool taken = sem->count > 0;
+    if (taken) {
+        sem->count--;
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return taken ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    pthread_mutex_lock(&sem->lock);
+    bool given = sem->count < sem->max;
+    if (given) {
+        sem->count++;
+        pthread_cond_signal(&sem->cond);
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return given ? pdTRUE : pdFALSE;
+}
+
+// ==========================================================
+// Queues
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    QueueHandle_t queue = calloc(1, sizeof(*queue));
+    if (queue == NULL) {
+        return NULL;
+    }
+    queue->items = calloc(length, item_size);
+    if (queue->items == NULL) {
+        free(queue);
+        return NULL;
+    }
+    queue->length = length;
+    queue->item_size = item_size;
+    pthread_mutex_init(&queue->lock, NULL);
+    init_cond(&queue->cond);
+    return queue;
+}
+
+static BaseType_t queue_send(QueueHandle_t queue, const void *item, TickType_t ticks, bool front)
+{
+    struct timespec deadline = deadline_after(ticks);
+
+    pthread_mutex_lock(&queue->lock);
+    while (queue->count == queue->length &&
+           wait_until(&queue->cond, &queue->lock, ticks, &deadline)) {
+    }
+    bool sent = queue->count < queue->length;
+    if (sent) {
+        UBaseType_t slot;
+        if (front) {
+            queue->head = (queue->head + queue->length - 1) % queue->length;
+            slot = queue->head;
+        } else {
+            slot = (queue->head + queue->count) % queue->length;
+        }
+        memcpy(queue->items + slot * queue->item_size, item, queue->item_size);
+        queue->count++;
+        pthread_cond_broadcast(&queue->cond);
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return sent ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+    return queue_send(queue, item, ticks, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+    return queue_send(queue, item, ticks, true);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+    struct timespec deadline = deadline_after(ticks);
+
+    pthread_mutex_lock(&queue->lock);
+    while (queue->count == 0 && wait_until(&queue->cond, &queue->lock, ticks, &deadline)) {
+    }
+    bool received = queue->count > 0;
+    if (received) {
+        memcpy(item, queue->items + queue->head * queue->item_size, queue->item_size);
+        queue->head = (queue->head + 1) % queue->length;
+        queue->count--;
+        pthread_cond_broadcast(&queue->cond);
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return received ? pdTRUE : pdFALSE;
+}
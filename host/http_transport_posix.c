@@ -0,0 +1,360 @@
+/**
+ * ESP-PIX - Backend transport on POSIX sockets
+ *
+ * Stands in for main/http_transport.c on the host, under the firmware's own
+ * http_client.c, so the modules built on it (network worker, payment
+ * watcher, charge pool, reconciler) run against tools/mock_backend.py with
+ * the same requests, replies, retry rules and metrics as on the device.
+ * Plain HTTP instead of TLS, and the base URL is set at run time.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdatomic.h>
+#include <errno.h>
+#include <unistd.h>
+#include <poll.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "http_transport_posix.h"
+
+static const char *TAG = "http_transport";
+
+// Connection to the backend could not be opened, as in esp_http_client.h
+#define ESP_ERR_HTTP_CONNECT    0x7002
+
+#define HEADER_MAX      2048
+
+// Socket of each connection, -1 while closed
+static int s_fds[HTTP_CONN_COUNT] = { -1, -1 };
+
+static char s_host[128] = "127.0.0.1";
+static char s_port[8] = "3000";
+static char s_prefix[128] = "/api";
+static atomic_uint_least32_t s_status_requests;
+
+static int64_t now_ms(void)
+{
+    return esp_timer_get_time() / 1000;
+}
+
+esp_err_t http_transport_set_url(const char *url)
+{
+    if (strncmp(url, "http://", 7) != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const char *host = url + 7;
+    const char *path = strchr(host, '/');
+    if (path == NULL) {
+        path = host + strlen(host);
+    }
+    const char *colon = memchr(host, ':', path - host);
+    const char *host_end = colon != NULL ? colon : path;
+    size_t host_len = host_end - host;
+    size_t port_len = colon != NULL ? (size_t)(path - colon - 1) : 2;
+
+    if (host_len == 0 || host_len >= sizeof(s_host) || port_len == 0 ||
+        port_len >= sizeof(s_port) || strlen(path) >= sizeof(s_prefix)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memcpy(s_host, host, host_len);
+    s_host[host_len] = '\0';
+    if (colon != NULL) {
+        memcpy(s_port, colon + 1, port_len);
+        s_port[port_len] = '\0';
+    } else {
+        strcpy(s_port, "80");
+    }
+    strcpy(s_prefix, path);
+    // Paths are appended with their leading slash
+    size_t prefix_len = strlen(s_prefix);
+    if (prefix_len > 0 && s_prefix[prefix_len - 1] == '/') {
+        s_prefix[prefix_len - 1] = '\0';
+    }
+    return ESP_OK;
+}
+
+static void fd_close(int *fd)
+{
+    if (*fd >= 0) {
+        close(*fd);
+        *fd = -1;
+    }
+}
+
+static esp_err_t fd_open(int *fd)
+{
+    struct addrinfo hints = { .ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM };
+    struct addrinfo *res;
+
+    if (getaddrinfo(s_host, s_port, &hints, &res) != 0) {
+        return ESP_ERR_HTTP_CONNECT;
+    }
+
+    for (struct addrinfo *ai = res; ai != NULL && *fd < 0; ai = ai->ai_next) {
+        int s = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (s < 0) {
+            continue;
+        }
+        if (connect(s, ai->ai_addr, ai->ai_addrlen) != 0) {
+            close(s);
+            continue;
+        }
+        int one = 1;
+        setsockopt(s, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        *fd = s;
+    }
+    freeaddrinfo(res);
+
+    return *fd >= 0 ? ESP_OK : ESP_ERR_HTTP_CONNECT;
+}
+
+static esp_err_t send_all(int fd, const char *data, size_t len)
+{
+    while (len > 0) {
+        ssize_t n = send(fd, data, len, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return ESP_FAIL;
+        }
+        data += n;
+        len -= n;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Read what arrives before the deadline
+ *
+ * On an abortable request the wait is cut into HTTP_ABORT_SLICE_MS polls,
+ * checking the abort flag between them.
+ *
+ * @param out_len Bytes read, 0 once the server closed the connection
+ */
+static esp_err_t recv_some(int fd, const atomic_bool *abort, char *buf, size_t size,
+                           int64_t deadline, size_t *out_len)
+{
+    while (1) {
+        if (abort != NULL && atomic_load(abort)) {
+            return ESP_ERR_INVALID_STATE;
+        }
+        int64_t left = deadline - now_ms();
+        if (left <= 0) {
+            return ESP_ERR_TIMEOUT;
+        }
+        if (abort != NULL && left > HTTP_ABORT_SLICE_MS) {
+            left = HTTP_ABORT_SLICE_MS;
+        }
+
+        struct pollfd pfd = { .fd = fd, .events = POLLIN };
+        int ready = poll(&pfd, 1, (int)left);
+        if (ready < 0 && errno != EINTR) {
+            return ESP_FAIL;
+        }
+        if (ready <= 0) {
+            continue;
+        }
+
+        ssize_t n = recv(fd, buf, size, 0);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0) {
+            return ESP_FAIL;
+        }
+        *out_len = n;
+        return ESP_OK;
+    }
+}
+
+// Value of a response header, NULL if absent. head is NUL-terminated.
+static const char *find_header(const char *head, const char *name)
+{
+    size_t len = strlen(name);
+
+    for (const char *line = strstr(head, "\r\n"); line != NULL; line = strstr(line, "\r\n")) {
+        line += 2;
+        if (strncasecmp(line, name, len) == 0 && line[len] == ':') {
+            const char *value = line + len + 1;
+            while (*value == ' ') {
+                value++;
+            }
+            return value;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Read the response, feeding the body to req->json
+ *
+ * Closes the connection when the server asks to or sent no length.
+ */
+static esp_err_t read_response(int *fd, const http_request_t *req, http_response_t *resp,
+                               int64_t deadline)
+{
+    char head[HEADER_MAX];
+    size_t head_len = 0;
+    char *body = NULL;
+
+    while (body == NULL) {
+        size_t n = 0;
+        esp_err_t err = recv_some(*fd, req->abort, head + head_len,
+                                  sizeof(head) - 1 - head_len, deadline, &n);
+        if (err != ESP_OK) {
+            return err;
+        }
+        if (n == 0) {
+            return ESP_FAIL;
+        }
+        resp->responded = true;
+        head_len += n;
+        head[head_len] = '\0';
+
+        body = strstr(head, "\r\n\r\n");
+        if (body == NULL && head_len == sizeof(head) - 1) {
+            ESP_LOGE(TAG, "Response headers too long");
+            return ESP_FAIL;
+        }
+    }
+    *body = '\0';
+    body += 4;
+
+    if (sscanf(head, "HTTP/%*d.%*d %d", &resp->status_code) != 1) {
+        return ESP_FAIL;
+    }
+
+    const char *value = find_header(head, "Content-Length");
+    long remaining = value != NULL ? strtol(value, NULL, 10) : -1;
+    value = find_header(head, "Connection");
+    bool keep_alive = remaining >= 0 && (value == NULL || strncasecmp(value, "close", 5) != 0);
+
+    size_t have = head + head_len - body;
+    if (remaining >= 0 && (long)have > remaining) {
+        have = remaining;
+    }
+    json_stream_feed(req->json, body, have);
+    if (remaining >= 0) {
+        remaining -= have;
+    }
+
+    // The headers are in: the body gets the full wait, as on the device
+    while (remaining != 0) {
+        size_t n = 0;
+        esp_err_t err = recv_some(*fd, NULL, head, remaining > 0 && remaining < (long)sizeof(head) ?
+                                  (size_t)remaining : sizeof(head), deadline, &n);
+        if (err != ESP_OK) {
+            return err;
+        }
+        if (n == 0) {
+            // Only a body without a length ends this way
+            if (remaining > 0) {
+                return ESP_FAIL;
+            }
+            break;
+        }
+        json_stream_feed(req->json, head, n);
+        if (remaining > 0) {
+            remaining -= n;
+        }
+    }
+
+    if (!keep_alive) {
+        fd_close(fd);
+    }
+    return ESP_OK;
+}
+
+static esp_err_t perform_on(int *fd, const http_request_t *req, http_response_t *resp)
+{
+    esp_err_t err = ESP_OK;
+
+    memset(resp, 0, sizeof(*resp));
+    if (*fd < 0) {
+        err = fd_open(fd);
+        if (err != ESP_OK) {
+            return err;
+        }
+        resp->connected = true;
+    }
+
+    char request[HEADER_MAX];
+    size_t body_len = req->body != NULL ? strlen(req->body) : 0;
+    int len = snprintf(request, sizeof(request),
+                       "%s %s%s HTTP/1.1\r\n"
+                       "Host: %s:%s\r\n"
+                       "%s"
+                       "Content-Length: %zu\r\n"
+                       "\r\n",
+                       req->method, s_prefix, req->path, s_host, s_port,
+                       req->body != NULL ? "Content-Type: application/json\r\n" : "", body_len);
+    if (len < 0 || (size_t)len >= sizeof(request)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    if (strncmp(req->path, "/status", 7) == 0) {
+        atomic_fetch_add(&s_status_requests, 1);
+    }
+    err = send_all(*fd, request, len);
+    if (err == ESP_OK && body_len > 0) {
+        err = send_all(*fd, req->body, body_len);
+    }
+    if (err == ESP_OK) {
+        err = read_response(fd, req, resp, now_ms() + req->timeout_ms);
+    }
+    return err;
+}
+
+esp_err_t http_transport_init(void)
+{
+    return ESP_OK;
+}
+
+esp_err_t http_transport_perform(http_conn_t conn, const http_request_t *req,
+                                 http_response_t *resp)
+{
+    return perform_on(&s_fds[conn], req, resp);
+}
+
+void http_transport_disconnect(http_conn_t conn)
+{
+    fd_close(&s_fds[conn]);
+}
+
+void http_transport_close(http_conn_t conn)
+{
+    fd_close(&s_fds[conn]);
+}
+
+esp_err_t http_transport_post(const char *path)
+{
+    int fd = -1;
+    json_stream_t json;
+    json_stream_init(&json, NULL, 0);
+    http_request_t req = { .method = "POST", .path = path, .timeout_ms = HTTP_TIMEOUT_MS,
+                           .json = &json };
+    http_response_t resp;
+
+    esp_err_t err = perform_on(&fd, &req, &resp);
+    fd_close(&fd);
+    if (err == ESP_OK && resp.status_code != 200) {
+        err = ESP_FAIL;
+    }
+    return err;
+}
+
+uint32_t http_transport_status_requests(void)
+{
+    return atomic_load(&s_status_requests);
+}
@@ -0,0 +1,33 @@
+#ifndef HTTP_TRANSPORT_POSIX_H
+#define HTTP_TRANSPORT_POSIX_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "http_transport.h"
+
+/**
+ * @brief Set the backend the http_client.h calls talk to
+ *
+ * Takes the place of CONFIG_ESP_PIX_BACKEND_URL. Plain HTTP only.
+ *
+ * @param url Base URL, e.g. http://127.0.0.1:3000/api
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if the URL is not http://host[:port][/path]
+ */
+esp_err_t http_transport_set_url(const char *url);
+
+/**
+ * @brief POST an empty body to a backend path on a connection of its own
+ *
+ * For the customer's side of a sale, e.g. /approve/<id> on the mock.
+ *
+ * @param path Path below the base URL
+ * @return ESP_OK on HTTP 200
+ */
+esp_err_t http_transport_post(const char *path);
+
+/**
+ * @brief Status requests sent so far, long-polls, batches and resends included
+ */
+uint32_t http_transport_status_requests(void);
+
+#endif // HTTP_TRANSPORT_POSIX_H
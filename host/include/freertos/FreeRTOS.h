@@ -0,0 +1,48 @@
+// Host build: the FreeRTOS types and macros used by the firmware modules.
+// Tasks, semaphores and queues run on POSIX threads (freertos_posix.c),
+// with one tick per millisecond. Includes sdkconfig.h like the real one.
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "sdkconfig.h"
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdTRUE                  1
+#define pdFALSE                 0
+#define pdPASS                  pdTRUE
+#define pdFAIL                  pdFALSE
+
+#define configTICK_RATE_HZ      1000
+#define portTICK_PERIOD_MS      1
+#define portMAX_DELAY           ((TickType_t)0xFFFFFFFFu)
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(ms))
+
+#define portNUM_PROCESSORS      1
+#define xPortGetCoreID()        0
+
+// Critical sections are plain mutexes: the host has no interrupts
+typedef pthread_mutex_t portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED    PTHREAD_MUTEX_INITIALIZER
+#define portENTER_CRITICAL(mux)         pthread_mutex_lock(mux)
+#define portEXIT_CRITICAL(mux)          pthread_mutex_unlock(mux)
+#define portENTER_CRITICAL_SAFE(mux)    pthread_mutex_lock(mux)
+#define portEXIT_CRITICAL_SAFE(mux)     pthread_mutex_unlock(mux)
+
+/**
+ * @brief Storage of a semaphore, also used for the static variants
+ */
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    UBaseType_t count;
+    UBaseType_t max;
+    bool is_static;
+} StaticSemaphore_t;
+
+#endif // FREERTOS_H
@@ -0,0 +1,34 @@
+// Host build configuration, mirrors the ESP-PIX options of ../sdkconfig.
+// The sale flow options can be overridden with -D to try other settings.
+#ifndef SDKCONFIG_H
+#define SDKCONFIG_H
+
+#define CONFIG_ESP_PIX_DISPLAY_FRAMEBUFFER 1
+#define CONFIG_ESP_PIX_DISPLAY_BENCHMARK 0
+
+#ifndef CONFIG_ESP_PIX_PAYMENT_TIMEOUT_MS
+#define CONFIG_ESP_PIX_PAYMENT_TIMEOUT_MS 60000
+#endif
+#ifndef CONFIG_ESP_PIX_CHARGE_PREFETCH
+#define CONFIG_ESP_PIX_CHARGE_PREFETCH 1
+#endif
+#ifndef CONFIG_ESP_PIX_CHARGE_POOL_SIZE
+#define CONFIG_ESP_PIX_CHARGE_POOL_SIZE 1
+#endif
+#ifndef CONFIG_ESP_PIX_CHARGE_MAX_AGE_S
+#define CONFIG_ESP_PIX_CHARGE_MAX_AGE_S 600
+#endif
+#define CONFIG_ESP_PIX_CHARGE_SOURCE_BACKEND 1
+#ifndef CONFIG_ESP_PIX_PAYMENT_LONGPOLL_S
+#define CONFIG_ESP_PIX_PAYMENT_LONGPOLL_S 15
+#endif
+#ifndef CONFIG_ESP_PIX_PAYMENT_POLL_MIN_MS
+#define CONFIG_ESP_PIX_PAYMENT_POLL_MIN_MS 1000
+#endif
+#ifndef CONFIG_ESP_PIX_PAYMENT_POLL_MAX_MS
+#define CONFIG_ESP_PIX_PAYMENT_POLL_MAX_MS 8000
+#endif
+#define CONFIG_ESP_PIX_TRACE 1
+#define CONFIG_ESP_PIX_TRACE_EVENTS 256
+
+#endif // SDKCONFIG_H
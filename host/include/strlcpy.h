@@ -0,0 +1,10 @@
+// Host build: strlcpy() for C libraries without it (glibc before 2.38).
+// Forced into the firmware sources that use it.
+#ifndef STRLCPY_H
+#define STRLCPY_H
+
+#include <stddef.h>
+
+size_t strlcpy(char *dst, const char *src, size_t size);
+
+#endif // STRLCPY_H
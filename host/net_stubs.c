@@ -0,0 +1,118 @@
+/**
+ * ESP-PIX - WiFi and NVS stand-ins for the host build of the network modules
+ *
+ * The host is always connected. NVS keeps a few blobs in memory, enough
+ * for the reconciler's table; nothing survives the process.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "nvs.h"
+#include "wifi_manager.h"
+
+#define NVS_MAX_BLOBS   8
+#define NVS_KEY_MAX     32
+
+typedef struct {
+    char name[NVS_KEY_MAX];     // Namespace
+    char key[NVS_KEY_MAX];
+    void *data;                 // NULL for a free slot
+    size_t len;
+} nvs_blob_t;
+
+static pthread_mutex_t s_nvs_lock = PTHREAD_MUTEX_INITIALIZER;
+static nvs_blob_t s_blobs[NVS_MAX_BLOBS];
+static char s_names[NVS_MAX_BLOBS][NVS_KEY_MAX];   // Namespace of each open handle
+
+bool wifi_manager_is_connected(void)
+{
+    return true;
+}
+
+static nvs_blob_t *find_blob(nvs_handle_t handle, const char *key, bool create)
+{
+    nvs_blob_t *free_slot = NULL;
+
+    for (int i = 0; i < NVS_MAX_BLOBS; i++) {
+        nvs_blob_t *b = &s_blobs[i];
+        if (b->data == NULL) {
+            if (free_slot == NULL) {
+                free_slot = b;
+            }
+        } else if (strcmp(b->name, s_names[handle]) == 0 && strcmp(b->key, key) == 0) {
+            return b;
+        }
+    }
+    if (!create || free_slot == NULL) {
+        return NULL;
+    }
+    strncpy(free_slot->name, s_names[handle], NVS_KEY_MAX - 1);
+    strncpy(free_slot->key, key, NVS_KEY_MAX - 1);
+    return free_slot;
+}
+
+esp_err_t nvs_open(const char *name, nvs_open_mode_t mode, nvs_handle_t *out_handle)
+{
+    esp_err_t err = ESP_ERR_NO_MEM;
+
+    pthread_mutex_lock(&s_nvs_lock);
+    for (nvs_handle_t h = 0; h < NVS_MAX_BLOBS; h++) {
+        if (s_names[h][0] == '\0') {
+            strncpy(s_names[h], name, NVS_KEY_MAX - 1);
+            *out_handle = h;
+            err = ESP_OK;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&s_nvs_lock);
+    return err;
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out_value, size_t *length)
+{
+    esp_err_t err = ESP_ERR_NVS_NOT_FOUND;
+
+    pthread_mutex_lock(&s_nvs_lock);
+    nvs_blob_t *b = find_blob(handle, key, false);
+    if (b != NULL) {
+        if (out_value != NULL) {
+            memcpy(out_value, b->data, b->len < *length ? b->len : *length);
+        }
+        *length = b->len;
+        err = ESP_OK;
+    }
+    pthread_mutex_unlock(&s_nvs_lock);
+    return err;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length)
+{
+    esp_err_t err = ESP_ERR_NO_MEM;
+
+    pthread_mutex_lock(&s_nvs_lock);
+    nvs_blob_t *b = find_blob(handle, key, true);
+    void *data = b != NULL ? malloc(length > 0 ? length : 1) : NULL;
+    if (data != NULL) {
+        memcpy(data, value, length);
+        free(b->data);
+        b->data = data;
+        b->len = length;
+        err = ESP_OK;
+    }
+    pthread_mutex_unlock(&s_nvs_lock);
+    return err;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle)
+{
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle)
+{
+    pthread_mutex_lock(&s_nvs_lock);
+    s_names[handle][0] = '\0';
+    pthread_mutex_unlock(&s_nvs_lock);
+}
@@ -0,0 +1,398 @@
+/**
+ * ESP-PIX - Sale simulator
+ *
+ * Runs the firmware's sale flow on the host: the application dispatch
+ * (app_sale.c, app_state.c), the backend client and the charge pool,
+ * network worker, payment watcher and reconciler modules as built for the
+ * device, over a POSIX socket transport in place of esp_http_client. Only
+ * the device side of the actions is replaced: the display, buzzer, LED and
+ * servo are left out and the servo finishes at once.
+ *
+ * Meant for tools/mock_backend.py started with --approve-after -1: the
+ * simulator plays the customer, acting on each QR code some time after it
+ * is shown, and prints one JSON line per sale on stdout, then one line
+ * with the counters of the run. tools/sale_latency.py starts the mock and
+ * the simulators and summarizes their output.
+ *
+ * Usage: espix_sale_sim [-n vendas] [-p ms] [-r N] [-c N] [-g ms] [url]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "http_client.h"
+#include "http_transport_posix.h"
+#include "net_worker.h"
+#include "payment_watch.h"
+#include "charge_pool.h"
+#include "reconciler.h"
+#include "app_sale.h"
+#include "json_writer.h"
+#include "metrics.h"
+
+static const char *TAG = "sale_sim";
+
+#define APP_QUEUE_LEN       16
+
+// Longest wait for the reconciler to settle the abandoned charges at the end
+#define SETTLE_MS           20000
+
+typedef enum {
+    CUSTOMER_PAY,
+    CUSTOMER_REJECT,            // The bank refuses the payment
+    CUSTOMER_CANCEL,            // Long press on the button
+} customer_t;
+
+/**
+ * @brief The sale in progress, times from esp_timer_get_time()
+ */
+typedef struct {
+    int number;                 // 1-based
+    customer_t customer;
+    bool pooled;                // The charge came from the pool
+    int64_t start_us;           // Button pressed
+    int64_t shown_us;           // QR code shown, 0 before
+    int64_t acted_us;           // Customer paid or refused, 0 before
+    int64_t detected_us;        // Approval dispatched, 0 before
+    int64_t pay_at_us;          // When the customer acts, 0 once done
+    int64_t timeout_at_us;      // End of the payment window, 0 when closed
+    uint32_t requests;          // http_transport_status_requests() at the start
+    const char *result;         // NULL while the sale runs
+} sale_t;
+
+typedef struct {
+    int sales;
+    int pay_after_ms;
+    int reject_every;
+    int cancel_every;
+    int gap_ms;
+    const char *url;
+} options_t;
+
+static options_t g_opts = {
+    .sales = 10,
+    .pay_after_ms = 1000,
+    .gap_ms = 1000,
+    .url = "http://127.0.0.1:3000/api",
+};
+
+static QueueHandle_t g_events = NULL;
+static sale_t g_sale;
+
+static int64_t now_us(void)
+{
+    return esp_timer_get_time();
+}
+
+// ==========================================================
+// Callbacks, as in app_main.c
+
+static void charge_result_cb(esp_err_t err, const char *payment_id)
+{
+    app_event_t evt;
+    app_sale_charge_event(err, payment_id, &evt);
+    xQueueSend(g_events, &evt, portMAX_DELAY);
+}
+
+static void payment_status_cb(const char *payment_id, payment_status_t status)
+{
+    app_event_t evt;
+
+    if (!app_sale_payment_event(payment_id, status, &evt)) {
+        return;
+    }
+    xQueueSend(g_events, &evt, status == PAYMENT_STATUS_PENDING ? pdMS_TO_TICKS(100)
+                                                                : portMAX_DELAY);
+}
+
+// ==========================================================
+// Actions: the simulator's side of each, app_sale.c does the rest
+
+static void end_sale(const char *result)
+{
+    if (g_sale.result == NULL) {
+        g_sale.result = result;
+    }
+}
+
+static void end_payment_window(void)
+{
+    g_sale.timeout_at_us = 0;
+    g_sale.pay_at_us = 0;
+}
+
+static void run_action(app_action_t action, const app_event_t *evt)
+{
+    switch (action) {
+        case APP_ACTION_START_CHARGE:
+            g_sale.requests = http_transport_status_requests();
+            g_sale.pooled = app_sale_start_charge();
+            break;
+        case APP_ACTION_SHOW_CHARGE:
+            g_sale.shown_us = now_us();
+            g_sale.timeout_at_us = g_sale.shown_us + CONFIG_ESP_PIX_PAYMENT_TIMEOUT_MS * 1000LL;
+            g_sale.pay_at_us = g_sale.shown_us + g_opts.pay_after_ms * 1000LL;
+            app_sale_watch_payment();
+            break;
+        case APP_ACTION_STORE_CHARGE:
+            app_sale_store_charge();
+            break;
+        case APP_ACTION_CHARGE_ERROR:
+            ESP_LOGE(TAG, "Falha ao criar cobranca: %s", esp_err_to_name(evt->err));
+            end_sale("error");
+            break;
+        case APP_ACTION_CANCEL:
+            end_payment_window();
+            app_sale_end_payment(true);
+            end_sale("cancelled");
+            break;
+        case APP_ACTION_EXPIRE:
+            end_payment_window();
+            app_sale_end_payment(true);
+            end_sale("expired");
+            break;
+        case APP_ACTION_REJECTED:
+            end_payment_window();
+            app_sale_end_payment(false);
+            end_sale("rejected");
+            break;
+        case APP_ACTION_DISPENSE: {
+            g_sale.detected_us = now_us();
+            end_payment_window();
+            app_sale_end_payment(false);
+            // No servo: the product is out at once
+            app_event_t done = { .type = APP_EVENT_DISPENSE_DONE };
+            app_sale_dispatch(&done);
+            break;
+        }
+        case APP_ACTION_DISPENSED:
+            end_sale("approved");
+            break;
+        case APP_ACTION_UPDATE_COUNTDOWN:
+        case APP_ACTION_LOG_PENDING:
+        case APP_ACTION_NEXT_SCREEN:
+        case APP_ACTION_WIFI_CHANGED:
+        case APP_ACTION_NONE:
+            break;
+    }
+}
+
+static void post(app_event_type_t type)
+{
+    app_event_t evt = { .type = type };
+    app_sale_dispatch(&evt);
+}
+
+// ==========================================================
+// Customer
+
+static void customer_act(void)
+{
+    const char *payment_id = app_sale_charge()->response.payment_id;
+    char path[96];
+
+    g_sale.acted_us = now_us();
+    switch (g_sale.customer) {
+        case CUSTOMER_CANCEL:
+            post(APP_EVENT_BUTTON_LONG);
+            return;
+        case CUSTOMER_REJECT:
+            snprintf(path, sizeof(path), "/reject/%s", payment_id);
+            break;
+        case CUSTOMER_PAY:
+            snprintf(path, sizeof(path), "/approve/%s", payment_id);
+            break;
+    }
+    if (http_transport_post(path) != ESP_OK) {
+        ESP_LOGE(TAG, "Falha em POST %s; o mock precisa de --approve-after -1", path);
+    }
+}
+
+static customer_t pick_customer(int number)
+{
+    if (g_opts.cancel_every > 0 && number % g_opts.cancel_every == 0) {
+        return CUSTOMER_CANCEL;
+    }
+    if (g_opts.reject_every > 0 && number % g_opts.reject_every == 0) {
+        return CUSTOMER_REJECT;
+    }
+    return CUSTOMER_PAY;
+}
+
+// ==========================================================
+// Output
+
+static void print_line(json_writer_t *w, char *buf)
+{
+    if (json_writer_finish(w, NULL) == NULL) {
+        ESP_LOGE(TAG, "Linha JSON longa demais");
+        return;
+    }
+    printf("%s\n", buf);
+    fflush(stdout);
+}
+
+static void print_sale(int64_t end_us)
+{
+    char buf[256];
+    json_writer_t w;
+
+    json_writer_init(&w, buf, sizeof(buf));
+    json_writer_begin_object(&w, NULL);
+    json_writer_int(&w, "sale", g_sale.number);
+    json_writer_string(&w, "result", g_sale.result);
+    json_writer_bool(&w, "pooled", g_sale.pooled);
+    if (g_sale.shown_us != 0) {
+        json_writer_int(&w, "create_us", g_sale.shown_us - g_sale.start_us);
+    }
+    if (g_sale.detected_us != 0) {
+        // From the approve request being sent, so it includes its way in
+        json_writer_int(&w, "detect_us", g_sale.detected_us - g_sale.acted_us);
+    }
+    json_writer_int(&w, "total_us", end_us - g_sale.start_us);
+    json_writer_int(&w, "requests", http_transport_status_requests() - g_sale.requests);
+    json_writer_end_object(&w);
+    print_line(&w, buf);
+}
+
+static void print_counters(int unsettled)
+{
+    char buf[256];
+    json_writer_t w;
+
+    json_writer_init(&w, buf, sizeof(buf));
+    json_writer_begin_object(&w, NULL);
+    json_writer_int(&w, "unsettled", unsettled);
+    json_writer_int(&w, "late_payments", metrics_get(METRIC_LATE_PAYMENTS));
+    json_writer_int(&w, "charges_discarded", metrics_get(METRIC_CHARGES_DISCARDED));
+    json_writer_int(&w, "charge_errors", metrics_get(METRIC_CHARGE_ERRORS));
+    json_writer_int(&w, "status_errors", metrics_get(METRIC_STATUS_ERRORS));
+    json_writer_int(&w, "cancel_errors", metrics_get(METRIC_CANCEL_ERRORS));
+    json_writer_end_object(&w);
+    print_line(&w, buf);
+}
+
+// ==========================================================
+// Main loop
+
+static int64_t min_deadline(int64_t a, int64_t b)
+{
+    if (a == 0) return b;
+    if (b == 0) return a;
+    return a < b ? a : b;
+}
+
+static void run_sales(void)
+{
+    int64_t next_sale_us = now_us() + g_opts.gap_ms * 1000LL;
+    int done = 0;
+
+    while (done < g_opts.sales) {
+        int64_t now = now_us();
+
+        if (g_sale.number == done && app_sale_state() == APP_STATE_IDLE && now >= next_sale_us) {
+            memset(&g_sale, 0, sizeof(g_sale));
+            g_sale.number = done + 1;
+            g_sale.customer = pick_customer(g_sale.number);
+            g_sale.start_us = now;
+            post(APP_EVENT_BUTTON_SHORT);
+        }
+        if (g_sale.timeout_at_us != 0 && now >= g_sale.timeout_at_us) {
+            g_sale.timeout_at_us = 0;
+            post(APP_EVENT_TIMEOUT);
+        }
+        if (g_sale.pay_at_us != 0 && now >= g_sale.pay_at_us) {
+            g_sale.pay_at_us = 0;
+            customer_act();
+        }
+
+        if (g_sale.result != NULL && app_sale_state() == APP_STATE_IDLE) {
+            now = now_us();
+            print_sale(now);
+            g_sale.result = NULL;
+            next_sale_us = now + g_opts.gap_ms * 1000LL;
+            done++;
+            continue;
+        }
+
+        // Sleep until the next event or timer
+        int64_t wake = min_deadline(g_sale.timeout_at_us, g_sale.pay_at_us);
+        if (g_sale.number == done) {
+            wake = min_deadline(wake, next_sale_us);
+        }
+        TickType_t wait = portMAX_DELAY;
+        if (wake != 0) {
+            int64_t left_ms = (wake - now_us() + 999) / 1000;
+            wait = pdMS_TO_TICKS(left_ms > 0 ? left_ms : 0);
+        }
+
+        app_event_t evt;
+        if (xQueueReceive(g_events, &evt, wait) == pdTRUE) {
+            app_sale_dispatch(&evt);
+        }
+    }
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Uso: %s [-n vendas] [-p ms] [-r N] [-c N] [-g ms] [url]\n"
+            "  -n  vendas em sequencia (padrao: 10)\n"
+            "  -p  ms entre mostrar o QR code e o cliente agir (padrao: 1000)\n"
+            "  -r  recusa toda N-esima venda\n"
+            "  -c  cancela toda N-esima venda com o botao\n"
+            "  -g  ms entre as vendas (padrao: 1000)\n"
+            "  url backend, como CONFIG_ESP_PIX_BACKEND_URL (padrao: %s)\n",
+            prog, g_opts.url);
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:p:r:c:g:h")) != -1) {
+        switch (opt) {
+            case 'n': g_opts.sales = atoi(optarg); break;
+            case 'p': g_opts.pay_after_ms = atoi(optarg); break;
+            case 'r': g_opts.reject_every = atoi(optarg); break;
+            case 'c': g_opts.cancel_every = atoi(optarg); break;
+            case 'g': g_opts.gap_ms = atoi(optarg); break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+    if (optind < argc) {
+        g_opts.url = argv[optind];
+    }
+    if (http_transport_set_url(g_opts.url) != ESP_OK) {
+        fprintf(stderr, "URL invalida: %s\n", g_opts.url);
+        return 2;
+    }
+
+    srandom(getpid());
+    g_events = xQueueCreate(APP_QUEUE_LEN, sizeof(app_event_t));
+    app_sale_init(run_action);
+    ESP_ERROR_CHECK(http_client_init());
+    ESP_ERROR_CHECK(net_worker_init());
+    ESP_ERROR_CHECK(reconciler_init());
+    ESP_ERROR_CHECK(payment_watch_init(payment_status_cb));
+    ESP_ERROR_CHECK(charge_pool_init(0.50, "Produto teste", charge_result_cb));
+
+    run_sales();
+
+    // Give the reconciler time to cancel what was abandoned
+    int64_t settle_until = now_us() + SETTLE_MS * 1000LL;
+    while (reconciler_count() > 0 && now_us() < settle_until) {
+        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+    print_counters(reconciler_count());
+    return 0;
+}
@@ -0,0 +1,21 @@
+/**
+ * ESP-PIX - strlcpy() for the host build
+ *
+ * Built only when the C library has none, see CMakeLists.txt.
+ */
+
+#include <string.h>
+
+#include "strlcpy.h"
+
+size_t strlcpy(char *dst, const char *src, size_t size)
+{
+    size_t len = strlen(src);
+
+    if (size > 0) {
+        size_t n = len < size - 1 ? len : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return len;
+}
@@ -0,0 +1,97 @@
+/**
+ * ESP-PIX - Application state machine test
+ *
+ * Checks app_state_next() for every (state, event) pair: the pairs listed
+ * below must give the listed next state and action, and every other pair
+ * must be ignored and leave the state unchanged.
+ *
+ * Usage: espix_test_app_state
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "app_state.h"
+
+typedef struct {
+    app_state_t state;
+    app_event_type_t event;
+    app_state_t next;
+    app_action_t action;
+} expected_t;
+
+#define IDLE        APP_STATE_IDLE
+#define CREATING    APP_STATE_CREATING
+#define AWAITING    APP_STATE_AWAITING_PAYMENT
+#define DISPENSING  APP_STATE_DISPENSING
+
+static const expected_t EXPECTED[] = {
+    // A sale starts with a short press
+    { IDLE,       APP_EVENT_BUTTON_SHORT,     CREATING,   APP_ACTION_START_CHARGE },
+    // A charge that arrives after the sale was cancelled goes back to the pool
+    { IDLE,       APP_EVENT_CHARGE_CREATED,   IDLE,       APP_ACTION_STORE_CHARGE },
+    { IDLE,       APP_EVENT_SCREEN_TIMER,     IDLE,       APP_ACTION_NEXT_SCREEN },
+
+    { CREATING,   APP_EVENT_CHARGE_CREATED,   AWAITING,   APP_ACTION_SHOW_CHARGE },
+    { CREATING,   APP_EVENT_CHARGE_FAILED,    IDLE,       APP_ACTION_CHARGE_ERROR },
+    { CREATING,   APP_EVENT_BUTTON_LONG,      IDLE,       APP_ACTION_CANCEL },
+
+    { AWAITING,   APP_EVENT_COUNTDOWN_TICK,   AWAITING,   APP_ACTION_UPDATE_COUNTDOWN },
+    { AWAITING,   APP_EVENT_PAYMENT_PENDING,  AWAITING,   APP_ACTION_LOG_PENDING },
+    { AWAITING,   APP_EVENT_PAYMENT_APPROVED, DISPENSING, APP_ACTION_DISPENSE },
+    { AWAITING,   APP_EVENT_PAYMENT_REJECTED, IDLE,       APP_ACTION_REJECTED },
+    { AWAITING,   APP_EVENT_TIMEOUT,          IDLE,       APP_ACTION_EXPIRE },
+    { AWAITING,   APP_EVENT_BUTTON_LONG,      IDLE,       APP_ACTION_CANCEL },
+
+    { DISPENSING, APP_EVENT_DISPENSE_DONE,    IDLE,       APP_ACTION_DISPENSED },
+
+    // WiFi changes are reported in every state and change none
+    { IDLE,       APP_EVENT_WIFI_UP,          IDLE,       APP_ACTION_WIFI_CHANGED },
+    { IDLE,       APP_EVENT_WIFI_DOWN,        IDLE,       APP_ACTION_WIFI_CHANGED },
+    { CREATING,   APP_EVENT_WIFI_UP,          CREATING,   APP_ACTION_WIFI_CHANGED },
+    { CREATING,   APP_EVENT_WIFI_DOWN,        CREATING,   APP_ACTION_WIFI_CHANGED },
+    { AWAITING,   APP_EVENT_WIFI_UP,          AWAITING,   APP_ACTION_WIFI_CHANGED },
+    { AWAITING,   APP_EVENT_WIFI_DOWN,        AWAITING,   APP_ACTION_WIFI_CHANGED },
+    { DISPENSING, APP_EVENT_WIFI_UP,          DISPENSING, APP_ACTION_WIFI_CHANGED },
+    { DISPENSING, APP_EVENT_WIFI_DOWN,        DISPENSING, APP_ACTION_WIFI_CHANGED },
+};
+
+#define NUM_EXPECTED (int)(sizeof(EXPECTED) / sizeof(EXPECTED[0]))
+
+static const expected_t *find_expected(app_state_t state, app_event_type_t event)
+{
+    for (int i = 0; i < NUM_EXPECTED; i++) {
+        if (EXPECTED[i].state == state && EXPECTED[i].event == event) {
+            return &EXPECTED[i];
+        }
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    int checks = 0;
+    int failures = 0;
+
+    for (int s = 0; s < APP_STATE_COUNT; s++) {
+        for (int e = 0; e < APP_EVENT_COUNT; e++) {
+            const expected_t *exp = find_expected(s, e);
+            app_state_t want_next = exp != NULL ? exp->next : (app_state_t)s;
+            app_action_t want_action = exp != NULL ? exp->action : APP_ACTION_NONE;
+
+            app_state_t next = (app_state_t)s;
+            app_action_t action = app_state_next(s, e, &next);
+
+            checks++;
+            if (next != want_next || action != want_action) {
+                failures++;
+                printf("FALHA %s + evento %d: %s acao %d, esperado %s acao %d\n",
+                       app_state_name(s), e, app_state_name(next), action,
+                       app_state_name(want_next), want_action);
+            }
+        }
+    }
+
+    printf("%d verificacoes, %d falhas\n", checks, failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,547 @@
+/**
+ * ESP-PIX - QR Code round-trip test
+ *
+ * Decodes the symbols made by qrcode_gen.c and compares the payload with
+ * the encoded text, for every version, ECC level and mask. The decoder
+ * here is written from the standard (ISO/IEC 18004) and shares no tables
+ * or code with the encoder: it reads the format and version information,
+ * checks the function patterns, removes the mask, de-interleaves the
+ * blocks, verifies every Reed-Solomon block and parses the byte segment.
+ *
+ * Usage: espix_test_qrcode
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "qrcode_gen.h"
+#include "brcode.h"
+
+// ==========================================================
+// Tables from the standard, versions 1 to 15, indexed [ecc][version]
+// in qrcode_ecc_t order (L, M, Q, H)
+
+static const int TOTAL_CODEWORDS[16] = {
+    0, 26, 44, 70, 100, 134, 172, 196, 242, 292, 346, 404, 466, 532, 581, 655,
+};
+
+static const int ECC_PER_BLOCK[4][16] = {
+    { 0,  7, 10, 15, 20, 26, 18, 20, 24, 30, 18, 20, 24, 26, 30, 22 },
+    { 0, 10, 16, 26, 18, 24, 16, 18, 22, 22, 26, 30, 22, 22, 24, 24 },
+    { 0, 13, 22, 18, 26, 18, 24, 18, 22, 20, 24, 28, 26, 24, 20, 30 },
+    { 0, 17, 28, 22, 16, 22, 28, 26, 26, 24, 28, 24, 28, 22, 24, 24 },
+};
+
+static const int NUM_BLOCKS[4][16] = {
+    { 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 4, 4, 4, 4, 4, 6 },
+    { 0, 1, 1, 1, 2, 2, 4, 4, 4, 5, 5, 5, 8, 9, 9, 10 },
+    { 0, 1, 1, 2, 2, 4, 4, 6, 6, 8, 8, 8, 10, 12, 16, 12 },
+    { 0, 1, 1, 2, 4, 4, 4, 5, 6, 8, 8, 11, 11, 16, 16, 18 },
+};
+
+// Alignment pattern centers, 0-terminated
+static const int ALIGNMENT[16][5] = {
+    { 0 }, { 0 },
+    { 6, 18 }, { 6, 22 }, { 6, 26 }, { 6, 30 }, { 6, 34 },
+    { 6, 22, 38 }, { 6, 24, 42 }, { 6, 26, 46 }, { 6, 28, 50 },
+    { 6, 30, 54 }, { 6, 32, 58 }, { 6, 34, 62 },
+    { 6, 26, 46, 66 }, { 6, 26, 48, 70 },
+};
+
+// ECC level indicator of the format information
+static const int FORMAT_ECC[4] = { 1, 0, 3, 2 };
+
+static const char *const ECC_NAMES[4] = { "L", "M", "Q", "H" };
+
+// ==========================================================
+// GF(256) with the QR polynomial x^8 + x^4 + x^3 + x^2 + 1
+
+static uint8_t s_exp[512];
+static uint8_t s_log[256];
+
+static void gf_init(void)
+{
+    int x = 1;
+    for (int i = 0; i < 255; i++) {
+        s_exp[i] = x;
+        s_log[x] = i;
+        x <<= 1;
+        if (x & 0x100) {
+            x ^= 0x11D;
+        }
+    }
+    for (int i = 255; i < 512; i++) {
+        s_exp[i] = s_exp[i - 255];
+    }
+}
+
+static uint8_t gf_mul(uint8_t a, uint8_t b)
+{
+    return a == 0 || b == 0 ? 0 : s_exp[s_log[a] + s_log[b]];
+}
+
+/**
+ * @brief Check a Reed-Solomon block
+ *
+ * A valid codeword, read as a polynomial with the first byte as the
+ * highest power, has the generator's roots a^0 .. a^(n-1) as roots.
+ */
+static bool rs_valid(const uint8_t *block, int len, int num_ecc)
+{
+    for (int j = 0; j < num_ecc; j++) {
+        uint8_t root = s_exp[j];
+        uint8_t sum = 0;
+        for (int i = 0; i < len; i++) {
+            sum = gf_mul(sum, root) ^ block[i];
+        }
+        if (sum != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ==========================================================
+// Decoder
+
+typedef struct {
+    int size;
+    bool function[QRCODE_MAX_SIZE][QRCODE_MAX_SIZE];
+} layout_t;
+
+static bool module(const qrcode_t *qr, int x, int y)
+{
+    return qrcode_get_module(qr, x, y);
+}
+
+static void mark(layout_t *l, int x0, int y0, int w, int h)
+{
+    for (int y = y0; y < y0 + h; y++) {
+        for (int x = x0; x < x0 + w; x++) {
+            if (x >= 0 && y >= 0 && x < l->size && y < l->size) {
+                l->function[y][x] = true;
+            }
+        }
+    }
+}
+
+static int bch(int data, int data_bits, int poly, int poly_degree)
+{
+    int rem = data << poly_degree;
+    for (int bit = data_bits + poly_degree - 1; bit >= poly_degree; bit--) {
+        if (rem & (1 << bit)) {
+            rem ^= poly << (bit - poly_degree);
+        }
+    }
+    return data << poly_degree | rem;
+}
+
+static bool mask_applies(int mask, int x, int y)
+{
+    switch (mask) {
+        case 0: return (x + y) % 2 == 0;
+        case 1: return y % 2 == 0;
+        case 2: return x % 3 == 0;
+        case 3: return (x + y) % 3 == 0;
+        case 4: return (x / 3 + y / 2) % 2 == 0;
+        case 5: return x * y % 2 + x * y % 3 == 0;
+        case 6: return (x * y % 2 + x * y % 3) % 2 == 0;
+        default: return ((x + y) % 2 + x * y % 3) % 2 == 0;
+    }
+}
+
+static bool check_finder(const qrcode_t *qr, int x0, int y0)
+{
+    for (int dy = -1; dy <= 7; dy++) {
+        for (int dx = -1; dx <= 7; dx++) {
+            int x = x0 + dx, y = y0 + dy;
+            if (x < 0 || y < 0 || x >= qr->size || y >= qr->size) {
+                continue;
+            }
+            int ring = abs(dx - 3) > abs(dy - 3) ? abs(dx - 3) : abs(dy - 3);
+            bool dark = ring != 2 && ring != 4;
+            if (module(qr, x, y) != dark) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Read n bits MSB first from data at *bit
+static int read_bits(const uint8_t *data, int *bit, int n)
+{
+    int value = 0;
+    for (int i = 0; i < n; i++, (*bit)++) {
+        value = value << 1 | ((data[*bit >> 3] >> (7 - (*bit & 7))) & 1);
+    }
+    return value;
+}
+
+/**
+ * @brief Decode a symbol
+ * @param out Receives the payload, NUL-terminated
+ * @param why Reason for a failure
+ * @return Payload length, -1 on failure
+ */
+static int decode(const qrcode_t *qr, char *out, size_t out_size, int *ecc_out, int *mask_out,
+                  const char **why)
+{
+    int size = qr->size;
+    int ver = (size - 17) / 4;
+    if (ver < 1 || ver > QRCODE_MAX_VERSION || size != 17 + ver * 4) {
+        *why = "tamanho invalido";
+        return -1;
+    }
+
+    // Finders and their separators
+    if (!check_finder(qr, 0, 0) || !check_finder(qr, size - 7, 0) ||
+        !check_finder(qr, 0, size - 7)) {
+        *why = "padrao de localizacao";
+        return -1;
+    }
+
+    // Timing patterns
+    for (int i = 8; i < size - 8; i++) {
+        if (module(qr, i, 6) != (i % 2 == 0) || module(qr, 6, i) != (i % 2 == 0)) {
+            *why = "padrao de sincronismo";
+            return -1;
+        }
+    }
+
+    static layout_t l;
+    memset(&l, 0, sizeof(l));
+    l.size = size;
+    mark(&l, 0, 0, 9, 9);
+    mark(&l, size - 8, 0, 8, 9);
+    mark(&l, 0, size - 8, 9, 8);
+    mark(&l, 6, 0, 1, size);
+    mark(&l, 0, 6, size, 1);
+
+    // Alignment patterns, except where they would overlap a finder
+    for (int i = 0; ALIGNMENT[ver][i] != 0; i++) {
+        for (int j = 0; ALIGNMENT[ver][j] != 0; j++) {
+            int cx = ALIGNMENT[ver][i], cy = ALIGNMENT[ver][j];
+            if ((cx == 6 && cy == 6) || (cx == 6 && cy == size - 7) ||
+                (cx == size - 7 && cy == 6)) {
+                continue;
+            }
+            for (int dy = -2; dy <= 2; dy++) {
+                for (int dx = -2; dx <= 2; dx++) {
+                    int ring = abs(dx) > abs(dy) ? abs(dx) : abs(dy);
+                    if (module(qr, cx + dx, cy + dy) != (ring != 1)) {
+                        *why = "padrao de alinhamento";
+                        return -1;
+                    }
+                }
+            }
+            mark(&l, cx - 2, cy - 2, 5, 5);
+        }
+    }
+
+    // Version information, both copies
+    if (ver >= 7) {
+        int bits = bch(ver, 6, 0x1F25, 12);
+        for (int i = 0; i < 18; i++) {
+            int a = size - 11 + i % 3, b = i / 3;
+            bool bit = (bits >> i) & 1;
+            if (module(qr, a, b) != bit || module(qr, b, a) != bit) {
+                *why = "informacao de versao";
+                return -1;
+            }
+        }
+        mark(&l, size - 11, 0, 3, 6);
+        mark(&l, 0, size - 11, 6, 3);
+    }
+
+    if (!module(qr, 8, size - 8)) {
+        *why = "modulo escuro";
+        return -1;
+    }
+
+    // Format information: both copies must hold the same valid word
+    int copy1 = 0, copy2 = 0;
+    for (int i = 0; i < 15; i++) {
+        int x, y;
+        if (i < 6) {
+            x = 8; y = i;
+        } else if (i < 8) {
+            x = 8; y = i + 1;
+        } else if (i == 8) {
+            x = 7; y = 8;
+        } else {
+            x = 14 - i; y = 8;
+        }
+        copy1 |= module(qr, x, y) << i;
+
+        if (i < 8) {
+            x = size - 1 - i; y = 8;
+        } else {
+            x = 8; y = size - 15 + i;
+        }
+        copy2 |= module(qr, x, y) << i;
+    }
+    int ecc = -1, mask = -1;
+    for (int e = 0; e < 4; e++) {
+        for (int m = 0; m < 8; m++) {
+            if ((bch(FORMAT_ECC[e] << 3 | m, 5, 0x537, 10) ^ 0x5412) == copy1) {
+                ecc = e;
+                mask = m;
+            }
+        }
+    }
+    if (ecc < 0 || copy1 != copy2) {
+        *why = "informacao de formato";
+        return -1;
+    }
+
+    // Codewords in the two-column zigzag, right to left
+    static uint8_t raw[1024];
+    int total = TOTAL_CODEWORDS[ver];
+    int nbits = 0;
+    memset(raw, 0, sizeof(raw));
+    for (int right = size - 1; right >= 1; right -= 2) {
+        if (right == 6) {
+            right = 5;
+        }
+        bool upward = ((right + 1) & 2) == 0;
+        for (int v = 0; v < size; v++) {
+            int y = upward ? size - 1 - v : v;
+            for (int j = 0; j < 2; j++) {
+                int x = right - j;
+                if (l.function[y][x]) {
+                    continue;
+                }
+                bool bit = module(qr, x, y) ^ mask_applies(mask, x, y);
+                if (nbits < total * 8 && bit) {
+                    raw[nbits >> 3] |= 0x80 >> (nbits & 7);
+                }
+                nbits++;
+            }
+        }
+    }
+    if (nbits / 8 != total) {
+        *why = "numero de modulos de dados";
+        return -1;
+    }
+
+    // De-interleave: data bytes round-robin over the blocks (short blocks
+    // first), then the ECC bytes the same way
+    int num_blocks = NUM_BLOCKS[ecc][ver];
+    int num_ecc = ECC_PER_BLOCK[ecc][ver];
+    int short_len = total / num_blocks;
+    int num_short = num_blocks - total % num_blocks;
+    static uint8_t blocks[32][160];
+    int pos = 0;
+    for (int i = 0; i < short_len - num_ecc + 1; i++) {
+        for (int b = 0; b < num_blocks; b++) {
+            int data_len = short_len - num_ecc + (b >= num_short);
+            if (i < data_len) {
+                blocks[b][i] = raw[pos++];
+            }
+        }
+    }
+    for (int i = 0; i < num_ecc; i++) {
+        for (int b = 0; b < num_blocks; b++) {
+            int data_len = short_len - num_ecc + (b >= num_short);
+            blocks[b][data_len + i] = raw[pos++];
+        }
+    }
+
+    static uint8_t data[1024];
+    int data_len = 0;
+    for (int b = 0; b < num_blocks; b++) {
+        int len = short_len + (b >= num_short);
+        if (!rs_valid(blocks[b], len, num_ecc)) {
+            *why = "Reed-Solomon";
+            return -1;
+        }
+        memcpy(data + data_len, blocks[b], len - num_ecc);
+        data_len += len - num_ecc;
+    }
+
+    // A single byte segment, terminator and pad codewords
+    int bit = 0;
+    if (read_bits(data, &bit, 4) != 0x4) {
+        *why = "modo diferente de byte";
+        return -1;
+    }
+    int count = read_bits(data, &bit, ver < 10 ? 8 : 16);
+    if (bit + count * 8 > data_len * 8 || (size_t)count >= out_size) {
+        *why = "contagem de caracteres";
+        return -1;
+    }
+    for (int i = 0; i < count; i++) {
+        out[i] = read_bits(data, &bit, 8);
+    }
+    out[count] = '\0';
+
+    int left = data_len * 8 - bit;
+    int term = left < 4 ? left : 4;
+    if (read_bits(data, &bit, term) != 0) {
+        *why = "terminador";
+        return -1;
+    }
+    while (bit & 7) {
+        if (read_bits(data, &bit, 1) != 0) {
+            *why = "preenchimento de bits";
+            return -1;
+        }
+    }
+    for (int i = 0; bit < data_len * 8; i++) {
+        if (read_bits(data, &bit, 8) != (i % 2 == 0 ? 0xEC : 0x11)) {
+            *why = "bytes de preenchimento";
+            return -1;
+        }
+    }
+
+    *ecc_out = ecc;
+    *mask_out = mask;
+    return count;
+}
+
+// ==========================================================
+// Tests
+
+static int s_checks = 0;
+static int s_failures = 0;
+
+// Largest byte-mode payload of a version and ECC level
+static int capacity(int ver, int ecc)
+{
+    int data_bits = (TOTAL_CODEWORDS[ver] - NUM_BLOCKS[ecc][ver] * ECC_PER_BLOCK[ecc][ver]) * 8;
+    return (data_bits - 4 - (ver < 10 ? 8 : 16)) / 8;
+}
+
+// Payload of len bytes from 1 to 255, varied by seed
+static void make_text(char *text, int len, uint32_t seed)
+{
+    for (int i = 0; i < len; i++) {
+        seed = seed * 1103515245 + 12345;
+        text[i] = 1 + (seed >> 16) % 255;
+    }
+    text[len] = '\0';
+}
+
+static void check(const qrcode_t *qr, const char *text, int ver, int ecc, int mask,
+                  const char *label)
+{
+    static char decoded[1024];
+    const char *why = "";
+    int got_ecc = -1, got_mask = -1;
+
+    s_checks++;
+    int len = decode(qr, decoded, sizeof(decoded), &got_ecc, &got_mask, &why);
+    if (len < 0) {
+        // Reported below
+    } else if ((size_t)len != strlen(text) || memcmp(decoded, text, len) != 0) {
+        why = "conteudo diferente";
+    } else if (qr->version != (ver > 0 ? ver : qr->version) ||
+               (size_t)qr->size != 17u + qr->version * 4u) {
+        why = "versao";
+    } else if (got_ecc != qr->ecc || (ecc >= 0 && got_ecc != ecc)) {
+        why = "nivel de ECC";
+    } else if (got_mask != qr->mask || (mask >= 0 && got_mask != mask)) {
+        why = "mascara";
+    } else {
+        return;
+    }
+
+    s_failures++;
+    printf("FALHA %s: %s (versao %d, ECC %s, mascara %d, %zu bytes)\n", label, why,
+           qr->version, ECC_NAMES[qr->ecc & 3], qr->mask, strlen(text));
+}
+
+static void test_every_version_ecc_mask(void)
+{
+    static qrcode_t qr;
+    static char text[1024];
+    char label[48];
+
+    for (int ver = 1; ver <= QRCODE_MAX_VERSION; ver++) {
+        for (int ecc = 0; ecc < 4; ecc++) {
+            // Shortest and longest payloads that need this version
+            int lengths[2] = { ver == 1 ? 1 : capacity(ver - 1, ecc) + 1, capacity(ver, ecc) };
+            for (int l = 0; l < 2; l++) {
+                for (int mask = 0; mask < 8; mask++) {
+                    make_text(text, lengths[l], ver * 1000 + ecc * 100 + mask * 10 + l);
+                    snprintf(label, sizeof(label), "v%d-%s-m%d-%s", ver, ECC_NAMES[ecc], mask,
+                             l == 0 ? "min" : "max");
+                    if (!qrcode_generate_fixed(&qr, text, ecc, mask)) {
+                        s_checks++;
+                        s_failures++;
+                        printf("FALHA %s: nao gerou\n", label);
+                        continue;
+                    }
+                    check(&qr, text, ver, ecc, mask, label);
+                }
+            }
+
+            // One byte over the capacity needs the next version
+            make_text(text, capacity(ver, ecc) + 1, ver);
+            s_checks++;
+            if (qrcode_generate_fixed(&qr, text, ecc, 0) && qr.version == ver) {
+                s_failures++;
+                printf("FALHA v%d-%s: dados acima da capacidade\n", ver, ECC_NAMES[ecc]);
+            }
+        }
+    }
+}
+
+static void test_automatic(void)
+{
+    static qrcode_t qr;
+    static char text[1024];
+    char label[48];
+
+    // The mask and ECC level picked by the encoder
+    for (int len = 1; len <= capacity(QRCODE_MAX_VERSION, 0); len += 7) {
+        make_text(text, len, len);
+        snprintf(label, sizeof(label), "auto-%d", len);
+        if (!qrcode_generate(&qr, text)) {
+            s_checks++;
+            s_failures++;
+            printf("FALHA %s: nao gerou\n", label);
+            continue;
+        }
+        check(&qr, text, -1, -1, -1, label);
+    }
+
+    // A BR Code as shown on the display
+    char payload[256];
+    brcode_params_t params = {
+        .pix_key = "9d36b84f-c70b-478f-b95c-12729b90ca25",
+        .merchant_name = "CAFE EXPRESSO",
+        .merchant_city = "SAO PAULO",
+        .amount_cents = 50,
+        .txid = "K7Q2M9X4T1B8R5W3Z6N0P4L2J",
+    };
+    if (brcode_build(&params, payload, sizeof(payload)) == ESP_OK &&
+        qrcode_generate(&qr, payload)) {
+        check(&qr, payload, -1, -1, -1, "brcode");
+    } else {
+        s_checks++;
+        s_failures++;
+        printf("FALHA brcode: nao gerou\n");
+    }
+
+    make_text(text, capacity(QRCODE_MAX_VERSION, 0) + 1, 1);
+    s_checks++;
+    if (qrcode_generate(&qr, text)) {
+        s_failures++;
+        printf("FALHA: texto maior que a versao %d foi aceito\n", QRCODE_MAX_VERSION);
+    }
+}
+
+int main(void)
+{
+    gf_init();
+    test_every_version_ecc_mask();
+    test_automatic();
+
+    printf("%d verificacoes, %d falhas\n", s_checks, s_failures);
+    return s_failures == 0 ? 0 : 1;
+}
@@ -1,6 +1,6 @@
 /**
  * ESP-PIX - ESP-IDF 5.5.0 PIX Payment System
- * 
+ *
  * Main application file
  */
 
@@ -8,201 +8,441 @@
 #include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/queue.h"
 #include "driver/gpio.h"
 #include "esp_log.h"
 #include "esp_timer.h"
 
 #include "wifi_manager.h"
 #include "http_client.h"
+#include "net_worker.h"
 #include "http_server.h"
+#include "payment_watch.h"
+#include "charge_pool.h"
+#include "reconciler.h"
+#include "app_sale.h"
+#include "metrics.h"
+#include "trace.h"
 #include "display_st7735.h"
-#include "qrcode_gen.h"
 #include "servo_ctrl.h"
 #include "buzzer.h"
+#include "images/rapport_pix_logo.h"
 
 static const char *TAG = "esp-pix";
 
+#define APP_QUEUE_LEN           16
+
+#define BUTTON_DEBOUNCE_MS      30
+#define BUTTON_SHORT_MAX_MS     800
+#define BUTTON_LONG_MS          3000
+
+#define LED_BLINK_MS            150
+#define LED_BLINK_TOGGLES       10
+
+// Raw button edge from the ISR. Turned into BUTTON_SHORT/LONG by the
+// debounce logic and never passed to the transition table.
+#define APP_EVENT_BUTTON_EDGE   APP_EVENT_COUNT
+
 // Global state
-static char g_payment_id[64] = {0};
-static char g_qr_data[512] = {0};
+static QueueHandle_t g_events = NULL;
 static float g_amount = 0;
-static bool g_system_active = false;
-static int64_t g_last_poll_time = 0;
 static int64_t g_qr_start_time = 0;
+static uint32_t g_sale_trace = 0;      // TRACE_SALE span of the current sale
+
+static display_label_t g_countdown_label;
+static esp_timer_handle_t g_countdown_timer = NULL;
+static esp_timer_handle_t g_timeout_timer = NULL;
+static esp_timer_handle_t g_screen_timer = NULL;
+static esp_timer_handle_t g_led_timer = NULL;
 
 // Forward declarations
-static void cancel_charge(void);
+static void show_countdown(void);
+
+/**
+ * @brief Post an event from a timer, driver or servo callback
+ *
+ * Only countdown ticks may be dropped, the next one redraws the same
+ * label; any other event waits for room in the queue, since losing e.g.
+ * DISPENSE_DONE would leave the application stuck. Never call from the
+ * application task itself.
+ */
+static void post_event(app_event_type_t type)
+{
+    app_event_t evt = { .type = type };
+    TickType_t wait = type == APP_EVENT_COUNTDOWN_TICK ? 0 : portMAX_DELAY;
+    if (xQueueSend(g_events, &evt, wait) != pdTRUE) {
+        ESP_LOGD(TAG, "Fila de eventos cheia, evento %d perdido", type);
+    }
+}
 
 // ==========================================================
 // Button handling
+//
+// The ISR reports the first edge and disables the interrupt, so a bouncing
+// contact posts a single event. The level is sampled once the debounce
+// time has passed and the interrupt is enabled again; press and release
+// are then timed on the esp_timer task.
 typedef struct {
     int64_t press_start;
-    bool holding;
+    bool pressed;
+    bool long_sent;
 } button_state_t;
 
-static button_state_t g_button = {0, false};
+static button_state_t g_button = {0, false, false};
+static esp_timer_handle_t g_debounce_timer = NULL;
+static esp_timer_handle_t g_long_press_timer = NULL;
+
+static void IRAM_ATTR button_isr(void *arg)
+{
+    app_event_t evt = { .type = APP_EVENT_BUTTON_EDGE };
+    BaseType_t woken = pdFALSE;
+    // With the queue full the interrupt stays on and a later edge retries
+    if (xQueueSendFromISR(g_events, &evt, &woken) == pdTRUE) {
+        gpio_intr_disable(CONFIG_ESP_PIX_BUTTON_GPIO);
+    }
+    if (woken) {
+        portYIELD_FROM_ISR();
+    }
+}
 
-static bool handle_button(void)
+static void debounce_timer_cb(void *arg)
 {
+    // Enabled before sampling: a change after the sample raises a new edge
+    gpio_intr_enable(CONFIG_ESP_PIX_BUTTON_GPIO);
     bool pressed = gpio_get_level(CONFIG_ESP_PIX_BUTTON_GPIO) == 0;
     int64_t now = esp_timer_get_time() / 1000;  // Convert to ms
 
-    if (pressed && g_button.press_start == 0) {
-        g_button.press_start = now;
+    if (pressed == g_button.pressed) {
+        return;
     }
+    g_button.pressed = pressed;
 
-    // Long press to cancel (3 seconds)
-    if (pressed && (now - g_button.press_start > 3000) && g_system_active && !g_button.holding) {
-        g_button.holding = true;
-        ESP_LOGI(TAG, "Cancelando cobranca...");
-        display_show_message("Cancelando", "Aguarde...", ST7735_RED);
-        cancel_charge();
+    if (pressed) {
+        g_button.press_start = now;
+        g_button.long_sent = false;
+        esp_timer_start_once(g_long_press_timer, (BUTTON_LONG_MS - BUTTON_DEBOUNCE_MS) * 1000);
+        return;
     }
 
-    if (!pressed && g_button.press_start > 0) {
-        int64_t press_time = now - g_button.press_start;
-        g_button.press_start = 0;
-        g_button.holding = false;
+    esp_timer_stop(g_long_press_timer);
 
-        // Short press to start
-        if (press_time < 800 && !g_system_active) {
-            return true;
-        }
+    // Short press to start
+    if (!g_button.long_sent && now - g_button.press_start < BUTTON_SHORT_MAX_MS) {
+        trace_instant(TRACE_BUTTON);
+        post_event(APP_EVENT_BUTTON_SHORT);
     }
+}
 
-    return false;
+static void long_press_timer_cb(void *arg)
+{
+    // Long press to cancel (3 seconds)
+    if (g_button.pressed) {
+        g_button.long_sent = true;
+        post_event(APP_EVENT_BUTTON_LONG);
+    }
+}
+
+static void handle_button_edge(void)
+{
+    esp_timer_stop(g_debounce_timer);
+    esp_timer_start_once(g_debounce_timer, BUTTON_DEBOUNCE_MS * 1000);
 }
 
 // ==========================================================
 // Create charge
-static void create_charge(float amount, const char *description)
+//
+// Charges come from the charge pool, which creates them and encodes their
+// QR codes on its own task; app_sale.c hands them over.
+static void charge_result_cb(esp_err_t err, const char *payment_id)
 {
-    if (!wifi_manager_is_connected()) {
-        ESP_LOGW(TAG, "WiFi desconectado!");
-        buzzer_beep(3, 150, 500);
-        display_show_message("Erro", "Sem WiFi!", ST7735_RED);
+    app_event_t evt;
+    app_sale_charge_event(err, payment_id, &evt);
+    xQueueSend(g_events, &evt, portMAX_DELAY);
+}
+
+static void end_sale(void)
+{
+    trace_end(TRACE_SALE, g_sale_trace);
+    g_sale_trace = 0;
+}
+
+static void start_charge(void)
+{
+    end_sale();
+    g_sale_trace = trace_begin(TRACE_SALE);
+
+    // The blinking of the previous sale would override the LED
+    esp_timer_stop(g_screen_timer);
+    esp_timer_stop(g_led_timer);
+    gpio_set_level(CONFIG_ESP_PIX_LED_GPIO, 1);
+
+    // A charge prepared in the background is shown right away
+    if (app_sale_start_charge()) {
         return;
     }
 
-    payment_response_t response;
-    esp_err_t err = http_create_charge(amount, description, &response);
-
-    if (err == ESP_OK && response.success) {
-        strlcpy(g_payment_id, response.payment_id, sizeof(g_payment_id));
-        strlcpy(g_qr_data, response.qr_code, sizeof(g_qr_data));
-        g_amount = response.amount;
-
-        // Generate and display QR code
-        qrcode_t qrcode;
-        if (qrcode_generate(&qrcode, g_qr_data)) {
-            display_show_qrcode(qrcode.data, qrcode.size, g_amount);
-            buzzer_beep(2, 150, 1500);
-            g_system_active = true;
-            g_qr_start_time = esp_timer_get_time() / 1000;
-        } else {
-            ESP_LOGE(TAG, "Falha ao gerar QR Code");
-            display_show_message("Erro", "QR Code falhou", ST7735_RED);
-            buzzer_beep(3, 200, 500);
-        }
+    buzzer_beep(1, 150, 1500);
+    display_show_message("Gerando PIX", "Aguarde...", ST7735_YELLOW);
+}
+
+static void show_charge(void)
+{
+    const prepared_charge_t *charge = app_sale_charge();
+    g_amount = charge->response.amount;
+
+    uint32_t trace = trace_begin(TRACE_QR_RENDER);
+    display_show_qrcode(&charge->qrcode, g_amount);
+    trace_end(TRACE_QR_RENDER, trace);
+    buzzer_beep(2, 150, 1500);
+
+    g_qr_start_time = esp_timer_get_time() / 1000;
+    display_label_init(&g_countdown_label, 10, 140, 12, 1, ST7735_BLACK, ST7735_YELLOW);
+    show_countdown();
+    esp_timer_start_periodic(g_countdown_timer, 1000 * 1000);
+    esp_timer_start_once(g_timeout_timer, (uint64_t)CONFIG_ESP_PIX_PAYMENT_TIMEOUT_MS * 1000);
+    app_sale_watch_payment();
+}
+
+static void charge_error(esp_err_t err)
+{
+    end_sale();
+
+    if (err == ESP_ERR_INVALID_STATE) {
+        buzzer_beep(3, 150, 500);
+        display_show_message("Erro", "Sem WiFi!", ST7735_RED);
+    } else if (err == ESP_ERR_INVALID_SIZE) {
+        display_show_message("Erro", "QR Code falhou", ST7735_RED);
+        buzzer_beep(3, 200, 500);
     } else {
-        ESP_LOGE(TAG, "Erro ao criar cobranca");
-        display_show_message("Erro", "Criar cobranca", ST7735_RED);
+        display_show_message("Erro", "Criar cobran\xC3\xA7" "a", ST7735_RED);
         buzzer_beep(3, 200, 500);
     }
 }
 
 // ==========================================================
 // Cancel charge
-static void cancel_charge(void)
+static void end_payment_window(void)
 {
+    esp_timer_stop(g_countdown_timer);
+    esp_timer_stop(g_timeout_timer);
+}
+
+/**
+ * @param open The charge may still be paid; the reconciler cancels it on
+ *             the backend and looks out for a late payment
+ */
+static void cancel_charge(bool open)
+{
+    end_payment_window();
+    end_sale();
     servo_detach();
-    
-    if (strlen(g_payment_id) > 0) {
+
+    if (app_sale_end_payment(open)) {
         ESP_LOGI(TAG, "Cobranca cancelada!");
-        memset(g_payment_id, 0, sizeof(g_payment_id));
     }
-    
-    g_system_active = false;
+
+    esp_timer_stop(g_led_timer);
     gpio_set_level(CONFIG_ESP_PIX_LED_GPIO, 0);
     buzzer_beep(2, 150, 600);
-    display_show_message("Cancelado", "Pressione o botao", ST7735_WHITE);
+    display_show_message("Cancelado", "Pressione o bot\xC3\xA3o", ST7735_WHITE);
 }
 
 // ==========================================================
-// Check payment status
-static bool check_payment_status(void)
+// Payment status
+static void payment_status_cb(const char *payment_id, payment_status_t status)
 {
-    if (strlen(g_payment_id) == 0 || !wifi_manager_is_connected()) {
-        return false;
-    }
+    app_event_t evt;
 
-    payment_status_t status = http_check_payment_status(g_payment_id);
-    
+    if (!app_sale_payment_event(payment_id, status, &evt)) {
+        return;
+    }
     if (status == PAYMENT_STATUS_APPROVED) {
-        buzzer_beep(2, 150, 2000);
-        return true;
+        trace_instant(TRACE_APPROVAL);
     }
-    
-    return false;
+    // A final status ends the watch and is not reported again
+    xQueueSend(g_events, &evt, status == PAYMENT_STATUS_PENDING ? pdMS_TO_TICKS(100)
+                                                                : portMAX_DELAY);
+}
+
+static void wifi_status_cb(bool connected)
+{
+    post_event(connected ? APP_EVENT_WIFI_UP : APP_EVENT_WIFI_DOWN);
 }
 
 // ==========================================================
 // Dispense product
+//
+// The servo runs on its own task and the screens, beeps and LED that follow
+// are timed by esp_timers, so the next sale can start as soon as the
+// product has dropped.
+static int g_screen_step = 0;
+static int g_led_toggles = 0;
+static int64_t g_dispense_start = 0;
+static uint32_t g_dispense_trace = 0;
+
+static void servo_done_cb(void)
+{
+    post_event(APP_EVENT_DISPENSE_DONE);
+}
+
+static void led_timer_cb(void *arg)
+{
+    gpio_set_level(CONFIG_ESP_PIX_LED_GPIO, g_led_toggles % 2);
+    if (++g_led_toggles >= LED_BLINK_TOGGLES) {
+        esp_timer_stop(g_led_timer);
+    }
+}
+
+static void screen_timer_cb(void *arg)
+{
+    post_event(APP_EVENT_SCREEN_TIMER);
+}
+
 static void dispense(void)
 {
+    end_payment_window();
+    app_sale_end_payment(false);
+
     ESP_LOGI(TAG, "Pagamento confirmado!");
+    metrics_inc(METRIC_CHARGES_PAID);
+    g_dispense_start = esp_timer_get_time();
+    g_dispense_trace = trace_begin(TRACE_DISPENSE);
     display_show_message("Pagamento", "Confirmado!", ST7735_GREEN);
-    buzzer_beep(3, 150, 1800);
-    
-    servo_dispense();
+    buzzer_beep_async(3, 150, 1800);
 
-    display_show_message("Liberado", "Retire o produto", ST7735_WHITE);
-    vTaskDelay(pdMS_TO_TICKS(3000));
-    
-    display_show_message("Obrigado!", "Volte sempre!", ST7735_GREEN);
-    vTaskDelay(pdMS_TO_TICKS(2000));
-
-    // Blink LED
-    for (int i = 0; i < 5; i++) {
-        gpio_set_level(CONFIG_ESP_PIX_LED_GPIO, 0);
-        vTaskDelay(pdMS_TO_TICKS(150));
-        gpio_set_level(CONFIG_ESP_PIX_LED_GPIO, 1);
-        vTaskDelay(pdMS_TO_TICKS(150));
+    if (servo_dispense_async(servo_done_cb) != ESP_OK) {
+        ESP_LOGE(TAG, "Servo ocupado");
+        // Already in DISPENSING: finish the sale through the table
+        app_event_t done = { .type = APP_EVENT_DISPENSE_DONE };
+        app_sale_dispatch(&done);
     }
+}
 
-    memset(g_payment_id, 0, sizeof(g_payment_id));
-    g_system_active = false;
-    display_show_message("Pronto", "Pressione o botao", ST7735_WHITE);
+static void dispensed(void)
+{
+    metrics_observe(METRIC_HIST_DISPENSE, esp_timer_get_time() - g_dispense_start);
+    trace_end(TRACE_DISPENSE, g_dispense_trace);
+    end_sale();
+    display_show_message("Liberado", "Retire o produto", ST7735_WHITE);
+
+    g_led_toggles = 0;
+    esp_timer_start_periodic(g_led_timer, LED_BLINK_MS * 1000);
+
+    g_screen_step = 0;
+    esp_timer_start_once(g_screen_timer, 3000 * 1000);
+}
+
+static void next_screen(void)
+{
+    if (g_screen_step++ == 0) {
+        display_show_message("Obrigado!", "Volte sempre!", ST7735_GREEN);
+        esp_timer_start_once(g_screen_timer, 2000 * 1000);
+    } else {
+        display_show_message("Pronto", "Pressione o bot\xC3\xA3o", ST7735_WHITE);
+    }
 }
 
 // ==========================================================
 // Show countdown
 static void show_countdown(void)
 {
-    if (!g_system_active) return;
-
     int64_t now = esp_timer_get_time() / 1000;
     int64_t elapsed = now - g_qr_start_time;
-    
-    if (elapsed >= CONFIG_ESP_PIX_PAYMENT_TIMEOUT_MS) {
-        ESP_LOGI(TAG, "Tempo expirado!");
-        display_show_message("Expirado", "Cobranca cancelada", ST7735_RED);
-        cancel_charge();
-        return;
-    }
+    int remaining = (CONFIG_ESP_PIX_PAYMENT_TIMEOUT_MS - elapsed + 500) / 1000;
+    if (remaining < 0) remaining = 0;
 
-    int remaining = (CONFIG_ESP_PIX_PAYMENT_TIMEOUT_MS - elapsed) / 1000;
-    
-    // Update countdown on display
+    // Update countdown on display; only the digits that changed are redrawn
     char countdown_str[32];
     snprintf(countdown_str, sizeof(countdown_str), "Tempo: %ds", remaining);
-    
-    // Clear countdown area and display new value
-    display_fill_rect(0, 155, 160, 10, ST7735_WHITE);
-    display_set_text_color(ST7735_BLACK);
-    display_set_cursor(10, 140);
-    display_set_text_size(1);
-    display_print(countdown_str);
+    display_label_set(&g_countdown_label, countdown_str);
+    display_flush();
+}
+
+// ==========================================================
+// Event dispatch
+static void run_action(app_action_t action, const app_event_t *evt)
+{
+    switch (action) {
+        case APP_ACTION_START_CHARGE:
+            start_charge();
+            break;
+        case APP_ACTION_SHOW_CHARGE:
+            show_charge();
+            break;
+        case APP_ACTION_STORE_CHARGE:
+            app_sale_store_charge();
+            break;
+        case APP_ACTION_CHARGE_ERROR:
+            charge_error(evt->err);
+            break;
+        case APP_ACTION_CANCEL:
+            ESP_LOGI(TAG, "Cancelando cobranca...");
+            display_show_message("Cancelando", "Aguarde...", ST7735_RED);
+            cancel_charge(true);
+            break;
+        case APP_ACTION_EXPIRE:
+            ESP_LOGI(TAG, "Tempo expirado!");
+            display_show_message("Expirado", "Cobran\xC3\xA7" "a cancelada", ST7735_RED);
+            cancel_charge(true);
+            break;
+        case APP_ACTION_UPDATE_COUNTDOWN:
+            show_countdown();
+            break;
+        case APP_ACTION_LOG_PENDING:
+            ESP_LOGI(TAG, "Aguardando pagamento...");
+            break;
+        case APP_ACTION_REJECTED:
+            ESP_LOGW(TAG, "Pagamento recusado!");
+            display_show_message("Recusado", "Pagamento recusado", ST7735_RED);
+            cancel_charge(false);
+            break;
+        case APP_ACTION_DISPENSE:
+            dispense();
+            break;
+        case APP_ACTION_DISPENSED:
+            dispensed();
+            break;
+        case APP_ACTION_NEXT_SCREEN:
+            next_screen();
+            break;
+        case APP_ACTION_WIFI_CHANGED:
+            if (evt->type == APP_EVENT_WIFI_DOWN) {
+                ESP_LOGW(TAG, "WiFi desconectado!");
+            } else {
+                ESP_LOGI(TAG, "WiFi conectado!");
+            }
+            break;
+        case APP_ACTION_NONE:
+            break;
+    }
+}
+
+static void dispatch(const app_event_t *evt)
+{
+    if (evt->type == APP_EVENT_BUTTON_EDGE) {
+        handle_button_edge();
+        return;
+    }
+    app_sale_dispatch(evt);
+}
+
+static void create_timer(esp_timer_cb_t cb, const char *name, esp_timer_handle_t *timer)
+{
+    const esp_timer_create_args_t args = {
+        .callback = cb,
+        .name = name,
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&args, timer));
+}
+
+static void countdown_timer_cb(void *arg)
+{
+    post_event(APP_EVENT_COUNTDOWN_TICK);
+}
+
+static void timeout_timer_cb(void *arg)
+{
+    post_event(APP_EVENT_TIMEOUT);
 }
 
 // ==========================================================
@@ -210,6 +450,15 @@ static void show_countdown(void)
 void app_main(void)
 {
     ESP_LOGI(TAG, "ESP-PIX iniciando...");
+    app_sale_init(run_action);
+
+    g_events = xQueueCreate(APP_QUEUE_LEN, sizeof(app_event_t));
+    create_timer(debounce_timer_cb, "btn_debounce", &g_debounce_timer);
+    create_timer(long_press_timer_cb, "btn_long", &g_long_press_timer);
+    create_timer(countdown_timer_cb, "countdown", &g_countdown_timer);
+    create_timer(timeout_timer_cb, "pay_timeout", &g_timeout_timer);
+    create_timer(screen_timer_cb, "screen", &g_screen_timer);
+    create_timer(led_timer_cb, "led_blink", &g_led_timer);
 
     // Configure LED GPIO
     gpio_config_t led_conf = {
@@ -227,7 +476,7 @@ void app_main(void)
         .mode = GPIO_MODE_INPUT,
         .pull_up_en = GPIO_PULLUP_ENABLE,
         .pull_down_en = GPIO_PULLDOWN_DISABLE,
-        .intr_type = GPIO_INTR_DISABLE,
+        .intr_type = GPIO_INTR_ANYEDGE,
     };
     gpio_config(&btn_conf);
 
@@ -235,25 +484,37 @@ void app_main(void)
     buzzer_init();
     servo_init();
     display_init();
+#if CONFIG_ESP_PIX_DISPLAY_BENCHMARK
+    display_benchmark(20);
+    display_benchmark_image(&RAPPORT_PIX_LOGO, 20);
+#endif
 
-    // Show welcome message with Cafe Expresso branding
-    display_show_message("Caf\xC3\xA9 Expresso", "Sistema Cognitivo de Cobranca Embarcada", ST7735_WHITE);
+    // Show welcome screen with Cafe Expresso branding
+    display_show_logo(&RAPPORT_PIX_LOGO, "Caf\xC3\xA9 Expresso", "Cobran\xC3\xA7" "a Embarcada");
 
     // Initialize WiFi
     ESP_LOGI(TAG, "Conectando ao WiFi...");
     wifi_manager_init();
-    
+    http_client_init();
+    net_worker_init();
+    reconciler_init();
+    payment_watch_init(payment_status_cb);
+
     // Wait for WiFi connection
     while (!wifi_manager_is_connected()) {
         vTaskDelay(pdMS_TO_TICKS(500));
         gpio_set_level(CONFIG_ESP_PIX_LED_GPIO, !gpio_get_level(CONFIG_ESP_PIX_LED_GPIO));
     }
-    
+    wifi_manager_set_callback(wifi_status_cb);
+
+    // Starts preparing charges while the remaining screens are shown
+    charge_pool_init(0.50, "Produto teste", charge_result_cb);
+
     gpio_set_level(CONFIG_ESP_PIX_LED_GPIO, 1);
     ESP_LOGI(TAG, "WiFi conectado!");
     display_show_message("WiFi", "Conectado!", ST7735_GREEN);
     vTaskDelay(pdMS_TO_TICKS(1000));
-    
+
     // Start HTTP REST server
     ESP_LOGI(TAG, "Iniciando servidor HTTP...");
     if (http_server_start() == ESP_OK) {
@@ -266,36 +527,19 @@ void app_main(void)
     } else {
         ESP_LOGE(TAG, "Falha ao iniciar servidor HTTP");
     }
-    
-    display_show_message("Pronto", "Pressione o botao", ST7735_WHITE);
+
+    display_show_message("Pronto", "Pressione o bot\xC3\xA3o", ST7735_WHITE);
     buzzer_beep(1, 200, 1500);
 
-    // Main loop
-    while (1) {
-        // Check button
-        if (handle_button()) {
-            gpio_set_level(CONFIG_ESP_PIX_LED_GPIO, 1);
-            buzzer_beep(1, 150, 1500);
-            display_show_message("Gerando PIX", "Aguarde...", ST7735_YELLOW);
-            create_charge(0.50, "Produto teste");
-        }
+    // Button events are only accepted from here on
+    gpio_install_isr_service(0);
+    gpio_isr_handler_add(CONFIG_ESP_PIX_BUTTON_GPIO, button_isr, NULL);
 
-        // Active payment session
-        if (g_system_active && strlen(g_payment_id) > 0) {
-            show_countdown();
-            
-            // Check payment status every 5 seconds
-            int64_t now = esp_timer_get_time() / 1000;
-            if (now - g_last_poll_time > 5000) {
-                g_last_poll_time = now;
-                if (check_payment_status()) {
-                    dispense();
-                } else {
-                    ESP_LOGI(TAG, "Aguardando pagamento...");
-                }
-            }
+    // Main loop: sleep until the next event
+    while (1) {
+        app_event_t evt;
+        if (xQueueReceive(g_events, &evt, portMAX_DELAY) == pdTRUE) {
+            dispatch(&evt);
         }
-
-        vTaskDelay(pdMS_TO_TICKS(100));  // 100ms loop delay
     }
 }
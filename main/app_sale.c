@@ -0,0 +1,131 @@
+#include <string.h>
+#include "esp_log.h"
+
+#include "app_sale.h"
+#include "payment_watch.h"
+#include "reconciler.h"
+#include "telemetry.h"
+
+static const char *TAG = "app_sale";
+
+static app_sale_action_cb_t s_run_action = NULL;
+static app_state_t s_state = APP_STATE_IDLE;
+static char s_payment_id[64] = {0};    // Charge shown, empty if none
+
+// s_charge belongs to the pool task while s_charge_busy is set and to the
+// application task otherwise.
+static prepared_charge_t s_charge;
+static bool s_charge_busy = false;
+
+void app_sale_init(app_sale_action_cb_t run_action)
+{
+    s_run_action = run_action;
+    telemetry_set_state(app_state_name(s_state));
+}
+
+void app_sale_charge_event(esp_err_t err, const char *payment_id, app_event_t *evt)
+{
+    memset(evt, 0, sizeof(*evt));
+    evt->type = err == ESP_OK ? APP_EVENT_CHARGE_CREATED : APP_EVENT_CHARGE_FAILED;
+    evt->err = err;
+    strlcpy(evt->payment_id, payment_id, sizeof(evt->payment_id));
+}
+
+bool app_sale_payment_event(const char *payment_id, payment_status_t status, app_event_t *evt)
+{
+    memset(evt, 0, sizeof(*evt));
+    switch (status) {
+        case PAYMENT_STATUS_PENDING:  evt->type = APP_EVENT_PAYMENT_PENDING; break;
+        case PAYMENT_STATUS_APPROVED: evt->type = APP_EVENT_PAYMENT_APPROVED; break;
+        case PAYMENT_STATUS_REJECTED:
+        case PAYMENT_STATUS_CANCELLED: evt->type = APP_EVENT_PAYMENT_REJECTED; break;
+        default: return false;
+    }
+    strlcpy(evt->payment_id, payment_id, sizeof(evt->payment_id));
+    return true;
+}
+
+void app_sale_dispatch(const app_event_t *evt)
+{
+    // A charge pool result hands s_charge back to this task. Charges
+    // taken from the pool directly are only dispatched while it is idle.
+    if (evt->type == APP_EVENT_CHARGE_CREATED || evt->type == APP_EVENT_CHARGE_FAILED) {
+        s_charge_busy = false;
+    }
+
+    // Drop status changes of a payment that is no longer shown
+    if ((evt->type == APP_EVENT_PAYMENT_PENDING || evt->type == APP_EVENT_PAYMENT_APPROVED ||
+         evt->type == APP_EVENT_PAYMENT_REJECTED) &&
+        strcmp(evt->payment_id, s_payment_id) != 0) {
+        return;
+    }
+
+    app_state_t next = s_state;
+    app_action_t action = app_state_next(s_state, evt->type, &next);
+    if (action == APP_ACTION_NONE) {
+        ESP_LOGD(TAG, "Event %d ignored in %s", evt->type, app_state_name(s_state));
+        return;
+    }
+
+    if (next != s_state) {
+        ESP_LOGI(TAG, "%s -> %s", app_state_name(s_state), app_state_name(next));
+        s_state = next;
+        telemetry_set_state(app_state_name(s_state));
+    }
+    s_run_action(action, evt);
+}
+
+app_state_t app_sale_state(void)
+{
+    return s_state;
+}
+
+bool app_sale_start_charge(void)
+{
+    // The state is already CREATING, so a prepared charge goes through the
+    // table without the queue, where a full queue could lose it
+    if (!s_charge_busy && charge_pool_take(&s_charge)) {
+        app_event_t evt = { .type = APP_EVENT_CHARGE_CREATED };
+        strlcpy(evt.payment_id, s_charge.response.payment_id, sizeof(evt.payment_id));
+        app_sale_dispatch(&evt);
+        return true;
+    }
+
+    // Otherwise wait for the one in flight, if any
+    if (!s_charge_busy) {
+        s_charge_busy = true;
+        charge_pool_request(&s_charge);
+    }
+    return false;
+}
+
+const prepared_charge_t *app_sale_charge(void)
+{
+    return &s_charge;
+}
+
+void app_sale_watch_payment(void)
+{
+    strlcpy(s_payment_id, s_charge.response.payment_id, sizeof(s_payment_id));
+    payment_watch_start(s_payment_id);
+}
+
+void app_sale_store_charge(void)
+{
+    // Nobody is waiting for it any more; keep it for the next customer
+    charge_pool_put(&s_charge);
+}
+
+bool app_sale_end_payment(bool open)
+{
+    payment_watch_stop();
+
+    if (strlen(s_payment_id) == 0) {
+        return false;
+    }
+    if (open) {
+        reconciler_add(s_payment_id);
+    }
+    memset(s_payment_id, 0, sizeof(s_payment_id));
+    return true;
+}
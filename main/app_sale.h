@@ -0,0 +1,104 @@
+#ifndef APP_SALE_H
+#define APP_SALE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "app_state.h"
+#include "charge_pool.h"
+
+/**
+ * @brief Event posted to the application task
+ */
+typedef struct {
+    uint8_t type;               // app_event_type_t, or one of the caller's own past APP_EVENT_COUNT
+    esp_err_t err;              // APP_EVENT_CHARGE_FAILED reason
+    char payment_id[64];        // Payment the event belongs to, if any
+} app_event_t;
+
+/**
+ * @brief Event for a charge pool result
+ * @param err Result passed to the charge_pool_cb_t
+ * @param payment_id Payment ID passed to the charge_pool_cb_t
+ * @param evt Filled with CHARGE_CREATED or CHARGE_FAILED
+ */
+void app_sale_charge_event(esp_err_t err, const char *payment_id, app_event_t *evt);
+
+/**
+ * @brief Event for a status reported by the payment watcher
+ * @param payment_id Payment passed to the payment_watch_cb_t
+ * @param status Status passed to the payment_watch_cb_t
+ * @param evt Filled with the PAYMENT_* event
+ * @return false for a status the application does not act on
+ */
+bool app_sale_payment_event(const char *payment_id, payment_status_t status, app_event_t *evt);
+
+/**
+ * @brief Side effects of an action on the device (screen, LED, servo...)
+ *
+ * Runs on the application task, after the transition. The charge and
+ * payment bookkeeping of the sale is done by the app_sale_*() calls it makes.
+ *
+ * @param action Action of the transition
+ * @param evt Event that caused it
+ */
+typedef void (*app_sale_action_cb_t)(app_action_t action, const app_event_t *evt);
+
+/**
+ * @brief Set the handler of the actions; call before the first event
+ */
+void app_sale_init(app_sale_action_cb_t run_action);
+
+/**
+ * @brief Run an event through the state machine
+ *
+ * Releases the charge when the pool reports on it, drops status changes of
+ * a payment that is no longer shown, then runs the action of the
+ * transition, if any. Application task only; actions may call it again
+ * for an event that must not wait in the queue.
+ */
+void app_sale_dispatch(const app_event_t *evt);
+
+/**
+ * @brief Current state of the application
+ */
+app_state_t app_sale_state(void);
+
+/**
+ * @brief Get a charge for the sale that just started (APP_ACTION_START_CHARGE)
+ *
+ * A charge prepared in the background is dispatched as CHARGE_CREATED right
+ * away, so it is shown before this returns. Otherwise one is requested from
+ * the pool, unless a request is still in flight, and CHARGE_CREATED or
+ * CHARGE_FAILED arrives later through the queue.
+ *
+ * @return true if a prepared charge was shown
+ */
+bool app_sale_start_charge(void);
+
+/**
+ * @brief The charge of the sale; valid from APP_ACTION_SHOW_CHARGE on
+ */
+const prepared_charge_t *app_sale_charge(void);
+
+/**
+ * @brief Follow the payment of the charge now shown (APP_ACTION_SHOW_CHARGE)
+ */
+void app_sale_watch_payment(void);
+
+/**
+ * @brief Return a charge nobody waited for to the pool (APP_ACTION_STORE_CHARGE)
+ */
+void app_sale_store_charge(void);
+
+/**
+ * @brief Stop following the payment of the sale
+ *
+ * @param open The charge may still be paid (cancelled or expired); the
+ *             reconciler cancels it on the backend and looks out for a late
+ *             payment. False once the payment was approved or refused.
+ * @return true if a charge was shown
+ */
+bool app_sale_end_payment(bool open);
+
+#endif // APP_SALE_H
@@ -0,0 +1,60 @@
+#include <stddef.h>
+
+#include "app_state.h"
+
+typedef struct {
+    app_state_t state;
+    app_event_type_t event;
+    app_state_t next;
+    app_action_t action;
+} app_transition_t;
+
+// First match wins, so specific states go before APP_STATE_ANY.
+// A next state of APP_STATE_ANY keeps the current state.
+static const app_transition_t s_transitions[] = {
+    { APP_STATE_IDLE,             APP_EVENT_BUTTON_SHORT,     APP_STATE_CREATING,         APP_ACTION_START_CHARGE },
+    { APP_STATE_IDLE,             APP_EVENT_CHARGE_CREATED,   APP_STATE_ANY,              APP_ACTION_STORE_CHARGE },
+    { APP_STATE_IDLE,             APP_EVENT_SCREEN_TIMER,     APP_STATE_ANY,              APP_ACTION_NEXT_SCREEN },
+
+    { APP_STATE_CREATING,         APP_EVENT_CHARGE_CREATED,   APP_STATE_AWAITING_PAYMENT, APP_ACTION_SHOW_CHARGE },
+    { APP_STATE_CREATING,         APP_EVENT_CHARGE_FAILED,    APP_STATE_IDLE,             APP_ACTION_CHARGE_ERROR },
+    { APP_STATE_CREATING,         APP_EVENT_BUTTON_LONG,      APP_STATE_IDLE,             APP_ACTION_CANCEL },
+
+    { APP_STATE_AWAITING_PAYMENT, APP_EVENT_COUNTDOWN_TICK,   APP_STATE_ANY,              APP_ACTION_UPDATE_COUNTDOWN },
+    { APP_STATE_AWAITING_PAYMENT, APP_EVENT_PAYMENT_PENDING,  APP_STATE_ANY,              APP_ACTION_LOG_PENDING },
+    { APP_STATE_AWAITING_PAYMENT, APP_EVENT_PAYMENT_APPROVED, APP_STATE_DISPENSING,       APP_ACTION_DISPENSE },
+    { APP_STATE_AWAITING_PAYMENT, APP_EVENT_PAYMENT_REJECTED, APP_STATE_IDLE,             APP_ACTION_REJECTED },
+    { APP_STATE_AWAITING_PAYMENT, APP_EVENT_TIMEOUT,          APP_STATE_IDLE,             APP_ACTION_EXPIRE },
+    { APP_STATE_AWAITING_PAYMENT, APP_EVENT_BUTTON_LONG,      APP_STATE_IDLE,             APP_ACTION_CANCEL },
+
+    { APP_STATE_DISPENSING,       APP_EVENT_DISPENSE_DONE,    APP_STATE_IDLE,             APP_ACTION_DISPENSED },
+
+    { APP_STATE_ANY,              APP_EVENT_WIFI_UP,          APP_STATE_ANY,              APP_ACTION_WIFI_CHANGED },
+    { APP_STATE_ANY,              APP_EVENT_WIFI_DOWN,        APP_STATE_ANY,              APP_ACTION_WIFI_CHANGED },
+};
+
+app_action_t app_state_next(app_state_t state, app_event_type_t event, app_state_t *next)
+{
+    for (size_t i = 0; i < sizeof(s_transitions) / sizeof(s_transitions[0]); i++) {
+        const app_transition_t *t = &s_transitions[i];
+        if (t->event != event || (t->state != state && t->state != APP_STATE_ANY)) {
+            continue;
+        }
+        if (t->next != APP_STATE_ANY) {
+            *next = t->next;
+        }
+        return t->action;
+    }
+    return APP_ACTION_NONE;
+}
+
+const char *app_state_name(app_state_t state)
+{
+    switch (state) {
+        case APP_STATE_IDLE:             return "IDLE";
+        case APP_STATE_CREATING:         return "CREATING";
+        case APP_STATE_AWAITING_PAYMENT: return "AWAITING_PAYMENT";
+        case APP_STATE_DISPENSING:       return "DISPENSING";
+        default:                         return "?";
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef APP_STATE_H
+#define APP_STATE_H
+
+#include <stdbool.h>
+
+/**
+ * @brief Application states
+ */
+typedef enum {
+    APP_STATE_IDLE,             // Waiting for a customer
+    APP_STATE_CREATING,         // Charge requested from the backend
+    APP_STATE_AWAITING_PAYMENT, // QR code shown, waiting for the payment
+    APP_STATE_DISPENSING,       // Payment confirmed, servo releasing the product
+    APP_STATE_COUNT,
+    APP_STATE_ANY = APP_STATE_COUNT  // Wildcard, only valid in the table
+} app_state_t;
+
+/**
+ * @brief Events driving the application
+ */
+typedef enum {
+    APP_EVENT_BUTTON_SHORT,     // Button released after a short press
+    APP_EVENT_BUTTON_LONG,      // Button held for the cancel time
+    APP_EVENT_CHARGE_CREATED,
+    APP_EVENT_CHARGE_FAILED,
+    APP_EVENT_PAYMENT_PENDING,
+    APP_EVENT_PAYMENT_APPROVED,
+    APP_EVENT_PAYMENT_REJECTED,
+    APP_EVENT_COUNTDOWN_TICK,   // One second of the payment window passed
+    APP_EVENT_TIMEOUT,          // Payment window expired
+    APP_EVENT_DISPENSE_DONE,    // Servo motion finished
+    APP_EVENT_SCREEN_TIMER,     // Time to show the next post-sale screen
+    APP_EVENT_WIFI_UP,
+    APP_EVENT_WIFI_DOWN,
+    APP_EVENT_COUNT
+} app_event_type_t;
+
+/**
+ * @brief Side effect to run on a transition
+ */
+typedef enum {
+    APP_ACTION_NONE,
+    APP_ACTION_START_CHARGE,    // Take a prepared charge or request a new one
+    APP_ACTION_SHOW_CHARGE,     // Render the QR code and start the payment window
+    APP_ACTION_STORE_CHARGE,    // Return a charge nobody waited for to the pool
+    APP_ACTION_CHARGE_ERROR,    // Report a failed charge
+    APP_ACTION_CANCEL,          // Cancel the charge on user request
+    APP_ACTION_EXPIRE,          // Cancel the charge after the payment window
+    APP_ACTION_UPDATE_COUNTDOWN,
+    APP_ACTION_LOG_PENDING,
+    APP_ACTION_REJECTED,        // Payment refused by the bank
+    APP_ACTION_DISPENSE,        // Start releasing the product
+    APP_ACTION_DISPENSED,       // Product released, accept the next sale
+    APP_ACTION_NEXT_SCREEN,     // Advance the post-sale screens
+    APP_ACTION_WIFI_CHANGED,
+} app_action_t;
+
+/**
+ * @brief Look up the transition for an event
+ *
+ * Pure function over a static table, no side effects, so it can be
+ * exercised on the host.
+ *
+ * @param state Current state
+ * @param event Event received
+ * @param next Where to store the next state; unchanged if no transition
+ * @return Action to run, APP_ACTION_NONE if the event is ignored
+ */
+app_action_t app_state_next(app_state_t state, app_event_type_t event, app_state_t *next);
+
+/**
+ * @brief Get a printable name for a state
+ */
+const char *app_state_name(app_state_t state);
+
+#endif // APP_STATE_H
@@ -0,0 +1,52 @@
+#ifndef BRCODE_H
+#define BRCODE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#define BRCODE_MAX_KEY_LEN      77
+#define BRCODE_MAX_NAME_LEN     25
+#define BRCODE_MAX_CITY_LEN     15
+#define BRCODE_MAX_TXID_LEN     25
+
+/**
+ * @brief Fields of a PIX charge encoded on the device
+ */
+typedef struct {
+    const char *pix_key;        // Receiver's PIX key (e-mail, phone, CPF/CNPJ or random key)
+    const char *merchant_name;  // Printable ASCII, up to BRCODE_MAX_NAME_LEN
+    const char *merchant_city;  // Printable ASCII, up to BRCODE_MAX_CITY_LEN
+    uint32_t amount_cents;      // 0 leaves the amount to the payer
+    const char *txid;           // Letters and digits, up to BRCODE_MAX_TXID_LEN; NULL for none
+} brcode_params_t;
+
+/**
+ * @brief Build a static PIX "copia e cola" payload
+ *
+ * Assembles the EMV merchant-presented TLV fields of the BR Code and
+ * appends the CRC16 checksum. No allocation; the result can go straight
+ * to qrcode_generate().
+ *
+ * @param params Charge fields
+ * @param out Output buffer
+ * @param size Size of out, including the terminator
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if a field is missing, too long or
+ *         has characters the BR Code does not allow, ESP_ERR_INVALID_SIZE
+ *         if out is too small
+ */
+esp_err_t brcode_build(const brcode_params_t *params, char *out, size_t size);
+
+/**
+ * @brief CRC16-CCITT (polynomial 0x1021, initial value 0xFFFF)
+ *
+ * The checksum of the BR Code, computed over the payload up to and
+ * including the "6304" tag and length of the CRC field.
+ *
+ * @param data Data to check
+ * @param len Length of data
+ * @return CRC value
+ */
+uint16_t brcode_crc16(const void *data, size_t len);
+
+#endif // BRCODE_H
@@ -0,0 +1,34 @@
+#include <string.h>
+
+#include "buf_writer.h"
+
+void buf_writer_init(buf_writer_t *w, char *buf, size_t size)
+{
+    w->buf = buf;
+    w->size = size;
+    w->len = 0;
+    w->overflow = (size == 0);
+}
+
+void buf_writer_put(buf_writer_t *w, const char *s, size_t n)
+{
+    // Keep one byte for the terminator
+    if (w->overflow || w->len + n >= w->size) {
+        w->overflow = true;
+        return;
+    }
+    memcpy(w->buf + w->len, s, n);
+    w->len += n;
+}
+
+const char *buf_writer_finish(buf_writer_t *w, size_t *len)
+{
+    if (w->overflow) {
+        return NULL;
+    }
+    w->buf[w->len] = '\0';
+    if (len != NULL) {
+        *len = w->len;
+    }
+    return w->buf;
+}
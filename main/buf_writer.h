@@ -0,0 +1,42 @@
+#ifndef BUF_WRITER_H
+#define BUF_WRITER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Append-only writer into a caller-provided buffer
+ *
+ * Never allocates. A write that does not fit sets overflow and is dropped,
+ * along with every write after it; buf_writer_finish() then reports the
+ * failure. One byte is always kept for the terminator.
+ */
+typedef struct {
+    char *buf;
+    size_t size;
+    size_t len;
+    bool overflow;
+} buf_writer_t;
+
+/**
+ * @brief Start writing into buf
+ * @param w Writer
+ * @param buf Output buffer
+ * @param size Size of buf, including room for the terminator
+ */
+void buf_writer_init(buf_writer_t *w, char *buf, size_t size);
+
+/**
+ * @brief Append n bytes of s
+ */
+void buf_writer_put(buf_writer_t *w, const char *s, size_t n);
+
+/**
+ * @brief Terminate the output
+ * @param w Writer
+ * @param len Output length without the terminator, may be NULL
+ * @return The NUL-terminated text, or NULL if it did not fit
+ */
+const char *buf_writer_finish(buf_writer_t *w, size_t *len);
+
+#endif // BUF_WRITER_H
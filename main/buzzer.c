@@ -2,6 +2,7 @@
 #include "freertos/task.h"
 #include "driver/ledc.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 
 #include "buzzer.h"
 
@@ -13,8 +14,32 @@ static const char *TAG = "buzzer";
 #define LEDC_DUTY_RES       LEDC_TIMER_8_BIT
 #define LEDC_DUTY           (127)  // 50% duty cycle
 
+#define BEEP_GAP_MS         50
+
 static bool buzzer_initialized = false;
 
+// Background beep sequence
+static esp_timer_handle_t beep_timer = NULL;
+static int beep_remaining = 0;
+static int beep_duration = 0;
+static bool beep_on = false;
+
+static void beep_timer_cb(void *arg)
+{
+    if (beep_on) {
+        buzzer_no_tone();
+        beep_on = false;
+        if (--beep_remaining > 0) {
+            esp_timer_start_once(beep_timer, BEEP_GAP_MS * 1000);
+        }
+    } else {
+        ledc_set_duty(LEDC_MODE, LEDC_CHANNEL, LEDC_DUTY);
+        ledc_update_duty(LEDC_MODE, LEDC_CHANNEL);
+        beep_on = true;
+        esp_timer_start_once(beep_timer, beep_duration * 1000);
+    }
+}
+
 esp_err_t buzzer_init(void)
 {
     // Configure LEDC timer
@@ -39,6 +64,12 @@ esp_err_t buzzer_init(void)
     };
     ESP_ERROR_CHECK(ledc_channel_config(&ledc_channel));
 
+    const esp_timer_create_args_t timer_args = {
+        .callback = beep_timer_cb,
+        .name = "buzzer",
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &beep_timer));
+
     buzzer_initialized = true;
     ESP_LOGI(TAG, "Buzzer initialized on GPIO %d", CONFIG_ESP_PIX_BUZZER_GPIO);
 
@@ -75,9 +106,27 @@ void buzzer_no_tone(void)
 
 void buzzer_beep(int times, int duration, int frequency)
 {
+    if (beep_timer != NULL) {
+        esp_timer_stop(beep_timer);
+    }
+
     for (int i = 0; i < times; i++) {
         buzzer_tone(frequency, duration);
         buzzer_no_tone();
         vTaskDelay(pdMS_TO_TICKS(50));
     }
 }
+
+void buzzer_beep_async(int times, int duration, int frequency)
+{
+    if (!buzzer_initialized || times <= 0) {
+        return;
+    }
+
+    esp_timer_stop(beep_timer);
+    ledc_set_freq(LEDC_MODE, LEDC_TIMER, frequency);
+    beep_remaining = times;
+    beep_duration = duration;
+    beep_on = false;
+    beep_timer_cb(NULL);
+}
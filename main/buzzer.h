@@ -29,4 +29,15 @@ void buzzer_no_tone(void);
  */
 void buzzer_beep(int times, int duration, int frequency);
 
+/**
+ * @brief Beep n times without blocking
+ *
+ * The beeps are timed by an esp_timer. Replaces a sequence still playing.
+ *
+ * @param times Number of beeps
+ * @param duration Duration of each beep in ms
+ * @param frequency Frequency in Hz
+ */
+void buzzer_beep_async(int times, int duration, int frequency);
+
 #endif // BUZZER_H
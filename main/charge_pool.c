@@ -0,0 +1,410 @@
+#include <string.h>
+#include <inttypes.h>
+#include <math.h>
+#include <sys/param.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_random.h"
+
+#include "charge_pool.h"
+#include "net_worker.h"
+#include "brcode.h"
+#include "reconciler.h"
+#include "wifi_manager.h"
+#include "metrics.h"
+#include "trace.h"
+
+static const char *TAG = "charge_pool";
+
+#define POOL_TASK_STACK     8192
+#define POOL_TASK_PRIO      5
+
+// Wait before the next background attempt while offline or after a failure
+#define POOL_RETRY_MS       10000
+
+// A waiting customer gets an error after this long
+#define REQUEST_DEADLINE_MS 15000
+
+#if CONFIG_ESP_PIX_CHARGE_PREFETCH
+#define POOL_TARGET         CONFIG_ESP_PIX_CHARGE_POOL_SIZE
+#else
+#define POOL_TARGET         0
+#endif
+// There is always room for a charge given back with charge_pool_put()
+#define POOL_SLOTS          MAX(POOL_TARGET, 1)
+
+#define MAX_AGE_MS          (CONFIG_ESP_PIX_CHARGE_MAX_AGE_S * 1000LL)
+// Pooled charges are replaced at this age, so the replacement is ready
+// before the old one stops being offered
+#define REFRESH_AGE_MS      (MAX_AGE_MS * 7 / 8)
+
+static TaskHandle_t s_task = NULL;
+static SemaphoreHandle_t s_lock = NULL;
+static charge_pool_cb_t s_callback = NULL;
+static float s_amount = 0;
+static const char *s_description = NULL;
+
+// Slots point into s_entries. The spare entry belongs to the pool task,
+// which builds the next charge there and swaps it into a slot when done,
+// so a charge being refreshed stays available until its replacement is.
+// An entry with an empty payment_id holds no charge.
+static prepared_charge_t s_entries[POOL_SLOTS + 1];
+static prepared_charge_t *s_slots[POOL_SLOTS];
+static prepared_charge_t *s_spare = NULL;
+static prepared_charge_t *s_request = NULL;    // Pending charge_pool_request()
+
+static int64_t now_ms(void)
+{
+    return esp_timer_get_time() / 1000;
+}
+
+static bool holds_charge(const prepared_charge_t *c)
+{
+    return c->response.payment_id[0] != '\0';
+}
+
+/**
+ * @brief Drop a charge that will not be shown
+ *
+ * Called with s_lock held. A backend charge is still open there and goes
+ * to the reconciler to be cancelled; one built on the device was never
+ * seen by anyone and just expires.
+ */
+static void discard(const prepared_charge_t *c)
+{
+    ESP_LOGI(TAG, "Discarding charge %s (%" PRId64 " s old)",
+             c->response.payment_id, (now_ms() - c->created_ms) / 1000);
+    metrics_inc(METRIC_CHARGES_DISCARDED);
+    if (!c->local) {
+        reconciler_add(c->response.payment_id);
+    }
+}
+
+static bool encode_qrcode(prepared_charge_t *c)
+{
+    uint32_t trace = trace_begin(TRACE_QR_GENERATE);
+    int64_t start = esp_timer_get_time();
+    bool ok = qrcode_generate(&c->qrcode, c->response.qr_code);
+    metrics_observe(METRIC_HIST_QR_GENERATE, esp_timer_get_time() - start);
+    trace_end(TRACE_QR_GENERATE, trace);
+    return ok;
+}
+
+#if !CONFIG_ESP_PIX_CHARGE_SOURCE_BACKEND
+/**
+ * @brief Build the charge on the device, without the backend
+ *
+ * A random txid doubles as the payment ID, so the payment is followed
+ * with the same status requests as a backend charge.
+ */
+static esp_err_t build_local_charge(payment_response_t *r)
+{
+    static const char alphabet[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    char txid[BRCODE_MAX_TXID_LEN + 1];
+
+    for (int i = 0; i < BRCODE_MAX_TXID_LEN; i++) {
+        txid[i] = alphabet[esp_random() % (sizeof(alphabet) - 1)];
+    }
+    txid[BRCODE_MAX_TXID_LEN] = '\0';
+
+    uint32_t cents = (uint32_t)lroundf(s_amount * 100);
+    brcode_params_t params = {
+        .pix_key = CONFIG_ESP_PIX_PIX_KEY,
+        .merchant_name = CONFIG_ESP_PIX_MERCHANT_NAME,
+        .merchant_city = CONFIG_ESP_PIX_MERCHANT_CITY,
+        .amount_cents = cents,
+        .txid = txid,
+    };
+    esp_err_t err = brcode_build(&params, r->qr_code, sizeof(r->qr_code));
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Invalid PIX key or merchant settings (%s)", esp_err_to_name(err));
+        return err;
+    }
+
+    // Same units as the backend reports
+    strlcpy(r->payment_id, txid, sizeof(r->payment_id));
+    r->amount = cents;
+    r->success = true;
+    return ESP_OK;
+}
+#endif
+
+static esp_err_t make_charge(payment_response_t *r, bool waiting, bool *local)
+{
+#if CONFIG_ESP_PIX_CHARGE_SOURCE_LOCAL
+    *local = true;
+    return build_local_charge(r);
+#else
+    *local = false;
+    // Refills yield to requests a customer is waiting for
+    esp_err_t err = net_create_charge_wait(s_amount, s_description, r,
+                                           waiting ? NET_PRIO_INTERACTIVE : NET_PRIO_BACKGROUND,
+                                           waiting ? REQUEST_DEADLINE_MS : 0);
+#if CONFIG_ESP_PIX_CHARGE_SOURCE_FALLBACK
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Backend failed, building the charge locally");
+        *local = true;
+        err = build_local_charge(r);
+    }
+#endif
+    return err;
+#endif
+}
+
+/**
+ * @brief Create a charge and encode its QR code
+ * @param c Where to build it
+ * @param waiting A customer is waiting for it
+ */
+static esp_err_t create_charge(prepared_charge_t *c, bool waiting)
+{
+    esp_err_t err;
+
+    c->response.payment_id[0] = '\0';
+    // Even codes built here need the link for the payment to be confirmed
+    if (!wifi_manager_is_connected()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    uint32_t trace = trace_begin(TRACE_CHARGE_REQUEST);
+    bool local;
+    err = make_charge(&c->response, waiting, &local);
+    trace_end(TRACE_CHARGE_REQUEST, trace);
+
+    if (err != ESP_OK) {
+        // Passed on as is: a cut payload must not read as a failed request
+        ESP_LOGE(TAG, "Failed to create charge: %s", esp_err_to_name(err));
+    } else if (!encode_qrcode(c)) {
+        ESP_LOGE(TAG, "QR code payload too long");
+        metrics_inc(METRIC_QR_ERRORS);
+        err = ESP_ERR_INVALID_SIZE;
+    } else {
+        c->created_ms = now_ms();
+        c->local = local;
+        metrics_inc(local ? METRIC_CHARGES_BUILT : METRIC_CHARGES_CREATED);
+        return ESP_OK;
+    }
+
+    c->response.payment_id[0] = '\0';
+    return err;
+}
+
+/**
+ * @brief Pick the slot the pool task should fill next
+ *
+ * Also discards charges past the max age in slots that are not refreshed.
+ *
+ * @param now Current time in ms
+ * @param wake_at Lowered to the time the next slot needs work
+ * @return Slot to fill or refresh now, -1 if none
+ */
+static int next_slot(int64_t now, int64_t *wake_at)
+{
+    int slot = -1;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (int i = 0; i < POOL_SLOTS && slot < 0; i++) {
+        prepared_charge_t *c = s_slots[i];
+        bool pooled = i < POOL_TARGET;
+
+        if (!holds_charge(c)) {
+            if (pooled) {
+                slot = i;
+            }
+            continue;
+        }
+
+        int64_t due = c->created_ms + (pooled ? REFRESH_AGE_MS : MAX_AGE_MS);
+        if (now < due) {
+            *wake_at = MIN(*wake_at, due);
+        } else if (pooled) {
+            slot = i;
+        } else {
+            discard(c);
+            c->response.payment_id[0] = '\0';
+        }
+    }
+    xSemaphoreGive(s_lock);
+
+    return slot;
+}
+
+static esp_err_t fill_slot(int slot)
+{
+    esp_err_t err = create_charge(s_spare, false);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    prepared_charge_t *old = s_slots[slot];
+    s_slots[slot] = s_spare;
+    s_spare = old;
+    if (holds_charge(old)) {
+        discard(old);
+    }
+    xSemaphoreGive(s_lock);
+
+    return ESP_OK;
+}
+
+static void serve_request(prepared_charge_t *out)
+{
+    esp_err_t err = ESP_OK;
+
+    if (!charge_pool_take(out)) {
+        err = create_charge(out, true);
+    }
+    s_callback(err, err == ESP_OK ? out->response.payment_id : "");
+}
+
+static void pool_task(void *arg)
+{
+    int64_t retry_at = 0;
+
+    while (1) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        prepared_charge_t *out = s_request;
+        s_request = NULL;
+        xSemaphoreGive(s_lock);
+
+        // A waiting customer goes before the background work
+        if (out != NULL) {
+            serve_request(out);
+            continue;
+        }
+
+        int64_t now = now_ms();
+        int64_t wake_at = INT64_MAX;
+        int slot = next_slot(now, &wake_at);
+
+        if (slot >= 0 && now >= retry_at) {
+            if (fill_slot(slot) != ESP_OK) {
+                retry_at = now_ms() + POOL_RETRY_MS;
+            }
+            continue;
+        }
+        if (slot >= 0) {
+            wake_at = retry_at;
+        }
+
+        TickType_t wait = portMAX_DELAY;
+        if (wake_at != INT64_MAX) {
+            wait = pdMS_TO_TICKS(MIN(MAX(wake_at - now, 0), MAX_AGE_MS));
+        }
+        ulTaskNotifyTake(pdTRUE, wait);
+    }
+}
+
+esp_err_t charge_pool_init(float amount, const char *description, charge_pool_cb_t callback)
+{
+    if (s_task != NULL) {
+        return ESP_OK;
+    }
+
+    s_amount = amount;
+    s_description = description;
+    s_callback = callback;
+    for (int i = 0; i < POOL_SLOTS; i++) {
+        s_slots[i] = &s_entries[i];
+    }
+    s_spare = &s_entries[POOL_SLOTS];
+
+    s_lock = xSemaphoreCreateMutex();
+    if (s_lock == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (xTaskCreate(pool_task, "charge", POOL_TASK_STACK, NULL,
+                    POOL_TASK_PRIO, &s_task) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+bool charge_pool_take(prepared_charge_t *out)
+{
+    int64_t now = now_ms();
+    int best = -1;
+
+    // Oldest first, so the younger charges are still there for later
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (int i = 0; i < POOL_SLOTS; i++) {
+        const prepared_charge_t *c = s_slots[i];
+        if (holds_charge(c) && now - c->created_ms < MAX_AGE_MS &&
+            (best < 0 || c->created_ms < s_slots[best]->created_ms)) {
+            best = i;
+        }
+    }
+    if (best >= 0) {
+        *out = *s_slots[best];
+        s_slots[best]->response.payment_id[0] = '\0';
+    }
+    xSemaphoreGive(s_lock);
+
+    if (best < 0) {
+        return false;
+    }
+    xTaskNotifyGive(s_task);
+    return true;
+}
+
+void charge_pool_request(prepared_charge_t *out)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    s_request = out;
+    xSemaphoreGive(s_lock);
+
+    xTaskNotifyGive(s_task);
+}
+
+void charge_pool_put(const prepared_charge_t *charge)
+{
+    int slot = 0;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    // First empty slot, else the one with the oldest charge
+    for (int i = 0; i < POOL_SLOTS; i++) {
+        if (!holds_charge(s_slots[i])) {
+            slot = i;
+            break;
+        }
+        if (s_slots[i]->created_ms < s_slots[slot]->created_ms) {
+            slot = i;
+        }
+    }
+
+    prepared_charge_t *c = s_slots[slot];
+    if (holds_charge(c) && c->created_ms >= charge->created_ms) {
+        // The charge given back is the oldest one
+        discard(charge);
+    } else {
+        if (holds_charge(c)) {
+            discard(c);
+        }
+        *c = *charge;
+    }
+    xSemaphoreGive(s_lock);
+
+    // Reschedule the refresh of the slots
+    xTaskNotifyGive(s_task);
+}
+
+int charge_pool_count(void)
+{
+    int64_t now = now_ms();
+    int count = 0;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (int i = 0; i < POOL_SLOTS; i++) {
+        if (holds_charge(s_slots[i]) && now - s_slots[i]->created_ms < MAX_AGE_MS) {
+            count++;
+        }
+    }
+    xSemaphoreGive(s_lock);
+
+    return count;
+}
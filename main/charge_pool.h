@@ -0,0 +1,83 @@
+#ifndef CHARGE_POOL_H
+#define CHARGE_POOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "http_client.h"
+#include "qrcode_gen.h"
+
+/**
+ * @brief Charge created on the backend with its QR code already encoded
+ */
+typedef struct {
+    payment_response_t response;
+    qrcode_t qrcode;
+    int64_t created_ms;         // esp_timer time of creation, in ms
+    bool local;                 // BR Code built on the device, unknown to the backend
+} prepared_charge_t;
+
+/**
+ * @brief Callback for the result of charge_pool_request()
+ *
+ * Runs on the pool task; must not block.
+ *
+ * @param err ESP_OK, ESP_ERR_INVALID_STATE without WiFi, ESP_ERR_INVALID_SIZE
+ *            if the QR code or the backend's response did not fit, another
+ *            error (ESP_FAIL, ESP_ERR_TIMEOUT...) if the request failed
+ * @param payment_id Payment ID of the charge, empty on error
+ */
+typedef void (*charge_pool_cb_t)(esp_err_t err, const char *payment_id);
+
+/**
+ * @brief Start the charge pool task
+ *
+ * With CONFIG_ESP_PIX_CHARGE_PREFETCH the task keeps
+ * CONFIG_ESP_PIX_CHARGE_POOL_SIZE charges ready in the background and
+ * replaces each one before it reaches CONFIG_ESP_PIX_CHARGE_MAX_AGE_S.
+ * Without it, charges are only created on request.
+ *
+ * @param amount Amount of every charge, in BRL
+ * @param description Description of every charge; must stay valid
+ * @param callback Called with the result of each charge_pool_request()
+ * @return ESP_OK on success
+ */
+esp_err_t charge_pool_init(float amount, const char *description, charge_pool_cb_t callback);
+
+/**
+ * @brief Take a ready charge without waiting
+ *
+ * The pool starts preparing a replacement right away.
+ *
+ * @param out Where to copy the charge
+ * @return true if a charge younger than the max age was available
+ */
+bool charge_pool_take(prepared_charge_t *out);
+
+/**
+ * @brief Get a charge for a customer that is waiting
+ *
+ * Takes a ready charge, or creates one as soon as the charge in progress,
+ * if any, is done. The result is written to out and then reported to the
+ * callback; out belongs to the pool task until then.
+ *
+ * @param out Where to store the charge
+ */
+void charge_pool_request(prepared_charge_t *out);
+
+/**
+ * @brief Give back a charge that was not shown
+ *
+ * Keeps it for the next customer while it is young enough. If the pool is
+ * full, the older of the two charges is discarded.
+ *
+ * @param charge Charge to return
+ */
+void charge_pool_put(const prepared_charge_t *charge);
+
+/**
+ * @brief Number of ready charges
+ */
+int charge_pool_count(void);
+
+#endif // CHARGE_POOL_H
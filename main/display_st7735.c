@@ -1,12 +1,16 @@
 #include <string.h>
 #include <stdio.h>
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
-#include "driver/spi_master.h"
-#include "driver/gpio.h"
+#include <inttypes.h>
+#include <sys/param.h>
+#include "sdkconfig.h"
+#include "esp_heap_caps.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 
 #include "display_st7735.h"
+#include "lcd_bus.h"
+#include "fonts/font_5x7_latin1.h"
+#include "metrics.h"
 
 static const char *TAG = "display_st7735";
 
@@ -41,283 +45,295 @@ static const char *TAG = "display_st7735";
 #define ST7735_WIDTH  128
 #define ST7735_HEIGHT 160
 
-static spi_device_handle_t spi_handle;
 static int16_t cursor_x = 0;
 static int16_t cursor_y = 0;
 static uint16_t text_color = ST7735_WHITE;
+static uint16_t text_bg_color = ST7735_BLACK;
+static bool text_opaque = false;
 static uint8_t text_size = 1;
 
-// Basic 5x7 font
-static const uint8_t font5x7[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, // (space)
-    0x00, 0x00, 0x5F, 0x00, 0x00, // !
-    0x00, 0x07, 0x00, 0x07, 0x00, // "
-    0x14, 0x7F, 0x14, 0x7F, 0x14, // #
-    0x24, 0x2A, 0x7F, 0x2A, 0x12, // $
-    0x23, 0x13, 0x08, 0x64, 0x62, // %
-    0x36, 0x49, 0x55, 0x22, 0x50, // &
-    0x00, 0x05, 0x03, 0x00, 0x00, // '
-    0x00, 0x1C, 0x22, 0x41, 0x00, // (
-    0x00, 0x41, 0x22, 0x1C, 0x00, // )
-    0x08, 0x2A, 0x1C, 0x2A, 0x08, // *
-    0x08, 0x08, 0x3E, 0x08, 0x08, // +
-    0x00, 0x50, 0x30, 0x00, 0x00, // ,
-    0x08, 0x08, 0x08, 0x08, 0x08, // -
-    0x00, 0x60, 0x60, 0x00, 0x00, // .
-    0x20, 0x10, 0x08, 0x04, 0x02, // /
-    0x3E, 0x51, 0x49, 0x45, 0x3E, // 0
-    0x00, 0x42, 0x7F, 0x40, 0x00, // 1
-    0x42, 0x61, 0x51, 0x49, 0x46, // 2
-    0x21, 0x41, 0x45, 0x4B, 0x31, // 3
-    0x18, 0x14, 0x12, 0x7F, 0x10, // 4
-    0x27, 0x45, 0x45, 0x45, 0x39, // 5
-    0x3C, 0x4A, 0x49, 0x49, 0x30, // 6
-    0x01, 0x71, 0x09, 0x05, 0x03, // 7
-    0x36, 0x49, 0x49, 0x49, 0x36, // 8
-    0x06, 0x49, 0x49, 0x29, 0x1E, // 9
-    0x00, 0x36, 0x36, 0x00, 0x00, // :
-    0x00, 0x56, 0x36, 0x00, 0x00, // ;
-    0x00, 0x08, 0x14, 0x22, 0x41, // <
-    0x14, 0x14, 0x14, 0x14, 0x14, // =
-    0x41, 0x22, 0x14, 0x08, 0x00, // >
-    0x02, 0x01, 0x51, 0x09, 0x06, // ?
-    0x32, 0x49, 0x79, 0x41, 0x3E, // @
-    0x7E, 0x11, 0x11, 0x11, 0x7E, // A
-    0x7F, 0x49, 0x49, 0x49, 0x36, // B
-    0x3E, 0x41, 0x41, 0x41, 0x22, // C
-    0x7F, 0x41, 0x41, 0x22, 0x1C, // D
-    0x7F, 0x49, 0x49, 0x49, 0x41, // E
-    0x7F, 0x09, 0x09, 0x01, 0x01, // F
-    0x3E, 0x41, 0x41, 0x51, 0x32, // G
-    0x7F, 0x08, 0x08, 0x08, 0x7F, // H
-    0x00, 0x41, 0x7F, 0x41, 0x00, // I
-    0x20, 0x40, 0x41, 0x3F, 0x01, // J
-    0x7F, 0x08, 0x14, 0x22, 0x41, // K
-    0x7F, 0x40, 0x40, 0x40, 0x40, // L
-    0x7F, 0x02, 0x04, 0x02, 0x7F, // M
-    0x7F, 0x04, 0x08, 0x10, 0x7F, // N
-    0x3E, 0x41, 0x41, 0x41, 0x3E, // O
-    0x7F, 0x09, 0x09, 0x09, 0x06, // P
-    0x3E, 0x41, 0x51, 0x21, 0x5E, // Q
-    0x7F, 0x09, 0x19, 0x29, 0x46, // R
-    0x46, 0x49, 0x49, 0x49, 0x31, // S
-    0x01, 0x01, 0x7F, 0x01, 0x01, // T
-    0x3F, 0x40, 0x40, 0x40, 0x3F, // U
-    0x1F, 0x20, 0x40, 0x20, 0x1F, // V
-    0x7F, 0x20, 0x18, 0x20, 0x7F, // W
-    0x63, 0x14, 0x08, 0x14, 0x63, // X
-    0x03, 0x04, 0x78, 0x04, 0x03, // Y
-    0x61, 0x51, 0x49, 0x45, 0x43, // Z
-    0x00, 0x00, 0x7F, 0x41, 0x41, // [
-    0x02, 0x04, 0x08, 0x10, 0x20, // backslash
-    0x41, 0x41, 0x7F, 0x00, 0x00, // ]
-    0x04, 0x02, 0x01, 0x02, 0x04, // ^
-    0x40, 0x40, 0x40, 0x40, 0x40, // _
-    0x00, 0x01, 0x02, 0x04, 0x00, // `
-    0x20, 0x54, 0x54, 0x54, 0x78, // a
-    0x7F, 0x48, 0x44, 0x44, 0x38, // b
-    0x38, 0x44, 0x44, 0x44, 0x20, // c
-    0x38, 0x44, 0x44, 0x48, 0x7F, // d
-    0x38, 0x54, 0x54, 0x54, 0x18, // e
-    0x08, 0x7E, 0x09, 0x01, 0x02, // f
-    0x08, 0x14, 0x54, 0x54, 0x3C, // g
-    0x7F, 0x08, 0x04, 0x04, 0x78, // h
-    0x00, 0x44, 0x7D, 0x40, 0x00, // i
-    0x20, 0x40, 0x44, 0x3D, 0x00, // j
-    0x00, 0x7F, 0x10, 0x28, 0x44, // k
-    0x00, 0x41, 0x7F, 0x40, 0x00, // l
-    0x7C, 0x04, 0x18, 0x04, 0x78, // m
-    0x7C, 0x08, 0x04, 0x04, 0x78, // n
-    0x38, 0x44, 0x44, 0x44, 0x38, // o
-    0x7C, 0x14, 0x14, 0x14, 0x08, // p
-    0x08, 0x14, 0x14, 0x18, 0x7C, // q
-    0x7C, 0x08, 0x04, 0x04, 0x08, // r
-    0x48, 0x54, 0x54, 0x54, 0x20, // s
-    0x04, 0x3F, 0x44, 0x40, 0x20, // t
-    0x3C, 0x40, 0x40, 0x20, 0x7C, // u
-    0x1C, 0x20, 0x40, 0x20, 0x1C, // v
-    0x3C, 0x40, 0x30, 0x40, 0x3C, // w
-    0x44, 0x28, 0x10, 0x28, 0x44, // x
-    0x0C, 0x50, 0x50, 0x50, 0x3C, // y
-    0x44, 0x64, 0x54, 0x4C, 0x44, // z
-};
-
-static void spi_write_cmd(uint8_t cmd)
-{
-    gpio_set_level(CONFIG_ESP_PIX_TFT_DC_GPIO, 0);
-    spi_transaction_t t = {
-        .length = 8,
-        .tx_buffer = &cmd,
-    };
-    spi_device_polling_transmit(spi_handle, &t);
-}
-
-static void spi_write_data(const uint8_t *data, size_t len)
-{
-    if (len == 0) return;
-    gpio_set_level(CONFIG_ESP_PIX_TFT_DC_GPIO, 1);
-    spi_transaction_t t = {
-        .length = len * 8,
-        .tx_buffer = data,
-    };
-    spi_device_polling_transmit(spi_handle, &t);
-}
-
-static void spi_write_data_byte(uint8_t data)
-{
-    spi_write_data(&data, 1);
+// Font used by display_print() and labels
+static const font_atlas_t *s_font = &FONT_5X7_LATIN1;
+
+// Rasterized glyphs are cached per code point, size, cell width and color
+// pair when the scaled cell fits a slot; larger ones are rasterized on each
+// use into the scratch cell, and cells too big for that are drawn dot by dot
+#define GLYPH_CACHE_SLOTS 32
+#define GLYPH_CACHE_PIXELS (12 * 16)    // 6x8 cell at size 2
+#define GLYPH_SCRATCH_PIXELS (24 * 32)  // 6x8 cell at size 4
+
+typedef struct {
+    uint16_t fg;
+    uint16_t bg;
+    uint16_t cp;
+    uint8_t size;   // 0 = empty slot
+    uint8_t w;      // Cell width before scaling
+    uint16_t pixels[GLYPH_CACHE_PIXELS];
+} glyph_cache_entry_t;
+
+static glyph_cache_entry_t s_glyph_cache[GLYPH_CACHE_SLOTS];
+static uint16_t s_glyph_scratch[GLYPH_SCRATCH_PIXELS];
+
+// Longest run of characters display_print() draws at once
+#define PRINT_RUN_MAX 64
+
+#if CONFIG_ESP_PIX_DISPLAY_FRAMEBUFFER
+// Maximum number of dirty regions tracked between flushes
+#define DIRTY_RECT_MAX 8
+
+typedef struct {
+    int16_t x0, y0, x1, y1;  // Inclusive bounds
+} dirty_rect_t;
+
+// Framebuffer in panel byte order (big-endian RGB565), row-major
+static uint16_t *s_fb = NULL;
+static bool s_fb_dma_capable = false;
+static uint32_t s_fb_seq = 0;  // Last transaction reading from the framebuffer
+static dirty_rect_t s_dirty[DIRTY_RECT_MAX];
+static int s_dirty_count = 0;
+#endif
+
+static void write_data_byte(uint8_t data)
+{
+    lcd_bus_write_data(&data, 1);
 }
 
 static void set_addr_window(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
 {
+    // Window payloads fit in tx_data, so the whole sequence is queued
+    // without waiting for the bus
     uint8_t data[4];
     
-    spi_write_cmd(ST7735_CASET);
+    lcd_bus_write_cmd(ST7735_CASET);
     data[0] = 0;
     data[1] = x0;
     data[2] = 0;
     data[3] = x1;
-    spi_write_data(data, 4);
+    lcd_bus_write_data(data, 4);
     
-    spi_write_cmd(ST7735_RASET);
+    lcd_bus_write_cmd(ST7735_RASET);
     data[0] = 0;
     data[1] = y0;
     data[2] = 0;
     data[3] = y1;
-    spi_write_data(data, 4);
+    lcd_bus_write_data(data, 4);
     
-    spi_write_cmd(ST7735_RAMWR);
+    lcd_bus_write_cmd(ST7735_RAMWR);
+}
+
+// Clip a rectangle to the screen, returns false if nothing is left
+static bool clip_rect(int16_t *x, int16_t *y, int16_t *w, int16_t *h)
+{
+    if (*x < 0) { *w += *x; *x = 0; }
+    if (*y < 0) { *h += *y; *y = 0; }
+    if (*x >= ST7735_WIDTH || *y >= ST7735_HEIGHT) return false;
+    if (*x + *w > ST7735_WIDTH) *w = ST7735_WIDTH - *x;
+    if (*y + *h > ST7735_HEIGHT) *h = ST7735_HEIGHT - *y;
+    return *w > 0 && *h > 0;
+}
+
+static inline uint16_t to_panel_order(uint16_t color)
+{
+    return (color >> 8) | (color << 8);
+}
+
+// Fill a clipped rectangle directly on the panel
+static void panel_fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    set_addr_window(x, y, x + w - 1, y + h - 1);
+
+    // Every strip of a solid fill has the same content, so one line buffer
+    // is filled once and queued repeatedly
+    int rows_per_strip = MIN(h, LCD_BUS_LINE_BUF_PIXELS / w);
+    size_t pixels = (size_t)rows_per_strip * w;
+    uint16_t c = to_panel_order(color);
+    uint16_t *buf = lcd_bus_next_line_buf();
+    for (size_t i = 0; i < pixels; i++) {
+        buf[i] = c;
+    }
+
+    for (int row = 0; row < h; row += rows_per_strip) {
+        int rows = MIN(rows_per_strip, h - row);
+        lcd_bus_send_line_buf(buf, (size_t)rows * w);
+    }
+}
+
+#if CONFIG_ESP_PIX_DISPLAY_FRAMEBUFFER
+
+static inline int32_t rect_area(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    return (int32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+}
+
+// Add a region to the dirty list, merging touching regions. When the list
+// is full the region is merged into the entry whose bounding box grows least.
+static void mark_dirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    for (;;) {
+        int hit = -1;
+        for (int i = 0; i < s_dirty_count; i++) {
+            const dirty_rect_t *r = &s_dirty[i];
+            if (x0 <= r->x1 + 1 && r->x0 <= x1 + 1 &&
+                y0 <= r->y1 + 1 && r->y0 <= y1 + 1) {
+                hit = i;
+                break;
+            }
+        }
+
+        if (hit < 0 && s_dirty_count == DIRTY_RECT_MAX) {
+            int32_t best_cost = INT32_MAX;
+            for (int i = 0; i < s_dirty_count; i++) {
+                const dirty_rect_t *r = &s_dirty[i];
+                int32_t cost = rect_area(MIN(x0, r->x0), MIN(y0, r->y0),
+                                         MAX(x1, r->x1), MAX(y1, r->y1))
+                               - rect_area(r->x0, r->y0, r->x1, r->y1);
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    hit = i;
+                }
+            }
+        }
+
+        if (hit < 0) break;
+
+        // Absorb the entry and retry, the grown region may touch others
+        const dirty_rect_t *r = &s_dirty[hit];
+        x0 = MIN(x0, r->x0);
+        y0 = MIN(y0, r->y0);
+        x1 = MAX(x1, r->x1);
+        y1 = MAX(y1, r->y1);
+        s_dirty[hit] = s_dirty[--s_dirty_count];
+    }
+
+    s_dirty[s_dirty_count++] = (dirty_rect_t){ x0, y0, x1, y1 };
 }
 
+static void framebuffer_init(void)
+{
+    size_t fb_size = ST7735_WIDTH * ST7735_HEIGHT * sizeof(uint16_t);
+
+#if CONFIG_ESP_PIX_DISPLAY_FRAMEBUFFER_PSRAM
+    s_fb = heap_caps_malloc(fb_size, MALLOC_CAP_SPIRAM);
+#endif
+    if (s_fb == NULL) {
+        s_fb = heap_caps_malloc(fb_size, MALLOC_CAP_DMA);
+        s_fb_dma_capable = (s_fb != NULL);
+    }
+
+    if (s_fb == NULL) {
+        ESP_LOGW(TAG, "No memory for framebuffer, drawing directly to panel");
+        return;
+    }
+
+    ESP_LOGI(TAG, "Framebuffer allocated in %s", s_fb_dma_capable ? "internal RAM" : "PSRAM");
+}
+#endif
+
 esp_err_t display_init(void)
 {
-    // Configure GPIO for DC and RST
-    gpio_config_t io_conf = {
-        .pin_bit_mask = (1ULL << CONFIG_ESP_PIX_TFT_DC_GPIO) | (1ULL << CONFIG_ESP_PIX_TFT_RST_GPIO),
-        .mode = GPIO_MODE_OUTPUT,
-        .pull_up_en = GPIO_PULLUP_DISABLE,
-        .pull_down_en = GPIO_PULLDOWN_DISABLE,
-        .intr_type = GPIO_INTR_DISABLE,
-    };
-    gpio_config(&io_conf);
-
-    // Configure SPI bus
-    spi_bus_config_t buscfg = {
-        .mosi_io_num = CONFIG_ESP_PIX_TFT_MOSI_GPIO,
-        .miso_io_num = -1,
-        .sclk_io_num = CONFIG_ESP_PIX_TFT_SCK_GPIO,
-        .quadwp_io_num = -1,
-        .quadhd_io_num = -1,
-        .max_transfer_sz = ST7735_WIDTH * ST7735_HEIGHT * 2 + 8,
-    };
-    ESP_ERROR_CHECK(spi_bus_initialize(SPI2_HOST, &buscfg, SPI_DMA_CH_AUTO));
-
-    // Configure SPI device
-    spi_device_interface_config_t devcfg = {
-        .clock_speed_hz = 10 * 1000 * 1000,
-        .mode = 0,
-        .spics_io_num = CONFIG_ESP_PIX_TFT_CS_GPIO,
-        .queue_size = 7,
-    };
-    ESP_ERROR_CHECK(spi_bus_add_device(SPI2_HOST, &devcfg, &spi_handle));
-
-    // Hardware reset
-    gpio_set_level(CONFIG_ESP_PIX_TFT_RST_GPIO, 1);
-    vTaskDelay(pdMS_TO_TICKS(10));
-    gpio_set_level(CONFIG_ESP_PIX_TFT_RST_GPIO, 0);
-    vTaskDelay(pdMS_TO_TICKS(10));
-    gpio_set_level(CONFIG_ESP_PIX_TFT_RST_GPIO, 1);
-    vTaskDelay(pdMS_TO_TICKS(120));
+    esp_err_t err = lcd_bus_init(ST7735_WIDTH * ST7735_HEIGHT * 2 + 8);
+    if (err != ESP_OK) {
+        return err;
+    }
 
     // Software reset
-    spi_write_cmd(ST7735_SWRESET);
-    vTaskDelay(pdMS_TO_TICKS(150));
+    lcd_bus_write_cmd(ST7735_SWRESET);
+    lcd_bus_wait_idle();
+    lcd_bus_delay_ms(150);
 
     // Exit sleep mode
-    spi_write_cmd(ST7735_SLPOUT);
-    vTaskDelay(pdMS_TO_TICKS(500));
+    lcd_bus_write_cmd(ST7735_SLPOUT);
+    lcd_bus_wait_idle();
+    lcd_bus_delay_ms(500);
 
     // Frame rate control
-    spi_write_cmd(ST7735_FRMCTR1);
-    spi_write_data_byte(0x01);
-    spi_write_data_byte(0x2C);
-    spi_write_data_byte(0x2D);
-
-    spi_write_cmd(ST7735_FRMCTR2);
-    spi_write_data_byte(0x01);
-    spi_write_data_byte(0x2C);
-    spi_write_data_byte(0x2D);
-
-    spi_write_cmd(ST7735_FRMCTR3);
-    spi_write_data_byte(0x01);
-    spi_write_data_byte(0x2C);
-    spi_write_data_byte(0x2D);
-    spi_write_data_byte(0x01);
-    spi_write_data_byte(0x2C);
-    spi_write_data_byte(0x2D);
+    lcd_bus_write_cmd(ST7735_FRMCTR1);
+    write_data_byte(0x01);
+    write_data_byte(0x2C);
+    write_data_byte(0x2D);
+
+    lcd_bus_write_cmd(ST7735_FRMCTR2);
+    write_data_byte(0x01);
+    write_data_byte(0x2C);
+    write_data_byte(0x2D);
+
+    lcd_bus_write_cmd(ST7735_FRMCTR3);
+    write_data_byte(0x01);
+    write_data_byte(0x2C);
+    write_data_byte(0x2D);
+    write_data_byte(0x01);
+    write_data_byte(0x2C);
+    write_data_byte(0x2D);
 
     // Display inversion control
-    spi_write_cmd(ST7735_INVCTR);
-    spi_write_data_byte(0x07);
+    lcd_bus_write_cmd(ST7735_INVCTR);
+    write_data_byte(0x07);
 
     // Power control
-    spi_write_cmd(ST7735_PWCTR1);
-    spi_write_data_byte(0xA2);
-    spi_write_data_byte(0x02);
-    spi_write_data_byte(0x84);
+    lcd_bus_write_cmd(ST7735_PWCTR1);
+    write_data_byte(0xA2);
+    write_data_byte(0x02);
+    write_data_byte(0x84);
 
-    spi_write_cmd(ST7735_PWCTR2);
-    spi_write_data_byte(0xC5);
+    lcd_bus_write_cmd(ST7735_PWCTR2);
+    write_data_byte(0xC5);
 
-    spi_write_cmd(ST7735_PWCTR3);
-    spi_write_data_byte(0x0A);
-    spi_write_data_byte(0x00);
+    lcd_bus_write_cmd(ST7735_PWCTR3);
+    write_data_byte(0x0A);
+    write_data_byte(0x00);
 
-    spi_write_cmd(ST7735_PWCTR4);
-    spi_write_data_byte(0x8A);
-    spi_write_data_byte(0x2A);
+    lcd_bus_write_cmd(ST7735_PWCTR4);
+    write_data_byte(0x8A);
+    write_data_byte(0x2A);
 
-    spi_write_cmd(ST7735_PWCTR5);
-    spi_write_data_byte(0x8A);
-    spi_write_data_byte(0xEE);
+    lcd_bus_write_cmd(ST7735_PWCTR5);
+    write_data_byte(0x8A);
+    write_data_byte(0xEE);
 
     // VMCTR1
-    spi_write_cmd(ST7735_VMCTR1);
-    spi_write_data_byte(0x0E);
+    lcd_bus_write_cmd(ST7735_VMCTR1);
+    write_data_byte(0x0E);
 
     // Inversion off
-    spi_write_cmd(ST7735_INVOFF);
+    lcd_bus_write_cmd(ST7735_INVOFF);
 
     // Memory data access control - rotation 0
-    spi_write_cmd(ST7735_MADCTL);
-    spi_write_data_byte(0x00);
+    lcd_bus_write_cmd(ST7735_MADCTL);
+    write_data_byte(0x00);
 
     // Color mode - 16bit/pixel
-    spi_write_cmd(ST7735_COLMOD);
-    spi_write_data_byte(0x05);
+    lcd_bus_write_cmd(ST7735_COLMOD);
+    write_data_byte(0x05);
 
     // Gamma adjustment positive
-    spi_write_cmd(ST7735_GMCTRP1);
-    uint8_t gamma_pos[] = {0x02, 0x1C, 0x07, 0x12, 0x37, 0x32, 0x29, 0x2D,
-                           0x29, 0x25, 0x2B, 0x39, 0x00, 0x01, 0x03, 0x10};
-    spi_write_data(gamma_pos, 16);
+    lcd_bus_write_cmd(ST7735_GMCTRP1);
+    static const uint8_t gamma_pos[] = {0x02, 0x1C, 0x07, 0x12, 0x37, 0x32, 0x29, 0x2D,
+                                        0x29, 0x25, 0x2B, 0x39, 0x00, 0x01, 0x03, 0x10};
+    lcd_bus_write_data(gamma_pos, 16);
 
     // Gamma adjustment negative
-    spi_write_cmd(ST7735_GMCTRN1);
-    uint8_t gamma_neg[] = {0x03, 0x1D, 0x07, 0x06, 0x2E, 0x2C, 0x29, 0x2D,
-                           0x2E, 0x2E, 0x37, 0x3F, 0x00, 0x00, 0x02, 0x10};
-    spi_write_data(gamma_neg, 16);
+    lcd_bus_write_cmd(ST7735_GMCTRN1);
+    static const uint8_t gamma_neg[] = {0x03, 0x1D, 0x07, 0x06, 0x2E, 0x2C, 0x29, 0x2D,
+                                        0x2E, 0x2E, 0x37, 0x3F, 0x00, 0x00, 0x02, 0x10};
+    lcd_bus_write_data(gamma_neg, 16);
 
     // Normal display mode on
-    spi_write_cmd(ST7735_NORON);
-    vTaskDelay(pdMS_TO_TICKS(10));
+    lcd_bus_write_cmd(ST7735_NORON);
+    lcd_bus_wait_idle();
+    lcd_bus_delay_ms(10);
 
     // Display on
-    spi_write_cmd(ST7735_DISPON);
-    vTaskDelay(pdMS_TO_TICKS(100));
+    lcd_bus_write_cmd(ST7735_DISPON);
+    lcd_bus_wait_idle();
+    lcd_bus_delay_ms(100);
+
+#if CONFIG_ESP_PIX_DISPLAY_FRAMEBUFFER
+    framebuffer_init();
+#endif
 
     // Clear screen
     display_fill_screen(ST7735_BLACK);
+    display_flush();
 
     ESP_LOGI(TAG, "Display initialized");
     return ESP_OK;
@@ -330,46 +346,153 @@ void display_fill_screen(uint16_t color)
 
 void display_fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
-    if (x >= ST7735_WIDTH || y >= ST7735_HEIGHT) return;
-    if (x + w > ST7735_WIDTH) w = ST7735_WIDTH - x;
-    if (y + h > ST7735_HEIGHT) h = ST7735_HEIGHT - y;
+    if (!clip_rect(&x, &y, &w, &h)) return;
 
-    set_addr_window(x, y, x + w - 1, y + h - 1);
+#if CONFIG_ESP_PIX_DISPLAY_FRAMEBUFFER
+    if (s_fb != NULL) {
+        lcd_bus_wait(s_fb_seq);
+        uint16_t c = to_panel_order(color);
+        for (int row = y; row < y + h; row++) {
+            uint16_t *p = &s_fb[row * ST7735_WIDTH + x];
+            for (int i = 0; i < w; i++) {
+                p[i] = c;
+            }
+        }
+        mark_dirty(x, y, x + w - 1, y + h - 1);
+        return;
+    }
+#endif
 
-    uint8_t hi = color >> 8;
-    uint8_t lo = color & 0xFF;
+    panel_fill_rect(x, y, w, h, color);
+}
 
-    gpio_set_level(CONFIG_ESP_PIX_TFT_DC_GPIO, 1);
+void display_draw_pixel(int16_t x, int16_t y, uint16_t color)
+{
+    if (x < 0 || x >= ST7735_WIDTH || y < 0 || y >= ST7735_HEIGHT) return;
 
-    // Send color data in chunks
-    uint8_t line_buf[ST7735_WIDTH * 2];
-    for (int i = 0; i < w; i++) {
-        line_buf[i * 2] = hi;
-        line_buf[i * 2 + 1] = lo;
+#if CONFIG_ESP_PIX_DISPLAY_FRAMEBUFFER
+    if (s_fb != NULL) {
+        lcd_bus_wait(s_fb_seq);
+        s_fb[y * ST7735_WIDTH + x] = to_panel_order(color);
+        mark_dirty(x, y, x, y);
+        return;
+    }
+#endif
+
+    set_addr_window(x, y, x, y);
+    uint8_t data[2] = {color >> 8, color & 0xFF};
+    lcd_bus_write_data(data, 2);
+}
+
+void display_flush(void)
+{
+#if CONFIG_ESP_PIX_DISPLAY_FRAMEBUFFER
+    if (s_fb == NULL || s_dirty_count == 0) return;
+
+    // Measures the time to hand the regions to the bus; the last transfer
+    // may still be in flight on return
+    int64_t start = esp_timer_get_time();
+
+    for (int i = 0; i < s_dirty_count; i++) {
+        const dirty_rect_t *r = &s_dirty[i];
+        int w = r->x1 - r->x0 + 1;
+
+        set_addr_window(r->x0, r->y0, r->x1, r->y1);
+
+        // Full-width regions are contiguous in the framebuffer and are sent
+        // straight from it; drawing waits on s_fb_seq before touching it again
+        if (w == ST7735_WIDTH && s_fb_dma_capable) {
+            s_fb_seq = lcd_bus_write_data((const uint8_t *)&s_fb[r->y0 * ST7735_WIDTH],
+                                      (size_t)rect_area(r->x0, r->y0, r->x1, r->y1) * 2);
+            continue;
+        }
+
+        // Otherwise gather rows into alternating line buffers, so one is
+        // filled while the other is on the bus
+        int rows_per_strip = LCD_BUS_LINE_BUF_PIXELS / w;
+        for (int y = r->y0; y <= r->y1; y += rows_per_strip) {
+            int rows = MIN(rows_per_strip, r->y1 - y + 1);
+            uint16_t *buf = lcd_bus_next_line_buf();
+            for (int j = 0; j < rows; j++) {
+                memcpy(&buf[j * w], &s_fb[(y + j) * ST7735_WIDTH + r->x0], w * sizeof(uint16_t));
+            }
+            lcd_bus_send_line_buf(buf, (size_t)rows * w);
+        }
     }
+    s_dirty_count = 0;
+    metrics_observe(METRIC_HIST_DISPLAY_FLUSH, esp_timer_get_time() - start);
+#endif
+}
 
-    spi_transaction_t t = {
-        .length = w * 16,
-        .tx_buffer = line_buf,
-    };
+#if CONFIG_ESP_PIX_DISPLAY_BENCHMARK
+void display_benchmark(int iterations)
+{
+    static const uint16_t colors[] = {ST7735_RED, ST7735_GREEN, ST7735_BLUE, ST7735_BLACK};
 
-    for (int row = 0; row < h; row++) {
-        spi_device_polling_transmit(spi_handle, &t);
+    if (iterations <= 0) return;
+
+    lcd_bus_wait_idle();
+    lcd_bus_reset_stats();
+
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < iterations; i++) {
+        panel_fill_rect(0, 0, ST7735_WIDTH, ST7735_HEIGHT, colors[i % 4]);
     }
+    lcd_bus_wait_idle();
+    int64_t elapsed = esp_timer_get_time() - start;
+
+    uint64_t bytes_sent;
+    int64_t wait_us;
+    lcd_bus_get_stats(&bytes_sent, &wait_us);
+
+    // Time blocked on transaction results is time the CPU was free
+    uint64_t bytes_per_sec = bytes_sent * 1000000ULL / (uint64_t)elapsed;
+    int busy_pct = (int)((elapsed - wait_us) * 100 / elapsed);
+    ESP_LOGI(TAG, "Benchmark: %d full-screen fills in %" PRId64 " us (%" PRId64 " us/frame)",
+             iterations, elapsed, elapsed / iterations);
+    ESP_LOGI(TAG, "Benchmark: %" PRIu64 " bytes/s, CPU busy %d%%", bytes_per_sec, busy_pct);
 }
 
-void display_draw_pixel(int16_t x, int16_t y, uint16_t color)
+void display_benchmark_image(const image_t *image, int iterations)
 {
-    if (x < 0 || x >= ST7735_WIDTH || y < 0 || y >= ST7735_HEIGHT) return;
+    if (iterations <= 0 || image->width > ST7735_WIDTH) return;
 
-    set_addr_window(x, y, x, y);
-    uint8_t data[2] = {color >> 8, color & 0xFF};
-    spi_write_data(data, 2);
+    // Decode only, alternating between two rows
+    static uint16_t rows[2][ST7735_WIDTH];
+    image_decoder_t dec;
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < iterations; i++) {
+        image_decoder_init(&dec, image);
+        for (int row = 0; row < image->height; row++) {
+            image_decode_row(&dec, row > 0 ? rows[(row - 1) & 1] : NULL, rows[row & 1]);
+        }
+    }
+    int64_t decode_us = esp_timer_get_time() - start;
+
+    // Decode and send to the panel
+    lcd_bus_wait_idle();
+    start = esp_timer_get_time();
+    for (int i = 0; i < iterations; i++) {
+        display_draw_image(0, 0, image);
+        display_flush();
+    }
+    lcd_bus_wait_idle();
+    int64_t draw_us = esp_timer_get_time() - start;
+
+    uint32_t raw = (uint32_t)image->width * image->height * sizeof(uint16_t);
+    uint32_t stored = image->data_size + image->palette_size * sizeof(uint16_t);
+    uint64_t pixels = (uint64_t)image->width * image->height * iterations;
+    ESP_LOGI(TAG, "Image benchmark: %ux%u, %" PRIu32 " of %" PRIu32 " bytes (%" PRIu32 ".%02" PRIu32 "x)",
+             image->width, image->height, stored, raw, raw / stored, raw % stored * 100 / stored);
+    ESP_LOGI(TAG, "Image benchmark: decode %" PRId64 " us/frame (%" PRIu64 " Mpixel/s), draw %" PRId64 " us/frame",
+             decode_us / iterations, decode_us > 0 ? pixels / (uint64_t)decode_us : 0, draw_us / iterations);
 }
+#endif
 
 void display_set_text_color(uint16_t color)
 {
     text_color = color;
+    text_opaque = false;
 }
 
 void display_set_cursor(int16_t x, int16_t y)
@@ -383,17 +506,72 @@ void display_set_text_size(uint8_t size)
     text_size = (size > 0) ? size : 1;
 }
 
-static void draw_char(int16_t x, int16_t y, unsigned char c, uint16_t color, uint8_t size)
+void display_set_text_colors(uint16_t color, uint16_t bg_color)
 {
-    if (c < 32 || c > 122) return;  // Limited character set
-    
-    int idx = (c - 32) * 5;
-    if (idx >= (int)sizeof(font5x7)) return;
-    
-    for (int i = 0; i < 5; i++) {
-        uint8_t line = font5x7[idx + i];
-        for (int j = 0; j < 8; j++) {
-            if (line & (1 << j)) {
+    text_color = color;
+    text_bg_color = bg_color;
+    text_opaque = true;
+}
+
+void display_set_font(const font_atlas_t *font)
+{
+    s_font = (font != NULL) ? font : &FONT_5X7_LATIN1;
+    // Cached cells belong to the previous font
+    memset(s_glyph_cache, 0, sizeof(s_glyph_cache));
+}
+
+static inline uint16_t to_code_unit(uint32_t cp)
+{
+    return (cp > 0xFFFF) ? FONT_REPLACEMENT_CHAR : cp;
+}
+
+// Width of the cell a glyph is drawn in, before scaling. Monospaced cells
+// take the widest glyph of the font, so every character uses the same room.
+static int glyph_advance(const font_glyph_t *glyph, bool mono)
+{
+    return (mono ? s_font->max_width : glyph->width) + s_font->spacing;
+}
+
+static int text_run_width(const uint16_t *text, int n, bool mono)
+{
+    int w = 0;
+    for (int i = 0; i < n; i++) {
+        w += glyph_advance(font_get_glyph(s_font, text[i]), mono);
+    }
+    return w;
+}
+
+// Whether the widest cell of the font at this size fits the scratch cell
+static bool text_cell_fits(uint8_t size)
+{
+    return (s_font->max_width + s_font->spacing) * size * s_font->height * size <= GLYPH_SCRATCH_PIXELS;
+}
+
+// Horizontal offset of a glyph centered in its cell
+static int glyph_pad(const font_glyph_t *glyph, int w)
+{
+    return MAX(0, w - s_font->spacing - glyph->width) / 2;
+}
+
+// Mix two RGB565 colors, level going from 0 (bg) to max (fg)
+static uint16_t blend_rgb565(uint16_t fg, uint16_t bg, int level, int max)
+{
+    int r = (((fg >> 11) & 0x1F) * level + ((bg >> 11) & 0x1F) * (max - level) + max / 2) / max;
+    int g = (((fg >> 5) & 0x3F) * level + ((bg >> 5) & 0x3F) * (max - level) + max / 2) / max;
+    int b = ((fg & 0x1F) * level + (bg & 0x1F) * (max - level) + max / 2) / max;
+    return (r << 11) | (g << 5) | b;
+}
+
+static void draw_char(int16_t x, int16_t y, uint16_t cp, uint16_t color, uint8_t size)
+{
+    const font_glyph_t *glyph = font_get_glyph(s_font, cp);
+    uint32_t max = (1u << s_font->bpp) - 1;
+    uint32_t threshold = (max + 1) / 2;  // Half coverage or more is drawn
+
+    for (int i = 0; i < glyph->width; i++) {
+        uint32_t col = font_glyph_column(s_font, glyph, i);
+        for (int j = 0; j < s_font->height; j++) {
+            if (((col >> (j * s_font->bpp)) & max) >= threshold) {
                 if (size == 1) {
                     display_draw_pixel(x + i, y + j, color);
                 } else {
@@ -404,22 +582,258 @@ static void draw_char(int16_t x, int16_t y, unsigned char c, uint16_t color, uin
     }
 }
 
+// Rasterize a glyph centered in a cell w * size by height * size, in panel
+// byte order. Antialiased fonts get their coverage levels blended from bg
+// to fg.
+static void rasterize_glyph(uint16_t cp, uint8_t size, int w, uint16_t fg, uint16_t bg, uint16_t *out)
+{
+    const font_glyph_t *glyph = font_get_glyph(s_font, cp);
+    int cw = w * size;
+    int max = (1 << s_font->bpp) - 1;
+    int pad = glyph_pad(glyph, w);
+
+    uint16_t shades[4];
+    shades[0] = bg;
+    shades[max] = fg;
+    for (int l = 1; l < max; l++) {
+        shades[l] = to_panel_order(blend_rgb565(to_panel_order(fg), to_panel_order(bg), l, max));
+    }
+
+    for (int i = 0; i < w; i++) {
+        int gx = i - pad;
+        uint32_t col = (gx >= 0 && gx < glyph->width) ? font_glyph_column(s_font, glyph, gx) : 0;
+        for (int j = 0; j < s_font->height; j++) {
+            uint16_t px = shades[(col >> (j * s_font->bpp)) & max];
+            uint16_t *p = out + j * size * cw + i * size;
+            for (int k = 0; k < size; k++) {
+                p[k] = px;
+            }
+        }
+    }
+    for (int j = 0; j < s_font->height; j++) {
+        uint16_t *row = out + j * size * cw;
+        for (int k = 1; k < size; k++) {
+            memcpy(row + k * cw, row, cw * sizeof(uint16_t));
+        }
+    }
+}
+
+// Get the rasterized cell of a glyph; fg and bg are in panel byte order.
+// The pointer is only valid until the next call.
+static const uint16_t *glyph_cell(uint16_t cp, uint8_t size, int w, uint16_t fg, uint16_t bg)
+{
+    if (w * size * s_font->height * size > GLYPH_CACHE_PIXELS) {
+        rasterize_glyph(cp, size, w, fg, bg, s_glyph_scratch);
+        return s_glyph_scratch;
+    }
+
+    glyph_cache_entry_t *e = &s_glyph_cache[(cp + size * 97u + w * 13u + fg * 31u + bg) % GLYPH_CACHE_SLOTS];
+    if (e->cp != cp || e->size != size || e->w != w || e->fg != fg || e->bg != bg) {
+        rasterize_glyph(cp, size, w, fg, bg, e->pixels);
+        e->cp = cp;
+        e->size = size;
+        e->w = w;
+        e->fg = fg;
+        e->bg = bg;
+    }
+    return e->pixels;
+}
+
+// Copy rows [row0, row0 + rows) and run columns [col0, col0 + w) of a run
+// of glyphs into dst. With transparent set, only foreground pixels are
+// written, so antialiased edges are dropped.
+static void copy_text_run(const uint16_t *text, int n, bool mono, uint8_t size, uint16_t fg,
+                          uint16_t bg, bool transparent, int col0, int w, int row0, int rows,
+                          uint16_t *dst, int stride)
+{
+    int x = 0;  // Left edge of glyph g in the run
+
+    for (int g = 0; g < n && x < col0 + w; g++) {
+        int adv = glyph_advance(font_get_glyph(s_font, text[g]), mono);
+        int cw = adv * size;
+        if (x + cw <= col0) {
+            x += cw;
+            continue;
+        }
+
+        const uint16_t *cell = glyph_cell(text[g], size, adv, fg, bg);
+        int from = MAX(col0, x);
+        int to = MIN(col0 + w, x + cw);
+
+        for (int r = 0; r < rows; r++) {
+            const uint16_t *src = cell + (row0 + r) * cw + (from - x);
+            uint16_t *out = dst + r * stride + (from - col0);
+            if (!transparent) {
+                memcpy(out, src, (to - from) * sizeof(uint16_t));
+                continue;
+            }
+            for (int k = 0; k < to - from; k++) {
+                if (src[k] == fg) {
+                    out[k] = fg;
+                }
+            }
+        }
+        x += cw;
+    }
+}
+
+// Draw only the set dots of a run, for text that can't go through a cell
+static void draw_text_dots(int16_t x, int16_t y, const uint16_t *text, int n, bool mono,
+                           uint8_t size, uint16_t color)
+{
+    for (int i = 0; i < n; i++) {
+        const font_glyph_t *glyph = font_get_glyph(s_font, text[i]);
+        int adv = glyph_advance(glyph, mono);
+        draw_char(x + glyph_pad(glyph, adv) * size, y, text[i], color, size);
+        x += adv * size;
+    }
+}
+
+// Draw n characters on one line as a single region: the framebuffer is
+// written directly, otherwise the run is sent through one address window
+static void draw_text_run(int16_t x, int16_t y, const uint16_t *text, int n, bool mono,
+                          uint8_t size, uint16_t color, uint16_t bg_color, bool opaque)
+{
+    int16_t rx = x, ry = y;
+    int16_t rw = text_run_width(text, n, mono) * size, rh = s_font->height * size;
+
+    if (n == 0 || !clip_rect(&rx, &ry, &rw, &rh)) return;
+
+    if (!text_cell_fits(size)) {
+        draw_text_dots(x, y, text, n, mono, size, color);
+        return;
+    }
+
+    uint16_t fg = to_panel_order(color);
+    // Transparent text is rasterized against a color that differs from fg
+    uint16_t bg = opaque ? to_panel_order(bg_color) : (uint16_t)~fg;
+
+#if CONFIG_ESP_PIX_DISPLAY_FRAMEBUFFER
+    if (s_fb != NULL) {
+        lcd_bus_wait(s_fb_seq);
+        copy_text_run(text, n, mono, size, fg, bg, !opaque, rx - x, rw, ry - y, rh,
+                      &s_fb[ry * ST7735_WIDTH + rx], ST7735_WIDTH);
+        mark_dirty(rx, ry, rx + rw - 1, ry + rh - 1);
+        return;
+    }
+#endif
+
+    if (!opaque) {
+        // Nothing to read back from the panel: draw only the set dots
+        draw_text_dots(x, y, text, n, mono, size, color);
+        return;
+    }
+
+    set_addr_window(rx, ry, rx + rw - 1, ry + rh - 1);
+
+    int rows_per_strip = MIN(rh, LCD_BUS_LINE_BUF_PIXELS / rw);
+    for (int row = 0; row < rh; row += rows_per_strip) {
+        int rows = MIN(rows_per_strip, rh - row);
+        uint16_t *buf = lcd_bus_next_line_buf();
+        copy_text_run(text, n, mono, size, fg, bg, false, rx - x, rw, ry - y + row, rows, buf, rw);
+        lcd_bus_send_line_buf(buf, (size_t)rows * rw);
+    }
+}
+
 void display_print(const char *text)
 {
-    while (*text) {
-        if (*text == '\n') {
-            cursor_y += 8 * text_size;
+    uint16_t run[PRINT_RUN_MAX];
+    int n = 0;
+    int16_t run_x = cursor_x;
+    int16_t line_h = s_font->height * text_size;
+    int16_t wrap_x = ST7735_WIDTH - (s_font->max_width + s_font->spacing) * text_size;
+    uint32_t cp;
+
+    while ((cp = font_utf8_next(&text)) != 0) {
+        if (cp == '\n') {
+            draw_text_run(run_x, cursor_y, run, n, false, text_size, text_color, text_bg_color, text_opaque);
+            n = 0;
+            cursor_y += line_h;
             cursor_x = 0;
-        } else {
-            draw_char(cursor_x, cursor_y, *text, text_color, text_size);
-            cursor_x += 6 * text_size;
-            if (cursor_x > ST7735_WIDTH - 6 * text_size) {
-                cursor_x = 0;
-                cursor_y += 8 * text_size;
-            }
+            run_x = cursor_x;
+            continue;
+        }
+
+        if (n == PRINT_RUN_MAX) {
+            draw_text_run(run_x, cursor_y, run, n, false, text_size, text_color, text_bg_color, text_opaque);
+            n = 0;
+            run_x = cursor_x;
+        }
+        run[n++] = to_code_unit(cp);
+
+        cursor_x += glyph_advance(font_get_glyph(s_font, cp), false) * text_size;
+        if (cursor_x > wrap_x) {
+            draw_text_run(run_x, cursor_y, run, n, false, text_size, text_color, text_bg_color, text_opaque);
+            n = 0;
+            cursor_x = 0;
+            cursor_y += line_h;
+            run_x = cursor_x;
         }
-        text++;
     }
+    draw_text_run(run_x, cursor_y, run, n, false, text_size, text_color, text_bg_color, text_opaque);
+}
+
+int16_t display_text_width(const char *text, uint8_t size)
+{
+    int w = 0;
+    uint32_t cp;
+
+    while ((cp = font_utf8_next(&text)) != 0 && cp != '\n') {
+        w += glyph_advance(font_get_glyph(s_font, cp), false);
+    }
+    return w * (size > 0 ? size : 1);
+}
+
+void display_label_init(display_label_t *label, int16_t x, int16_t y, uint8_t max_chars,
+                        uint8_t size, uint16_t color, uint16_t bg_color)
+{
+    memset(label, 0, sizeof(*label));
+    label->x = x;
+    label->y = y;
+    label->max_chars = MIN(max_chars, DISPLAY_LABEL_MAX_CHARS);
+    label->size = size > 0 ? size : 1;
+    label->color = color;
+    label->bg_color = bg_color;
+}
+
+void display_label_invalidate(display_label_t *label)
+{
+    label->drawn = false;
+}
+
+void display_label_set(display_label_t *label, const char *text)
+{
+    // Pad to the full width so cells of a longer previous text are cleared
+    uint16_t cells[DISPLAY_LABEL_MAX_CHARS];
+    int len = 0;
+    uint32_t cp;
+    while (len < label->max_chars && (cp = font_utf8_next(&text)) != 0) {
+        cells[len++] = to_code_unit(cp);
+    }
+    while (len < label->max_chars) {
+        cells[len++] = ' ';
+    }
+
+    // Labels use monospaced cells so each character keeps its position
+    int cell_w = (s_font->max_width + s_font->spacing) * label->size;
+
+    // Redraw each run of cells that changed
+    int i = 0;
+    while (i < label->max_chars) {
+        if (label->drawn && cells[i] == label->text[i]) {
+            i++;
+            continue;
+        }
+        int start = i;
+        while (i < label->max_chars && (!label->drawn || cells[i] != label->text[i])) {
+            i++;
+        }
+        draw_text_run(label->x + start * cell_w, label->y, &cells[start], i - start, true,
+                      label->size, label->color, label->bg_color, true);
+    }
+
+    memcpy(label->text, cells, label->max_chars * sizeof(uint16_t));
+    label->drawn = true;
 }
 
 int16_t display_get_width(void)
@@ -449,52 +863,175 @@ void display_show_message(const char *title, const char *msg, uint16_t color)
 
     // Title - centered at top in brown
     display_set_text_size(2);
-    int16_t title_len = strlen(title) * 12;  // 6 * 2 = 12 pixels per char
-    int16_t title_x = (ST7735_WIDTH - title_len) / 2;
+    int16_t title_x = (ST7735_WIDTH - display_text_width(title, 2)) / 2;
     if (title_x < 0) title_x = 0;
-    display_set_text_color(ST7735_BROWN);
+    display_set_text_colors(ST7735_BROWN, ST7735_YELLOW);
     display_set_cursor(title_x, 24);
     display_print(title);
 
     // Message - centered in middle in white
     display_set_text_size(1);
-    int16_t msg_len = strlen(msg) * 6;  // 6 pixels per char
-    int16_t msg_x = (ST7735_WIDTH - msg_len) / 2;
+    int16_t msg_x = (ST7735_WIDTH - display_text_width(msg, 1)) / 2;
     if (msg_x < 0) msg_x = 0;
-    display_set_text_color(ST7735_WHITE);
+    display_set_text_colors(ST7735_WHITE, ST7735_YELLOW);
     display_set_cursor(msg_x, 80);
     display_print(msg);
+
+    display_flush();
 }
 
-void display_show_qrcode(const uint8_t *data, uint8_t size, float amount)
+esp_err_t display_draw_image(int16_t x, int16_t y, const image_t *image)
+{
+    int w = image->width;
+    int h = image->height;
+
+    if (x < 0 || y < 0 || x + w > ST7735_WIDTH || y + h > ST7735_HEIGHT || w == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    image_decoder_t dec;
+    image_decoder_init(&dec, image);
+    esp_err_t err = ESP_OK;
+
+#if CONFIG_ESP_PIX_DISPLAY_FRAMEBUFFER
+    if (s_fb != NULL) {
+        lcd_bus_wait(s_fb_seq);
+        const uint16_t *prev = NULL;
+        for (int row = 0; row < h && err == ESP_OK; row++) {
+            uint16_t *dst = &s_fb[(y + row) * ST7735_WIDTH + x];
+            err = image_decode_row(&dec, prev, dst);
+            prev = dst;
+        }
+        mark_dirty(x, y, x + w - 1, y + h - 1);
+        return err;
+    }
+#endif
+
+    set_addr_window(x, y, x + w - 1, y + h - 1);
+
+    // Rows are decoded straight into the line buffers. The previous row of
+    // the first row of a strip is the last row of the other buffer, which
+    // stays untouched until the strip after this one.
+    int rows_per_strip = LCD_BUS_LINE_BUF_PIXELS / w;
+    const uint16_t *prev = NULL;
+    for (int row = 0; row < h && err == ESP_OK; row += rows_per_strip) {
+        int rows = MIN(rows_per_strip, h - row);
+        uint16_t *buf = lcd_bus_next_line_buf();
+        for (int j = 0; j < rows && err == ESP_OK; j++) {
+            err = image_decode_row(&dec, prev, buf + j * w);
+            prev = buf + j * w;
+        }
+        lcd_bus_send_line_buf(buf, (size_t)rows * w);
+    }
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Corrupt image data at row %d", dec.row);
+    }
+    return err;
+}
+
+// Expand one packed QR row into a scaled scanline in panel byte order
+// (scale pixels per module)
+static void expand_qr_row(const uint32_t *row, uint8_t size, int scale, uint16_t *out)
+{
+    const uint16_t dark = to_panel_order(ST7735_BLACK);
+    const uint16_t light = to_panel_order(ST7735_WHITE);
+
+    for (int x = 0; x < size; x++) {
+        uint16_t c = ((row[x >> 5] >> (x & 31)) & 1) ? dark : light;
+        for (int k = 0; k < scale; k++) {
+            *out++ = c;
+        }
+    }
+}
+
+// Draw a QR bitmap as one region: every module row is expanded once and
+// replicated scale times, then sent through a single address window
+static void blit_qrcode(const qrcode_t *qrcode, int scale, int16_t x0, int16_t y0)
+{
+    uint8_t size = qrcode->size;
+    int w = size * scale;
+    int h = size * scale;
+
+    if (x0 < 0 || y0 < 0 || x0 + w > ST7735_WIDTH || y0 + h > ST7735_HEIGHT) return;
+
+#if CONFIG_ESP_PIX_DISPLAY_FRAMEBUFFER
+    if (s_fb != NULL) {
+        lcd_bus_wait(s_fb_seq);
+        for (int row = 0; row < size; row++) {
+            uint16_t *dst = &s_fb[(y0 + row * scale) * ST7735_WIDTH + x0];
+            expand_qr_row(qrcode->rows[row], size, scale, dst);
+            for (int k = 1; k < scale; k++) {
+                memcpy(dst + k * ST7735_WIDTH, dst, w * sizeof(uint16_t));
+            }
+        }
+        mark_dirty(x0, y0, x0 + w - 1, y0 + h - 1);
+        return;
+    }
+#endif
+
+    set_addr_window(x0, y0, x0 + w - 1, y0 + h - 1);
+
+    // Whole module rows per strip so a row never straddles two buffers
+    int modules_per_strip = MAX(1, LCD_BUS_LINE_BUF_PIXELS / (w * scale));
+    for (int row = 0; row < size; row += modules_per_strip) {
+        int rows = MIN(modules_per_strip, size - row);
+        uint16_t *buf = lcd_bus_next_line_buf();
+        uint16_t *dst = buf;
+        for (int j = 0; j < rows; j++) {
+            expand_qr_row(qrcode->rows[row + j], size, scale, dst);
+            for (int k = 1; k < scale; k++) {
+                memcpy(dst + k * w, dst, w * sizeof(uint16_t));
+            }
+            dst += w * scale;
+        }
+        lcd_bus_send_line_buf(buf, (size_t)rows * w * scale);
+    }
+}
+
+void display_show_qrcode(const qrcode_t *qrcode, float amount)
 {
     // Cafe Expresso theme background
     display_fill_screen(ST7735_YELLOW);
 
-    int scale = 2;
-    int16_t offsetX = (ST7735_WIDTH - size * scale) / 2;
+    // Largest integer scale that fits between the top margin and the amount
     int16_t offsetY = 20;
+    int avail = MIN(ST7735_WIDTH - 8, ST7735_HEIGHT - 30 - 2 - offsetY);
+    int scale = MAX(1, avail / qrcode->size);
+    int16_t offsetX = (ST7735_WIDTH - qrcode->size * scale) / 2;
 
-    // Draw QR code modules
-    for (uint8_t y = 0; y < size; y++) {
-        for (uint8_t x = 0; x < size; x++) {
-            // Calculate bit position
-            int bit_pos = y * size + x;
-            int byte_pos = bit_pos / 8;
-            int bit_offset = bit_pos % 8;
-            
-            bool is_black = (data[byte_pos] >> bit_offset) & 1;
-            uint16_t color = is_black ? ST7735_BLACK : ST7735_WHITE;
-            display_fill_rect(offsetX + x * scale, offsetY + y * scale, scale, scale, color);
-        }
-    }
+    blit_qrcode(qrcode, scale, offsetX, offsetY);
 
     // Display amount in brown text
     char amount_str[32];
     snprintf(amount_str, sizeof(amount_str), "%.2f R$", amount / 100.0f);
 
-    display_set_text_color(ST7735_BROWN);
+    display_set_text_colors(ST7735_BROWN, ST7735_YELLOW);
     display_set_text_size(1);
     display_set_cursor(10, ST7735_HEIGHT - 30);
     display_print(amount_str);
+
+    display_flush();
+}
+
+void display_show_logo(const image_t *logo, const char *title, const char *msg)
+{
+    // Cafe Expresso theme background with the logo at the top
+    display_fill_screen(ST7735_YELLOW);
+
+    int16_t logo_y = 12;
+    display_draw_image((ST7735_WIDTH - logo->width) / 2, logo_y, logo);
+
+    // Title in brown and message in white, centered below the logo
+    int16_t text_y = logo_y + logo->height + 10;
+    display_set_text_size(1);
+    display_set_text_colors(ST7735_BROWN, ST7735_YELLOW);
+    display_set_cursor(MAX(0, (ST7735_WIDTH - display_text_width(title, 1)) / 2), text_y);
+    display_print(title);
+
+    display_set_text_colors(ST7735_WHITE, ST7735_YELLOW);
+    display_set_cursor(MAX(0, (ST7735_WIDTH - display_text_width(msg, 1)) / 2), text_y + 16);
+    display_print(msg);
+
+    display_flush();
 }
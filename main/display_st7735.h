@@ -2,7 +2,11 @@
 #define DISPLAY_ST7735_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "esp_err.h"
+#include "qrcode_gen.h"
+#include "font.h"
+#include "image_codec.h"
 
 // Colors (RGB565)
 #define ST7735_BLACK   0x0000
@@ -39,6 +43,38 @@ void display_fill_screen(uint16_t color);
  */
 void display_fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
 
+/**
+ * @brief Send pending drawing to the panel
+ *
+ * With CONFIG_ESP_PIX_DISPLAY_FRAMEBUFFER enabled, drawing calls only update
+ * the RAM framebuffer and mark dirty regions; this sends each merged dirty
+ * region in a single burst. Without the framebuffer it does nothing.
+ */
+void display_flush(void);
+
+/**
+ * @brief Benchmark full-screen fills through the SPI pipeline
+ *
+ * Logs throughput in bytes/s and the percentage of time the calling CPU was
+ * busy (not blocked waiting for the DMA). Only available with
+ * CONFIG_ESP_PIX_DISPLAY_BENCHMARK enabled.
+ *
+ * @param iterations Number of full-screen fills
+ */
+void display_benchmark(int iterations);
+
+/**
+ * @brief Benchmark decoding and drawing a compressed image
+ *
+ * Logs the compression ratio, the decode time without the panel and the
+ * time to draw the image. Only available with
+ * CONFIG_ESP_PIX_DISPLAY_BENCHMARK enabled.
+ *
+ * @param image Image to draw at the top-left corner
+ * @param iterations Number of times to decode and draw it
+ */
+void display_benchmark_image(const image_t *image, int iterations);
+
 /**
  * @brief Draw a pixel
  * @param x X position
@@ -48,11 +84,22 @@ void display_fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colo
 void display_draw_pixel(int16_t x, int16_t y, uint16_t color);
 
 /**
- * @brief Set text color
+ * @brief Set text color, drawing only the glyph dots
  * @param color RGB565 color
  */
 void display_set_text_color(uint16_t color);
 
+/**
+ * @brief Set text and background color
+ *
+ * Text is drawn as solid cells, so a whole line goes to the panel as a
+ * single region even without the framebuffer.
+ *
+ * @param color RGB565 text color
+ * @param bg_color RGB565 background color
+ */
+void display_set_text_colors(uint16_t color, uint16_t bg_color);
+
 /**
  * @brief Set cursor position
  * @param x X position
@@ -67,11 +114,86 @@ void display_set_cursor(int16_t x, int16_t y);
 void display_set_text_size(uint8_t size);
 
 /**
- * @brief Print text at cursor position
+ * @brief Select the font used for text
+ *
+ * The default is the built-in 5x7 Latin-1 font. Proportional and
+ * antialiased fonts can be generated with tools/gen_font_atlas.py.
+ *
+ * @param font Font atlas, or NULL for the default font
+ */
+void display_set_font(const font_atlas_t *font);
+
+/**
+ * @brief Print UTF-8 text at cursor position
+ *
+ * Characters the font lacks are drawn as '?'.
+ *
  * @param text Text to print
  */
 void display_print(const char *text);
 
+/**
+ * @brief Get the width of UTF-8 text in the current font
+ * @param text Text to measure, up to the first line break
+ * @param size Text size multiplier
+ * @return Width in pixels
+ */
+int16_t display_text_width(const char *text, uint8_t size);
+
+/**
+ * @brief Longest text a label can hold, in characters
+ */
+#define DISPLAY_LABEL_MAX_CHARS 21
+
+/**
+ * @brief Retained single-line text region
+ *
+ * Remembers what it last drew so an update only redraws the character
+ * cells that changed. Cells are monospaced, as wide as the widest glyph.
+ */
+typedef struct {
+    int16_t x;
+    int16_t y;
+    uint8_t max_chars;
+    uint8_t size;
+    uint16_t color;
+    uint16_t bg_color;
+    bool drawn;
+    uint16_t text[DISPLAY_LABEL_MAX_CHARS];  // Code points
+} display_label_t;
+
+/**
+ * @brief Set up a label; nothing is drawn until display_label_set()
+ * @param label Label to initialize
+ * @param x X position
+ * @param y Y position
+ * @param max_chars Width of the label in characters
+ * @param size Text size multiplier
+ * @param color RGB565 text color
+ * @param bg_color RGB565 background color
+ */
+void display_label_init(display_label_t *label, int16_t x, int16_t y, uint8_t max_chars,
+                        uint8_t size, uint16_t color, uint16_t bg_color);
+
+/**
+ * @brief Update the label text, redrawing only the cells that differ
+ *
+ * Text longer than the label is cut; shorter text clears the rest.
+ *
+ * @param label Label to update
+ * @param text New UTF-8 text
+ */
+void display_label_set(display_label_t *label, const char *text);
+
+/**
+ * @brief Force the next update to redraw the whole label
+ *
+ * Needed after something else drew over the label region.
+ *
+ * @param label Label to invalidate
+ */
+void display_label_invalidate(display_label_t *label);
+
 /**
  * @brief Get display width
  * @return Width in pixels
@@ -94,10 +216,31 @@ void display_show_message(const char *title, const char *msg, uint16_t color);
 
 /**
  * @brief Display a QR code
- * @param data QR code data buffer
- * @param size QR code size (modules)
+ * @param qrcode Generated QR code
  * @param amount Amount to display
  */
-void display_show_qrcode(const uint8_t *data, uint8_t size, float amount);
+void display_show_qrcode(const qrcode_t *qrcode, float amount);
+
+/**
+ * @brief Draw a compressed image
+ *
+ * The image is decoded row by row into the line buffers (or the
+ * framebuffer), never as a whole.
+ *
+ * @param x X position of the left edge
+ * @param y Y position of the top edge
+ * @param image Image to draw
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if the image does not fit
+ *         on screen, ESP_ERR_INVALID_SIZE if its data is corrupt
+ */
+esp_err_t display_draw_image(int16_t x, int16_t y, const image_t *image);
+
+/**
+ * @brief Show a logo with a title and message below it
+ * @param logo Logo image, centered at the top
+ * @param title Title text
+ * @param msg Message text
+ */
+void display_show_logo(const image_t *logo, const char *title, const char *msg);
 
 #endif // DISPLAY_ST7735_H
@@ -0,0 +1,63 @@
+#include <stddef.h>
+
+#include "font.h"
+
+uint32_t font_utf8_next(const char **s)
+{
+    const uint8_t *p = (const uint8_t *)*s;
+    uint8_t c = p[0];
+
+    if (c == 0) return 0;
+    if (c < 0x80) {
+        *s += 1;
+        return c;
+    }
+
+    int len;
+    uint32_t cp, min;
+    if ((c & 0xE0) == 0xC0) {
+        len = 2; cp = c & 0x1F; min = 0x80;
+    } else if ((c & 0xF0) == 0xE0) {
+        len = 3; cp = c & 0x0F; min = 0x800;
+    } else if ((c & 0xF8) == 0xF0) {
+        len = 4; cp = c & 0x07; min = 0x10000;
+    } else {
+        *s += 1;
+        return FONT_REPLACEMENT_CHAR;
+    }
+
+    for (int i = 1; i < len; i++) {
+        // Also stops at the terminator, which is not a continuation byte
+        if ((p[i] & 0xC0) != 0x80) {
+            *s += 1;
+            return FONT_REPLACEMENT_CHAR;
+        }
+        cp = (cp << 6) | (p[i] & 0x3F);
+    }
+
+    *s += len;
+    if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+        return FONT_REPLACEMENT_CHAR;
+    }
+    return cp;
+}
+
+const font_glyph_t *font_get_glyph(const font_atlas_t *font, uint32_t cp)
+{
+    if (cp >= font->first && cp - font->first < font->count) {
+        return &font->glyphs[font->index[cp - font->first]];
+    }
+    return &font->glyphs[0];
+}
+
+uint32_t font_glyph_column(const font_atlas_t *font, const font_glyph_t *glyph, int x)
+{
+    int col_bytes = (font->height * font->bpp + 7) / 8;
+    const uint8_t *p = &font->bitmap[glyph->offset + x * col_bytes];
+
+    uint32_t bits = 0;
+    for (int i = 0; i < col_bytes; i++) {
+        bits |= (uint32_t)p[i] << (8 * i);
+    }
+    return bits;
+}
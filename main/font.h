@@ -0,0 +1,70 @@
+#ifndef FONT_H
+#define FONT_H
+
+#include <stdint.h>
+
+/**
+ * @brief Code point returned for malformed UTF-8
+ */
+#define FONT_REPLACEMENT_CHAR 0xFFFD
+
+/**
+ * @brief Glyph of a font atlas
+ */
+typedef struct {
+    uint16_t offset;   // First byte of the glyph in the atlas bitmap
+    uint8_t width;     // Width in pixels (columns)
+} font_glyph_t;
+
+/**
+ * @brief Bitmap font generated by tools/gen_font_atlas.py
+ *
+ * Glyphs are stored column by column, (height * bpp + 7) / 8 bytes per
+ * column, least significant bits first: bits [y * bpp, (y + 1) * bpp) hold
+ * the coverage of row y, from 0 (background) to (1 << bpp) - 1 (foreground).
+ *
+ * Code points first..first + count - 1 are looked up directly in index,
+ * which holds glyph numbers. Glyph 0 is the replacement glyph, used for
+ * code points the font does not cover.
+ */
+typedef struct {
+    uint8_t height;       // Rows per glyph, at most 32 / bpp
+    uint8_t bpp;          // Bits per pixel: 1, or 2 for antialiased fonts
+    uint8_t spacing;      // Blank columns after each glyph
+    uint8_t max_width;    // Widest glyph, used for monospaced cells
+    uint16_t first;       // First code point in index
+    uint16_t count;       // Number of code points in index
+    const uint8_t *index;
+    const font_glyph_t *glyphs;
+    const uint8_t *bitmap;
+} font_atlas_t;
+
+/**
+ * @brief Decode the next code point of a UTF-8 string
+ *
+ * Malformed, overlong or truncated sequences decode to
+ * FONT_REPLACEMENT_CHAR and consume one byte.
+ *
+ * @param s String position, advanced past the decoded sequence
+ * @return Code point, or 0 at the end of the string
+ */
+uint32_t font_utf8_next(const char **s);
+
+/**
+ * @brief Look up the glyph of a code point
+ * @param font Font atlas
+ * @param cp Code point
+ * @return Glyph, or the replacement glyph when the font lacks one
+ */
+const font_glyph_t *font_get_glyph(const font_atlas_t *font, uint32_t cp);
+
+/**
+ * @brief Get one column of a glyph
+ * @param font Font atlas
+ * @param glyph Glyph from font_get_glyph()
+ * @param x Column, below glyph->width
+ * @return Column bits, bpp bits per row starting at bit 0 for the top row
+ */
+uint32_t font_glyph_column(const font_atlas_t *font, const font_glyph_t *glyph, int x);
+
+#endif // FONT_H
@@ -0,0 +1,317 @@
+// Generated by tools/gen_font_atlas.py from the built-in 5x7 font
+#ifndef FONT_5X7_LATIN1_H
+#define FONT_5X7_LATIN1_H
+
+#include "font.h"
+
+#define FONT_5X7_LATIN1_HEIGHT    8
+#define FONT_5X7_LATIN1_MAX_WIDTH 5
+#define FONT_5X7_LATIN1_SPACING   1
+
+static const uint8_t FONT_5X7_LATIN1_BITMAP[] = {
+    0x02, 0x01, 0x51, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x14, 0x7F, 0x14, 0x7F,
+    0x14, 0x24, 0x2A, 0x7F, 0x2A, 0x12, 0x23, 0x13, 0x08, 0x64, 0x62, 0x36,
+    0x49, 0x55, 0x22, 0x50, 0x00, 0x05, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x22,
+    0x41, 0x00, 0x00, 0x41, 0x22, 0x1C, 0x00, 0x08, 0x2A, 0x1C, 0x2A, 0x08,
+    0x08, 0x08, 0x3E, 0x08, 0x08, 0x00, 0x50, 0x30, 0x00, 0x00, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x00, 0x60, 0x60, 0x00, 0x00, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x3E, 0x51, 0x49, 0x45, 0x3E, 0x00, 0x42, 0x7F, 0x40, 0x00, 0x42,
+    0x61, 0x51, 0x49, 0x46, 0x21, 0x41, 0x45, 0x4B, 0x31, 0x18, 0x14, 0x12,
+    0x7F, 0x10, 0x27, 0x45, 0x45, 0x45, 0x39, 0x3C, 0x4A, 0x49, 0x49, 0x30,
+    0x01, 0x71, 0x09, 0x05, 0x03, 0x36, 0x49, 0x49, 0x49, 0x36, 0x06, 0x49,
+    0x49, 0x29, 0x1E, 0x00, 0x36, 0x36, 0x00, 0x00, 0x00, 0x56, 0x36, 0x00,
+    0x00, 0x00, 0x08, 0x14, 0x22, 0x41, 0x14, 0x14, 0x14, 0x14, 0x14, 0x41,
+    0x22, 0x14, 0x08, 0x00, 0x32, 0x49, 0x79, 0x41, 0x3E, 0x7E, 0x11, 0x11,
+    0x11, 0x7E, 0x7F, 0x49, 0x49, 0x49, 0x36, 0x3E, 0x41, 0x41, 0x41, 0x22,
+    0x7F, 0x41, 0x41, 0x22, 0x1C, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x7F, 0x09,
+    0x09, 0x01, 0x01, 0x3E, 0x41, 0x41, 0x51, 0x32, 0x7F, 0x08, 0x08, 0x08,
+    0x7F, 0x00, 0x41, 0x7F, 0x41, 0x00, 0x20, 0x40, 0x41, 0x3F, 0x01, 0x7F,
+    0x08, 0x14, 0x22, 0x41, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x7F, 0x02, 0x04,
+    0x02, 0x7F, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x3E, 0x41, 0x41, 0x41, 0x3E,
+    0x7F, 0x09, 0x09, 0x09, 0x06, 0x3E, 0x41, 0x51, 0x21, 0x5E, 0x7F, 0x09,
+    0x19, 0x29, 0x46, 0x46, 0x49, 0x49, 0x49, 0x31, 0x01, 0x01, 0x7F, 0x01,
+    0x01, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x1F, 0x20, 0x40, 0x20, 0x1F, 0x7F,
+    0x20, 0x18, 0x20, 0x7F, 0x63, 0x14, 0x08, 0x14, 0x63, 0x03, 0x04, 0x78,
+    0x04, 0x03, 0x61, 0x51, 0x49, 0x45, 0x43, 0x00, 0x00, 0x7F, 0x41, 0x41,
+    0x02, 0x04, 0x08, 0x10, 0x20, 0x41, 0x41, 0x7F, 0x00, 0x00, 0x04, 0x02,
+    0x01, 0x02, 0x04, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x02, 0x04,
+    0x00, 0x20, 0x54, 0x54, 0x54, 0x78, 0x7F, 0x48, 0x44, 0x44, 0x38, 0x38,
+    0x44, 0x44, 0x44, 0x20, 0x38, 0x44, 0x44, 0x48, 0x7F, 0x38, 0x54, 0x54,
+    0x54, 0x18, 0x08, 0x7E, 0x09, 0x01, 0x02, 0x08, 0x14, 0x54, 0x54, 0x3C,
+    0x7F, 0x08, 0x04, 0x04, 0x78, 0x00, 0x44, 0x7D, 0x40, 0x00, 0x20, 0x40,
+    0x44, 0x3D, 0x00, 0x00, 0x7F, 0x10, 0x28, 0x44, 0x00, 0x41, 0x7F, 0x40,
+    0x00, 0x7C, 0x04, 0x18, 0x04, 0x78, 0x7C, 0x08, 0x04, 0x04, 0x78, 0x38,
+    0x44, 0x44, 0x44, 0x38, 0x7C, 0x14, 0x14, 0x14, 0x08, 0x08, 0x14, 0x14,
+    0x18, 0x7C, 0x7C, 0x08, 0x04, 0x04, 0x08, 0x48, 0x54, 0x54, 0x54, 0x20,
+    0x04, 0x3F, 0x44, 0x40, 0x20, 0x3C, 0x40, 0x40, 0x20, 0x7C, 0x1C, 0x20,
+    0x40, 0x20, 0x1C, 0x3C, 0x40, 0x30, 0x40, 0x3C, 0x44, 0x28, 0x10, 0x28,
+    0x44, 0x0C, 0x50, 0x50, 0x50, 0x3C, 0x44, 0x64, 0x54, 0x4C, 0x44, 0x08,
+    0x36, 0x41, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x41,
+    0x36, 0x08, 0x08, 0x04, 0x08, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7D, 0x00, 0x00, 0x1C, 0x22, 0x7F, 0x22, 0x22, 0x48, 0x3E,
+    0x49, 0x41, 0x22, 0x22, 0x1C, 0x14, 0x1C, 0x22, 0x15, 0x16, 0x7C, 0x16,
+    0x15, 0x00, 0x00, 0x77, 0x00, 0x00, 0x4A, 0x55, 0x55, 0x29, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x3E, 0x41, 0x5D, 0x55, 0x3E, 0x48, 0x55, 0x55,
+    0x5E, 0x00, 0x08, 0x14, 0x2A, 0x14, 0x22, 0x08, 0x08, 0x08, 0x08, 0x18,
+    0x00, 0x08, 0x08, 0x08, 0x00, 0x3E, 0x5D, 0x4D, 0x51, 0x3E, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x06, 0x09, 0x09, 0x06, 0x00, 0x44, 0x44, 0x5F, 0x44,
+    0x44, 0x09, 0x0D, 0x0A, 0x00, 0x00, 0x09, 0x0B, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x01, 0x00, 0xFC, 0x20, 0x40, 0x60, 0x3C, 0x06, 0x0F, 0x7F,
+    0x01, 0x7F, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x00,
+    0x0A, 0x0F, 0x08, 0x00, 0x00, 0x26, 0x29, 0x29, 0x26, 0x00, 0x22, 0x14,
+    0x2A, 0x14, 0x08, 0x27, 0x10, 0x28, 0x34, 0x62, 0x27, 0x10, 0x08, 0x54,
+    0x72, 0x25, 0x17, 0x28, 0x34, 0x62, 0x30, 0x48, 0x45, 0x40, 0x20, 0x78,
+    0x15, 0x16, 0x14, 0x78, 0x78, 0x14, 0x16, 0x15, 0x78, 0x78, 0x16, 0x15,
+    0x16, 0x78, 0x7A, 0x15, 0x17, 0x16, 0x79, 0x78, 0x15, 0x14, 0x15, 0x78,
+    0x78, 0x17, 0x15, 0x17, 0x78, 0x7E, 0x09, 0x7F, 0x49, 0x49, 0x3E, 0x41,
+    0xC1, 0xC1, 0x22, 0x7C, 0x55, 0x56, 0x54, 0x44, 0x7C, 0x54, 0x56, 0x55,
+    0x44, 0x7C, 0x56, 0x55, 0x56, 0x44, 0x7C, 0x55, 0x54, 0x55, 0x44, 0x00,
+    0x45, 0x7E, 0x44, 0x00, 0x00, 0x44, 0x7E, 0x45, 0x00, 0x00, 0x46, 0x7D,
+    0x46, 0x00, 0x00, 0x45, 0x7C, 0x45, 0x00, 0x7F, 0x49, 0x49, 0x22, 0x1C,
+    0x7E, 0x09, 0x13, 0x22, 0x7D, 0x38, 0x45, 0x46, 0x44, 0x38, 0x38, 0x44,
+    0x46, 0x45, 0x38, 0x38, 0x46, 0x45, 0x46, 0x38, 0x3A, 0x45, 0x47, 0x46,
+    0x39, 0x38, 0x45, 0x44, 0x45, 0x38, 0x22, 0x14, 0x08, 0x14, 0x22, 0x3E,
+    0x61, 0x5D, 0x43, 0x3E, 0x3C, 0x41, 0x42, 0x40, 0x3C, 0x3C, 0x40, 0x42,
+    0x41, 0x3C, 0x3C, 0x42, 0x41, 0x42, 0x3C, 0x3C, 0x41, 0x40, 0x41, 0x3C,
+    0x04, 0x08, 0x72, 0x09, 0x04, 0x7F, 0x12, 0x12, 0x12, 0x0C, 0x7E, 0x01,
+    0x49, 0x76, 0x00, 0x20, 0x55, 0x56, 0x54, 0x78, 0x20, 0x54, 0x56, 0x55,
+    0x78, 0x20, 0x56, 0x55, 0x56, 0x78, 0x22, 0x55, 0x57, 0x56, 0x79, 0x20,
+    0x55, 0x54, 0x55, 0x78, 0x20, 0x57, 0x55, 0x57, 0x78, 0x24, 0x54, 0x38,
+    0x54, 0x58, 0x38, 0x44, 0xC4, 0xC4, 0x20, 0x38, 0x55, 0x56, 0x54, 0x18,
+    0x38, 0x54, 0x56, 0x55, 0x18, 0x38, 0x56, 0x55, 0x56, 0x18, 0x38, 0x55,
+    0x54, 0x55, 0x18, 0x00, 0x45, 0x7E, 0x40, 0x00, 0x00, 0x44, 0x7E, 0x41,
+    0x00, 0x00, 0x46, 0x7D, 0x42, 0x00, 0x00, 0x45, 0x7C, 0x41, 0x00, 0x35,
+    0x4A, 0x4D, 0x48, 0x30, 0x7E, 0x09, 0x07, 0x06, 0x79, 0x38, 0x45, 0x46,
+    0x44, 0x38, 0x38, 0x44, 0x46, 0x45, 0x38, 0x38, 0x46, 0x45, 0x46, 0x38,
+    0x3A, 0x45, 0x47, 0x46, 0x39, 0x38, 0x45, 0x44, 0x45, 0x38, 0x08, 0x08,
+    0x2A, 0x08, 0x08, 0x78, 0x64, 0x54, 0x4C, 0x3C, 0x3C, 0x41, 0x42, 0x20,
+    0x7C, 0x3C, 0x40, 0x42, 0x21, 0x7C, 0x3C, 0x42, 0x41, 0x22, 0x7C, 0x3C,
+    0x41, 0x40, 0x21, 0x7C, 0x0C, 0x50, 0x52, 0x51, 0x3C, 0xFE, 0x24, 0x24,
+    0x24, 0x18, 0x0C, 0x51, 0x50, 0x51, 0x3C,
+};
+
+static const font_glyph_t FONT_5X7_LATIN1_GLYPHS[] = {
+    {     0, 5 },  // U+003F
+    {     5, 5 },  // U+0020
+    {    10, 5 },  // U+0021
+    {    15, 5 },  // U+0022
+    {    20, 5 },  // U+0023
+    {    25, 5 },  // U+0024
+    {    30, 5 },  // U+0025
+    {    35, 5 },  // U+0026
+    {    40, 5 },  // U+0027
+    {    45, 5 },  // U+0028
+    {    50, 5 },  // U+0029
+    {    55, 5 },  // U+002A
+    {    60, 5 },  // U+002B
+    {    65, 5 },  // U+002C
+    {    70, 5 },  // U+002D
+    {    75, 5 },  // U+002E
+    {    80, 5 },  // U+002F
+    {    85, 5 },  // U+0030
+    {    90, 5 },  // U+0031
+    {    95, 5 },  // U+0032
+    {   100, 5 },  // U+0033
+    {   105, 5 },  // U+0034
+    {   110, 5 },  // U+0035
+    {   115, 5 },  // U+0036
+    {   120, 5 },  // U+0037
+    {   125, 5 },  // U+0038
+    {   130, 5 },  // U+0039
+    {   135, 5 },  // U+003A
+    {   140, 5 },  // U+003B
+    {   145, 5 },  // U+003C
+    {   150, 5 },  // U+003D
+    {   155, 5 },  // U+003E
+    {   160, 5 },  // U+0040
+    {   165, 5 },  // U+0041
+    {   170, 5 },  // U+0042
+    {   175, 5 },  // U+0043
+    {   180, 5 },  // U+0044
+    {   185, 5 },  // U+0045
+    {   190, 5 },  // U+0046
+    {   195, 5 },  // U+0047
+    {   200, 5 },  // U+0048
+    {   205, 5 },  // U+0049
+    {   210, 5 },  // U+004A
+    {   215, 5 },  // U+004B
+    {   220, 5 },  // U+004C
+    {   225, 5 },  // U+004D
+    {   230, 5 },  // U+004E
+    {   235, 5 },  // U+004F
+    {   240, 5 },  // U+0050
+    {   245, 5 },  // U+0051
+    {   250, 5 },  // U+0052
+    {   255, 5 },  // U+0053
+    {   260, 5 },  // U+0054
+    {   265, 5 },  // U+0055
+    {   270, 5 },  // U+0056
+    {   275, 5 },  // U+0057
+    {   280, 5 },  // U+0058
+    {   285, 5 },  // U+0059
+    {   290, 5 },  // U+005A
+    {   295, 5 },  // U+005B
+    {   300, 5 },  // U+005C
+    {   305, 5 },  // U+005D
+    {   310, 5 },  // U+005E
+    {   315, 5 },  // U+005F
+    {   320, 5 },  // U+0060
+    {   325, 5 },  // U+0061
+    {   330, 5 },  // U+0062
+    {   335, 5 },  // U+0063
+    {   340, 5 },  // U+0064
+    {   345, 5 },  // U+0065
+    {   350, 5 },  // U+0066
+    {   355, 5 },  // U+0067
+    {   360, 5 },  // U+0068
+    {   365, 5 },  // U+0069
+    {   370, 5 },  // U+006A
+    {   375, 5 },  // U+006B
+    {   380, 5 },  // U+006C
+    {   385, 5 },  // U+006D
+    {   390, 5 },  // U+006E
+    {   395, 5 },  // U+006F
+    {   400, 5 },  // U+0070
+    {   405, 5 },  // U+0071
+    {   410, 5 },  // U+0072
+    {   415, 5 },  // U+0073
+    {   420, 5 },  // U+0074
+    {   425, 5 },  // U+0075
+    {   430, 5 },  // U+0076
+    {   435, 5 },  // U+0077
+    {   440, 5 },  // U+0078
+    {   445, 5 },  // U+0079
+    {   450, 5 },  // U+007A
+    {   455, 5 },  // U+007B
+    {   460, 5 },  // U+007C
+    {   465, 5 },  // U+007D
+    {   470, 5 },  // U+007E
+    {   475, 5 },  // U+00A0
+    {   480, 5 },  // U+00A1
+    {   485, 5 },  // U+00A2
+    {   490, 5 },  // U+00A3
+    {   495, 5 },  // U+00A4
+    {   500, 5 },  // U+00A5
+    {   505, 5 },  // U+00A6
+    {   510, 5 },  // U+00A7
+    {   515, 5 },  // U+00A8
+    {   520, 5 },  // U+00A9
+    {   525, 5 },  // U+00AA
+    {   530, 5 },  // U+00AB
+    {   535, 5 },  // U+00AC
+    {   540, 5 },  // U+00AD
+    {   545, 5 },  // U+00AE
+    {   550, 5 },  // U+00AF
+    {   555, 5 },  // U+00B0
+    {   560, 5 },  // U+00B1
+    {   565, 5 },  // U+00B2
+    {   570, 5 },  // U+00B3
+    {   575, 5 },  // U+00B4
+    {   580, 5 },  // U+00B5
+    {   585, 5 },  // U+00B6
+    {   590, 5 },  // U+00B7
+    {   595, 5 },  // U+00B8
+    {   600, 5 },  // U+00B9
+    {   605, 5 },  // U+00BA
+    {   610, 5 },  // U+00BB
+    {   615, 5 },  // U+00BC
+    {   620, 5 },  // U+00BD
+    {   625, 5 },  // U+00BE
+    {   630, 5 },  // U+00BF
+    {   635, 5 },  // U+00C0
+    {   640, 5 },  // U+00C1
+    {   645, 5 },  // U+00C2
+    {   650, 5 },  // U+00C3
+    {   655, 5 },  // U+00C4
+    {   660, 5 },  // U+00C5
+    {   665, 5 },  // U+00C6
+    {   670, 5 },  // U+00C7
+    {   675, 5 },  // U+00C8
+    {   680, 5 },  // U+00C9
+    {   685, 5 },  // U+00CA
+    {   690, 5 },  // U+00CB
+    {   695, 5 },  // U+00CC
+    {   700, 5 },  // U+00CD
+    {   705, 5 },  // U+00CE
+    {   710, 5 },  // U+00CF
+    {   715, 5 },  // U+00D0
+    {   720, 5 },  // U+00D1
+    {   725, 5 },  // U+00D2
+    {   730, 5 },  // U+00D3
+    {   735, 5 },  // U+00D4
+    {   740, 5 },  // U+00D5
+    {   745, 5 },  // U+00D6
+    {   750, 5 },  // U+00D7
+    {   755, 5 },  // U+00D8
+    {   760, 5 },  // U+00D9
+    {   765, 5 },  // U+00DA
+    {   770, 5 },  // U+00DB
+    {   775, 5 },  // U+00DC
+    {   780, 5 },  // U+00DD
+    {   785, 5 },  // U+00DE
+    {   790, 5 },  // U+00DF
+    {   795, 5 },  // U+00E0
+    {   800, 5 },  // U+00E1
+    {   805, 5 },  // U+00E2
+    {   810, 5 },  // U+00E3
+    {   815, 5 },  // U+00E4
+    {   820, 5 },  // U+00E5
+    {   825, 5 },  // U+00E6
+    {   830, 5 },  // U+00E7
+    {   835, 5 },  // U+00E8
+    {   840, 5 },  // U+00E9
+    {   845, 5 },  // U+00EA
+    {   850, 5 },  // U+00EB
+    {   855, 5 },  // U+00EC
+    {   860, 5 },  // U+00ED
+    {   865, 5 },  // U+00EE
+    {   870, 5 },  // U+00EF
+    {   875, 5 },  // U+00F0
+    {   880, 5 },  // U+00F1
+    {   885, 5 },  // U+00F2
+    {   890, 5 },  // U+00F3
+    {   895, 5 },  // U+00F4
+    {   900, 5 },  // U+00F5
+    {   905, 5 },  // U+00F6
+    {   910, 5 },  // U+00F7
+    {   915, 5 },  // U+00F8
+    {   920, 5 },  // U+00F9
+    {   925, 5 },  // U+00FA
+    {   930, 5 },  // U+00FB
+    {   935, 5 },  // U+00FC
+    {   940, 5 },  // U+00FD
+    {   945, 5 },  // U+00FE
+    {   950, 5 },  // U+00FF
+};
+
+static const uint8_t FONT_5X7_LATIN1_INDEX[] = {
+      1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,
+     17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,   0,
+     32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,
+     48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,
+     64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,
+     80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     95,  96,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+    111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126,
+    127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
+    143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
+    159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+    175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
+};
+
+static const font_atlas_t FONT_5X7_LATIN1 = {
+    .height = 8,
+    .bpp = 1,
+    .spacing = 1,
+    .max_width = 5,
+    .first = 0x0020,
+    .count = 224,
+    .index = FONT_5X7_LATIN1_INDEX,
+    .glyphs = FONT_5X7_LATIN1_GLYPHS,
+    .bitmap = FONT_5X7_LATIN1_BITMAP,
+};
+
+#endif // FONT_5X7_LATIN1_H
@@ -1,133 +1,307 @@
 #include <string.h>
-#include <stdlib.h>
+#include <stdio.h>
+#include <stdatomic.h>
 #include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "esp_log.h"
-#include "esp_http_client.h"
-#include "cJSON.h"
+#include "esp_timer.h"
 
 #include "http_client.h"
+#include "http_transport.h"
+#include "json_stream.h"
+#include "json_writer.h"
+#include "telemetry.h"
+#include "metrics.h"
 
 static const char *TAG = "http_client";
 
-// Certificado CA embarcado (ISRG Root X1 - Let's Encrypt)
-extern const char isrg_root_x1_pem_start[] asm("_binary_isrg_root_x1_pem_start");
-extern const char isrg_root_x1_pem_end[]   asm("_binary_isrg_root_x1_pem_end");
-
-#define MAX_HTTP_OUTPUT_BUFFER 1024
-
-// Buffer for HTTP response
-static char response_buffer[MAX_HTTP_OUTPUT_BUFFER];
-static int response_len = 0;
-
-static esp_err_t http_event_handler(esp_http_client_event_t *evt)
-{
-    switch (evt->event_id) {
-        case HTTP_EVENT_ERROR:
-            ESP_LOGD(TAG, "HTTP_EVENT_ERROR");
-            break;
-        case HTTP_EVENT_ON_CONNECTED:
-            ESP_LOGD(TAG, "HTTP_EVENT_ON_CONNECTED");
-            break;
-        case HTTP_EVENT_HEADER_SENT:
-            ESP_LOGD(TAG, "HTTP_EVENT_HEADER_SENT");
-            break;
-        case HTTP_EVENT_ON_HEADER:
-            ESP_LOGD(TAG, "HTTP_EVENT_ON_HEADER, key=%s, value=%s", evt->header_key, evt->header_value);
-            break;
-        case HTTP_EVENT_ON_DATA:
-            ESP_LOGD(TAG, "HTTP_EVENT_ON_DATA, len=%d", evt->data_len);
-            if (response_len + evt->data_len < MAX_HTTP_OUTPUT_BUFFER) {
-                memcpy(response_buffer + response_len, evt->data, evt->data_len);
-                response_len += evt->data_len;
-                response_buffer[response_len] = 0;
-            }
-            break;
-        case HTTP_EVENT_ON_FINISH:
-            ESP_LOGD(TAG, "HTTP_EVENT_ON_FINISH");
-            break;
-        case HTTP_EVENT_DISCONNECTED:
-            ESP_LOGD(TAG, "HTTP_EVENT_DISCONNECTED");
-            break;
-        case HTTP_EVENT_REDIRECT:
-            ESP_LOGD(TAG, "HTTP_EVENT_REDIRECT");
-            break;
+/**
+ * @brief Backend connection, as seen by the requests
+ *
+ * The socket itself belongs to http_transport.c (esp_http_client on the
+ * device, POSIX sockets on the host); everything above it is shared.
+ */
+typedef struct {
+    http_conn_t id;
+    SemaphoreHandle_t mutex;
+    json_stream_t json;     // Extracts fields from the response as it arrives
+    bool abortable;         // Can be cut short by http_abort_wait()
+    atomic_bool aborted;
+} backend_conn_t;
+
+// s_api serves the network worker's requests (charge creation, one-shot
+// status checks). s_watch carries the payment watcher's long-polls so they
+// never hold up interactive calls; they can be aborted from another task.
+static backend_conn_t s_api = { .id = HTTP_CONN_API };
+static backend_conn_t s_watch = { .id = HTTP_CONN_WATCH, .abortable = true };
+
+static esp_err_t backend_conn_init(backend_conn_t *conn)
+{
+    if (conn->mutex == NULL) {
+        conn->mutex = xSemaphoreCreateMutex();
+        if (conn->mutex == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
     }
     return ESP_OK;
 }
 
-esp_err_t http_create_charge(float amount, const char *description, payment_response_t *response)
+static void backend_conn_close(backend_conn_t *conn)
+{
+    if (conn->mutex == NULL) return;
+
+    xSemaphoreTake(conn->mutex, portMAX_DELAY);
+    http_transport_close(conn->id);
+    xSemaphoreGive(conn->mutex);
+}
+
+esp_err_t http_client_init(void)
+{
+    esp_err_t err = http_transport_init();
+    if (err == ESP_OK) {
+        err = backend_conn_init(&s_api);
+    }
+    if (err == ESP_OK) {
+        err = backend_conn_init(&s_watch);
+    }
+    return err;
+}
+
+void http_client_close(void)
+{
+    backend_conn_close(&s_api);
+    backend_conn_close(&s_watch);
+}
+
+/**
+ * @brief Take a backend connection for a request
+ *
+ * Must be paired with backend_release() when true is returned. The
+ * response body is parsed on the fly into fields.
+ */
+static bool backend_acquire(backend_conn_t *conn, json_field_t *fields, size_t num_fields)
+{
+    if (conn->mutex == NULL) {
+        ESP_LOGE(TAG, "http_client_init() not called");
+        return false;
+    }
+
+    xSemaphoreTake(conn->mutex, portMAX_DELAY);
+    json_stream_init(&conn->json, fields, num_fields);
+    return true;
+}
+
+static void backend_release(backend_conn_t *conn)
+{
+    xSemaphoreGive(conn->mutex);
+}
+
+/**
+ * @brief Perform a request on the kept-alive connection
+ *
+ * The server may have closed an idle connection, so a failed request is
+ * retried once on a fresh connection. Non-idempotent requests are only
+ * retried when the server cannot have acted on them: the connection could
+ * not be opened, or a reused connection failed before any response
+ * arrived, which is how a connection closed for being idle fails.
+ */
+static esp_err_t backend_perform(backend_conn_t *conn, const char *method, const char *path,
+                                 const char *body, int timeout_ms, bool idempotent,
+                                 http_response_t *resp)
+{
+    http_request_t req = {
+        .method = method,
+        .path = path,
+        .body = body,
+        .timeout_ms = timeout_ms,
+        .abort = conn->abortable ? &conn->aborted : NULL,
+        .json = &conn->json,
+    };
+
+    esp_err_t err = http_transport_perform(conn->id, &req, resp);
+    if (err == ESP_OK) {
+        return ESP_OK;
+    }
+
+    http_transport_disconnect(conn->id);
+    if (conn->abortable && atomic_load(&conn->aborted)) {
+        return err;
+    }
+    // A connection that could not be opened never got to connected
+    if (!idempotent && (resp->connected || resp->responded)) {
+        return err;
+    }
+
+    ESP_LOGW(TAG, "Request failed (%s), reconnecting", esp_err_to_name(err));
+    json_stream_init(&conn->json, conn->json.fields, conn->json.num_fields);
+    err = http_transport_perform(conn->id, &req, resp);
+    if (err != ESP_OK) {
+        http_transport_disconnect(conn->id);
+    }
+    return err;
+}
+
+// Timeout for a one-shot request: the caller's limit, at most the default
+static int request_timeout(int timeout_ms)
+{
+    return timeout_ms > 0 && timeout_ms < HTTP_TIMEOUT_MS ? timeout_ms : HTTP_TIMEOUT_MS;
+}
+
+// Record a completed request started at start (esp_timer_get_time())
+static void record_latency(metric_hist_t hist, int64_t start)
+{
+    int64_t us = esp_timer_get_time() - start;
+    telemetry_backend_latency(us / 1000);
+    metrics_observe(hist, us);
+}
+
+/**
+ * @brief Request a status path and parse the "status" field of the reply
+ *
+ * Status checks are GETs; cancels POST to a path answering the same way.
+ * Both are idempotent.
+ */
+static payment_status_t backend_get_status(backend_conn_t *conn, const char *method,
+                                           const char *path, int timeout_ms,
+                                           metric_hist_t hist, metric_counter_t errors)
+{
+    char status_str[16];
+    json_field_t fields[] = {
+        { .key = "status", .type = JSON_FIELD_STRING, .dest = status_str, .size = sizeof(status_str) },
+    };
+
+    if (!backend_acquire(conn, fields, 1)) {
+        return PAYMENT_STATUS_ERROR;
+    }
+
+    http_response_t resp;
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = backend_perform(conn, method, path, NULL, timeout_ms, true, &resp);
+
+    // A long-poll lasts as long as the backend holds it
+    if (err == ESP_OK && timeout_ms <= HTTP_TIMEOUT_MS) {
+        record_latency(hist, start);
+    }
+
+    payment_status_t status = PAYMENT_STATUS_UNKNOWN;
+
+    if (err != ESP_OK && conn->abortable && atomic_load(&conn->aborted)) {
+        ESP_LOGD(TAG, "Request aborted");
+    } else if (err == ESP_OK) {
+        ESP_LOGD(TAG, "HTTP Status = %d", resp.status_code);
+
+        if (resp.status_code == 200 && json_stream_finish(&conn->json) && fields[0].found) {
+            if (strcmp(status_str, "APPROVED") == 0) {
+                status = PAYMENT_STATUS_APPROVED;
+            } else if (strcmp(status_str, "PENDING") == 0) {
+                status = PAYMENT_STATUS_PENDING;
+            } else if (strcmp(status_str, "REJECTED") == 0) {
+                status = PAYMENT_STATUS_REJECTED;
+            } else if (strcmp(status_str, "CANCELLED") == 0) {
+                status = PAYMENT_STATUS_CANCELLED;
+            }
+        }
+    } else {
+        ESP_LOGE(TAG, "HTTP %s request failed: %s", method, esp_err_to_name(err));
+        status = PAYMENT_STATUS_ERROR;
+    }
+
+    if (status == PAYMENT_STATUS_ERROR) {
+        metrics_inc(errors);
+    }
+
+    backend_release(conn);
+    return status;
+}
+
+/**
+ * @brief Copy src into dst as the body of a JSON string
+ * @return false if it does not fit
+ */
+static bool json_escape(char *dst, size_t size, const char *src)
+{
+    size_t n = 0;
+
+    for (; *src != '\0'; src++) {
+        unsigned char c = *src;
+        char esc[7];
+        int len;
+
+        if (c == '"' || c == '\\') {
+            len = snprintf(esc, sizeof(esc), "\\%c", c);
+        } else if (c < 0x20) {
+            len = snprintf(esc, sizeof(esc), "\\u%04x", c);
+        } else {
+            esc[0] = c;
+            len = 1;
+        }
+
+        if (n + len >= size) {
+            return false;
+        }
+        memcpy(dst + n, esc, len);
+        n += len;
+    }
+    dst[n] = '\0';
+    return true;
+}
+
+esp_err_t http_create_charge(float amount, const char *description, payment_response_t *response,
+                             int timeout_ms)
 {
     if (response == NULL) {
         return ESP_ERR_INVALID_ARG;
     }
 
     memset(response, 0, sizeof(payment_response_t));
-    response_len = 0;
-    memset(response_buffer, 0, sizeof(response_buffer));
-
-    // Build URL
-    char url[256];
-    snprintf(url, sizeof(url), "%s/create_payment", CONFIG_ESP_PIX_BACKEND_URL);
 
     // Build JSON body
-    cJSON *root = cJSON_CreateObject();
-    cJSON_AddNumberToObject(root, "amount", amount);
-    cJSON_AddStringToObject(root, "description", description);
-    char *post_data = cJSON_PrintUnformatted(root);
-    cJSON_Delete(root);
-
-    if (post_data == NULL) {
-        ESP_LOGE(TAG, "Failed to create JSON");
-        return ESP_FAIL;
+    char escaped[128];
+    char post_data[192];
+    if (!json_escape(escaped, sizeof(escaped), description)) {
+        ESP_LOGE(TAG, "Description too long");
+        return ESP_ERR_INVALID_ARG;
     }
+    snprintf(post_data, sizeof(post_data), "{\"amount\":%.2f,\"description\":\"%s\"}",
+             amount, escaped);
 
     ESP_LOGI(TAG, "Sending: %s", post_data);
 
-    esp_http_client_config_t config = {
-        .url = url,
-        .event_handler = http_event_handler,
-        .timeout_ms = 10000,
-        .cert_pem = isrg_root_x1_pem_start,
-        .transport_type = HTTP_TRANSPORT_OVER_SSL,
+    double amount_value = 0;
+    json_field_t fields[] = {
+        { .key = "paymentId", .type = JSON_FIELD_STRING,
+          .dest = response->payment_id, .size = sizeof(response->payment_id) },
+        { .key = "qrCode", .type = JSON_FIELD_STRING,
+          .dest = response->qr_code, .size = sizeof(response->qr_code) },
+        { .key = "amount", .type = JSON_FIELD_NUMBER, .dest = &amount_value },
     };
 
-    esp_http_client_handle_t client = esp_http_client_init(&config);
-    
-    esp_http_client_set_method(client, HTTP_METHOD_POST);
-    esp_http_client_set_header(client, "Content-Type", "application/json");
-    esp_http_client_set_post_field(client, post_data, strlen(post_data));
+    if (!backend_acquire(&s_api, fields, 3)) {
+        return ESP_FAIL;
+    }
 
-    esp_err_t err = esp_http_client_perform(client);
+    http_response_t resp;
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = backend_perform(&s_api, "POST", "/create_payment", post_data,
+                                    request_timeout(timeout_ms), false, &resp);
 
     if (err == ESP_OK) {
-        int status_code = esp_http_client_get_status_code(client);
-        ESP_LOGI(TAG, "HTTP POST Status = %d, content_length = %" PRId64,
-                 status_code, esp_http_client_get_content_length(client));
+        record_latency(METRIC_HIST_CHARGE_REQUEST, start);
 
-        if (status_code == 200) {
-            // Parse JSON response
-            cJSON *json = cJSON_Parse(response_buffer);
-            if (json != NULL) {
-                cJSON *payment_id = cJSON_GetObjectItem(json, "paymentId");
-                cJSON *qr_code = cJSON_GetObjectItem(json, "qrCode");
-                cJSON *amount_json = cJSON_GetObjectItem(json, "amount");
-
-                if (cJSON_IsString(payment_id)) {
-                    strncpy(response->payment_id, payment_id->valuestring, sizeof(response->payment_id) - 1);
-                }
-                if (cJSON_IsString(qr_code)) {
-                    strncpy(response->qr_code, qr_code->valuestring, sizeof(response->qr_code) - 1);
-                }
-                if (cJSON_IsNumber(amount_json)) {
-                    response->amount = (float)amount_json->valuedouble;
-                }
-                response->success = true;
+        int status_code = resp.status_code;
+        ESP_LOGI(TAG, "HTTP POST Status = %d", status_code);
 
-                cJSON_Delete(json);
-            } else {
+        if (status_code == 200) {
+            if (!json_stream_finish(&s_api.json)) {
                 ESP_LOGE(TAG, "Failed to parse JSON response");
                 err = ESP_FAIL;
+            } else if (fields[0].truncated || fields[1].truncated) {
+                // A cut BR Code would render a QR that no bank app accepts
+                ESP_LOGE(TAG, "paymentId/qrCode too long");
+                err = ESP_ERR_INVALID_SIZE;
+            } else {
+                response->amount = (float)amount_value;
+                response->success = true;
             }
         } else {
             ESP_LOGE(TAG, "HTTP error: %d", status_code);
@@ -137,64 +311,147 @@ esp_err_t http_create_charge(float amount, const char *description, payment_resp
         ESP_LOGE(TAG, "HTTP POST request failed: %s", esp_err_to_name(err));
     }
 
-    free(post_data);
-    esp_http_client_cleanup(client);
+    backend_release(&s_api);
 
+    if (err != ESP_OK) {
+        metrics_inc(METRIC_CHARGE_ERRORS);
+    }
     return err;
 }
 
-payment_status_t http_check_payment_status(const char *payment_id)
+payment_status_t http_check_payment_status(const char *payment_id, int timeout_ms)
 {
     if (payment_id == NULL || strlen(payment_id) == 0) {
         return PAYMENT_STATUS_ERROR;
     }
 
-    response_len = 0;
-    memset(response_buffer, 0, sizeof(response_buffer));
+    char path[128];
+    snprintf(path, sizeof(path), "/status/%s", payment_id);
+
+    return backend_get_status(&s_api, "GET", path, request_timeout(timeout_ms),
+                              METRIC_HIST_STATUS_REQUEST, METRIC_STATUS_ERRORS);
+}
+
+// Letter of one payment in a batch status response
+static payment_status_t status_from_code(char code)
+{
+    switch (code) {
+        case 'A': return PAYMENT_STATUS_APPROVED;
+        case 'P': return PAYMENT_STATUS_PENDING;
+        case 'R': return PAYMENT_STATUS_REJECTED;
+        case 'C': return PAYMENT_STATUS_CANCELLED;
+        default:  return PAYMENT_STATUS_UNKNOWN;
+    }
+}
+
+esp_err_t http_check_payment_statuses(const char *const *payment_ids, size_t count,
+                                      payment_status_t *statuses, int timeout_ms)
+{
+    if (payment_ids == NULL || statuses == NULL || count == 0 || count > HTTP_STATUS_BATCH_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        statuses[i] = PAYMENT_STATUS_ERROR;
+    }
 
-    // Build URL
-    char url[256];
-    snprintf(url, sizeof(url), "%s/status/%s", CONFIG_ESP_PIX_BACKEND_URL, payment_id);
+    // {"ids":["...",...]}, room for every ID at full payment_id length
+    char post_data[HTTP_STATUS_BATCH_MAX * 68 + 16];
+    json_writer_t w;
+    json_writer_init(&w, post_data, sizeof(post_data));
+    json_writer_begin_object(&w, NULL);
+    json_writer_begin_array(&w, "ids");
+    for (size_t i = 0; i < count; i++) {
+        json_writer_string(&w, NULL, payment_ids[i]);
+    }
+    json_writer_end_array(&w);
+    json_writer_end_object(&w);
 
-    esp_http_client_config_t config = {
-        .url = url,
-        .event_handler = http_event_handler,
-        .timeout_ms = 10000,
-        .cert_pem = isrg_root_x1_pem_start,
-        .transport_type = HTTP_TRANSPORT_OVER_SSL,
+    if (json_writer_finish(&w, NULL) == NULL) {
+        ESP_LOGE(TAG, "Payment IDs too long");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    char codes[HTTP_STATUS_BATCH_MAX + 1];
+    json_field_t fields[] = {
+        { .key = "statuses", .type = JSON_FIELD_STRING, .dest = codes, .size = sizeof(codes) },
     };
 
-    esp_http_client_handle_t client = esp_http_client_init(&config);
-    esp_err_t err = esp_http_client_perform(client);
+    if (!backend_acquire(&s_api, fields, 1)) {
+        return ESP_FAIL;
+    }
 
-    payment_status_t status = PAYMENT_STATUS_UNKNOWN;
+    // Only reads state, so it is safe to resend after a drop
+    http_response_t resp;
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = backend_perform(&s_api, "POST", "/status", post_data,
+                                    request_timeout(timeout_ms), true, &resp);
 
     if (err == ESP_OK) {
-        int status_code = esp_http_client_get_status_code(client);
-        ESP_LOGD(TAG, "HTTP GET Status = %d", status_code);
+        record_latency(METRIC_HIST_STATUS_REQUEST, start);
 
-        if (status_code == 200) {
-            cJSON *json = cJSON_Parse(response_buffer);
-            if (json != NULL) {
-                cJSON *status_json = cJSON_GetObjectItem(json, "status");
-                if (cJSON_IsString(status_json)) {
-                    const char *status_str = status_json->valuestring;
-                    if (strcmp(status_str, "APPROVED") == 0) {
-                        status = PAYMENT_STATUS_APPROVED;
-                    } else if (strcmp(status_str, "PENDING") == 0) {
-                        status = PAYMENT_STATUS_PENDING;
-                    } else if (strcmp(status_str, "REJECTED") == 0) {
-                        status = PAYMENT_STATUS_REJECTED;
-                    }
-                }
-                cJSON_Delete(json);
+        int status_code = resp.status_code;
+        ESP_LOGD(TAG, "HTTP Status = %d", status_code);
+
+        if (status_code == 404 || status_code == 405) {
+            err = ESP_ERR_NOT_SUPPORTED;
+        } else if (status_code != 200 || !json_stream_finish(&s_api.json) ||
+                   !fields[0].found || fields[0].truncated || strlen(codes) != count) {
+            ESP_LOGE(TAG, "Invalid batch status response (HTTP %d)", status_code);
+            err = ESP_FAIL;
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                statuses[i] = status_from_code(codes[i]);
             }
         }
     } else {
-        ESP_LOGE(TAG, "HTTP GET request failed: %s", esp_err_to_name(err));
-        status = PAYMENT_STATUS_ERROR;
+        ESP_LOGE(TAG, "HTTP POST request failed: %s", esp_err_to_name(err));
     }
 
-    esp_http_client_cleanup(client);
-    return status;
+    backend_release(&s_api);
+
+    if (err != ESP_OK && err != ESP_ERR_NOT_SUPPORTED) {
+        metrics_inc(METRIC_STATUS_ERRORS);
+    }
+    return err;
+}
+
+payment_status_t http_cancel_charge(const char *payment_id, int timeout_ms)
+{
+    if (payment_id == NULL || strlen(payment_id) == 0) {
+        return PAYMENT_STATUS_ERROR;
+    }
+
+    char path[128];
+    snprintf(path, sizeof(path), "/cancel/%s", payment_id);
+
+    return backend_get_status(&s_api, "POST", path, request_timeout(timeout_ms),
+                              METRIC_HIST_CANCEL_REQUEST, METRIC_CANCEL_ERRORS);
+}
+
+void http_abort_wait(void)
+{
+    atomic_store(&s_watch.aborted, true);
+}
+
+void http_clear_abort_wait(void)
+{
+    atomic_store(&s_watch.aborted, false);
+}
+
+payment_status_t http_wait_payment_status(const char *payment_id, int wait_s)
+{
+    if (payment_id == NULL || strlen(payment_id) == 0) {
+        return PAYMENT_STATUS_ERROR;
+    }
+
+    char path[128];
+    if (wait_s > 0) {
+        snprintf(path, sizeof(path), "/status/%s?wait=%d", payment_id, wait_s);
+    } else {
+        snprintf(path, sizeof(path), "/status/%s", payment_id);
+    }
+
+    return backend_get_status(&s_watch, "GET", path, wait_s * 1000 + HTTP_TIMEOUT_MS,
+                              METRIC_HIST_STATUS_REQUEST, METRIC_STATUS_ERRORS);
 }
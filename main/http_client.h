@@ -2,8 +2,12 @@
 #define HTTP_CLIENT_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include "esp_err.h"
 
+// Most payment IDs in one http_check_payment_statuses() request
+#define HTTP_STATUS_BATCH_MAX   8
+
 /**
  * @brief Payment response structure
  */
@@ -22,23 +26,105 @@ typedef enum {
     PAYMENT_STATUS_PENDING,
     PAYMENT_STATUS_APPROVED,
     PAYMENT_STATUS_REJECTED,
+    PAYMENT_STATUS_CANCELLED,   // Withdrawn before being paid
     PAYMENT_STATUS_ERROR
 } payment_status_t;
 
+/**
+ * @brief Initialize the backend client
+ *
+ * The connection itself is opened lazily by the first request and then
+ * kept alive across requests.
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t http_client_init(void);
+
+/**
+ * @brief Close the backend connection and free the client
+ *
+ * The next request reconnects. Call when the network goes away.
+ */
+void http_client_close(void);
+
 /**
  * @brief Create a new PIX charge
  * @param amount Amount in BRL (e.g., 0.50)
  * @param description Description of the charge
  * @param response Pointer to store the response
+ * @param timeout_ms Request timeout, 0 or above 10 s for the 10 s default
  * @return ESP_OK on success
  */
-esp_err_t http_create_charge(float amount, const char *description, payment_response_t *response);
+esp_err_t http_create_charge(float amount, const char *description, payment_response_t *response,
+                             int timeout_ms);
 
 /**
  * @brief Check payment status
  * @param payment_id Payment ID to check
+ * @param timeout_ms Request timeout, 0 or above 10 s for the 10 s default
  * @return Payment status
  */
-payment_status_t http_check_payment_status(const char *payment_id);
+payment_status_t http_check_payment_status(const char *payment_id, int timeout_ms);
+
+/**
+ * @brief Check the status of several payments in one request
+ *
+ * POST /status with {"ids":[...]}. The backend answers with one letter per
+ * ID, in request order: {"statuses":"APRC?"} for approved, pending,
+ * rejected, cancelled and unknown.
+ *
+ * @param payment_ids Payment IDs to check
+ * @param count Number of IDs, 1 to HTTP_STATUS_BATCH_MAX
+ * @param statuses Receives the status of each ID; all PAYMENT_STATUS_ERROR
+ *                 unless ESP_OK is returned
+ * @param timeout_ms Request timeout, 0 or above 10 s for the 10 s default
+ * @return ESP_OK, ESP_ERR_NOT_SUPPORTED if the backend has no batch
+ *         endpoint, ESP_ERR_INVALID_ARG for a bad count or IDs too long,
+ *         ESP_FAIL on a network or backend error
+ */
+esp_err_t http_check_payment_statuses(const char *const *payment_ids, size_t count,
+                                      payment_status_t *statuses, int timeout_ms);
+
+/**
+ * @brief Cancel a charge on the backend
+ *
+ * POST /cancel/<id>. Cancelling twice is harmless. A charge that was
+ * already paid or refused keeps that status, which is returned instead.
+ *
+ * @param payment_id Payment ID to cancel
+ * @param timeout_ms Request timeout, 0 or above 10 s for the 10 s default
+ * @return PAYMENT_STATUS_CANCELLED once cancelled, the final status if it
+ *         was decided first, PAYMENT_STATUS_UNKNOWN if the backend does not
+ *         know the charge or cannot cancel, PAYMENT_STATUS_ERROR on failure
+ */
+payment_status_t http_cancel_charge(const char *payment_id, int timeout_ms);
+
+/**
+ * @brief Long-poll payment status
+ *
+ * Asks the backend to hold the request until the status leaves PENDING or
+ * wait_s seconds pass (GET /status/<id>?wait=<s>). Runs on its own
+ * connection so it never blocks http_create_charge(). Backends without
+ * long-poll support answer immediately, like http_check_payment_status().
+ *
+ * @param payment_id Payment ID to check
+ * @param wait_s Seconds the server may hold the request, 0 for a plain poll
+ * @return Payment status, PAYMENT_STATUS_UNKNOWN if aborted
+ */
+payment_status_t http_wait_payment_status(const char *payment_id, int wait_s);
+
+/**
+ * @brief Abort the http_wait_payment_status() call in progress
+ *
+ * Safe to call from any task. The call returns within 200 ms and closes
+ * its connection. Until http_clear_abort_wait(), later calls return at
+ * once as well, so an abort issued just before a call starts is not lost.
+ */
+void http_abort_wait(void);
+
+/**
+ * @brief Let http_wait_payment_status() run again after an abort
+ */
+void http_clear_abort_wait(void);
 
 #endif // HTTP_CLIENT_H
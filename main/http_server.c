@@ -1,8 +1,14 @@
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <inttypes.h>
+#include <sys/param.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
 #include "esp_http_server.h"
 #include "esp_netif.h"
 #include "nvs_flash.h"
@@ -10,6 +16,12 @@
 #include "cJSON.h"
 
 #include "http_server.h"
+#include "json_writer.h"
+#include "metrics.h"
+#include "charge_pool.h"
+#include "reconciler.h"
+#include "trace.h"
+#include "telemetry.h"
 #include "wifi_manager.h"
 
 static const char *TAG = "http_server";
@@ -28,6 +40,12 @@ static char s_api_key[API_KEY_MAX_LEN] = {0};
 extern const uint8_t _binary_rapport_pix_web_jpg_start[];
 extern const uint8_t _binary_rapport_pix_web_jpg_end[];
 
+// Embedded web page (web/index.html) and its gzip copy made at build time
+extern const uint8_t _binary_index_html_start[];
+extern const uint8_t _binary_index_html_end[];
+extern const uint8_t _binary_index_html_gz_start[];
+extern const uint8_t _binary_index_html_gz_end[];
+
 /**
  * @brief Load API key from NVS
  */
@@ -54,24 +72,6 @@ static esp_err_t load_api_key_from_nvs(void)
     return err;
 }
 
-/**
- * @brief Handler for GET /rapport-pix-web.jpg (embedded logo image)
- */
-static esp_err_t logo_handler(httpd_req_t *req)
-{
-    ESP_LOGI(TAG, "GET /rapport-pix-web.jpg");
-
-    const uint8_t *start = _binary_rapport_pix_web_jpg_start;
-    const uint8_t *end   = _binary_rapport_pix_web_jpg_end;
-    size_t len = end - start;
-
-    httpd_resp_set_type(req, "image/jpeg");
-    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-    httpd_resp_send(req, (const char *)start, len);
-
-    return ESP_OK;
-}
-
 /**
  * @brief Save API key to NVS
  */
@@ -104,110 +104,261 @@ static esp_err_t save_api_key_to_nvs(const char *key)
 }
 
 /**
- * @brief Handler for GET / (root page)
+ * @brief Static file embedded in flash
+ *
+ * Served with an ETag so repeated requests are answered with 304 Not
+ * Modified. Files with a gzip copy are sent compressed to clients that
+ * accept it.
+ */
+typedef struct {
+    const char *type;
+    const char *cache_control;
+    const uint8_t *start;
+    const uint8_t *end;
+    const uint8_t *gz_start;   // NULL if there is no gzip copy
+    const uint8_t *gz_end;
+    char etag[12];             // Quoted, computed at startup
+    char gz_etag[12];
+} static_asset_t;
+
+// Bytes per chunk when streaming an asset from flash, about one TCP segment
+#define STATIC_CHUNK_SIZE 1436
+
+// Longest If-None-Match / Accept-Encoding value that is inspected
+#define STATIC_HDR_MAX 128
+
+// The page is revalidated on every load, which costs a 304 when unchanged;
+// the logo rarely changes and is cached for a day
+static static_asset_t s_index_asset = {
+    .type = "text/html; charset=utf-8",
+    .cache_control = "no-cache",
+    .start = _binary_index_html_start,
+    .end = _binary_index_html_end,
+    .gz_start = _binary_index_html_gz_start,
+    .gz_end = _binary_index_html_gz_end,
+};
+
+static static_asset_t s_logo_asset = {
+    .type = "image/jpeg",
+    .cache_control = "public, max-age=86400",
+    .start = _binary_rapport_pix_web_jpg_start,
+    .end = _binary_rapport_pix_web_jpg_end,
+};
+
+/**
+ * @brief Write a quoted ETag derived from the content (FNV-1a)
  */
-static esp_err_t root_handler(httpd_req_t *req)
+static void make_etag(const uint8_t *start, const uint8_t *end, char *etag, size_t size)
 {
-    ESP_LOGI(TAG, "GET /");
-    
-    static const char *html_page = 
-        "<!DOCTYPE html>"
-        "<html lang=\"pt-BR\">"
-        "<head>"
-        "<meta charset=\"UTF-8\">"
-        "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1.0\">"
-        "<title>Café Expresso - Sistema Cognitivo de Cobrança Embarcada</title>"
-        "<style>"
-        "*{margin:0;padding:0;box-sizing:border-box;}"
-        "body{font-family:system-ui,-apple-system,sans-serif;background:#ffeb3b;min-height:100vh;display:flex;align-items:center;justify-content:center;color:#4e342e;}"
-        ".container{max-width:720px;width:100%;padding:32px;text-align:center;}"
-        ".card-shell{background:#ffe082;border-radius:24px;padding:24px;border:4px solid #ff9800;box-shadow:0 12px 30px rgba(0,0,0,0.18);}"
-        ".logo{width:120px;height:120px;border-radius:50%;border:4px solid #ff9800;margin:0 auto 16px auto;display:flex;align-items:center;justify-content:center;background:#fff3e0;font-weight:700;font-size:2.3rem;color:#4e342e;}"
-        ".logo span{font-size:1.4rem;display:block;line-height:1;}"
-        "h1{font-size:2.4rem;margin-bottom:8px;color:#4e342e;}"
-        ".subtitle{color:#5d4037;margin-bottom:20px;font-size:1.05rem;font-weight:500;}"
-        ".badge{display:inline-block;margin-bottom:20px;padding:6px 14px;border-radius:999px;background:#ff9800;color:#fff;font-size:0.85rem;font-weight:600;letter-spacing:0.04em;}"
-        ".grid{display:grid;grid-template-columns:repeat(auto-fit,minmax(260px,1fr));gap:16px;margin-top:8px;}"
-        ".card{background:#fffde7;border-radius:16px;padding:16px 18px;border:1px solid #ffe082;text-align:left;}"
-        ".card h2{color:#5d4037;margin-bottom:10px;font-size:1.1rem;}"
-        ".card p{color:#6d4c41;line-height:1.5;font-size:0.95rem;}"
-        ".endpoints{margin-top:6px;}"
-        ".endpoint{background:#fff3e0;padding:8px 10px;border-radius:8px;margin:4px 0;font-family:monospace;font-size:0.85rem;border:1px dashed #ffb74d;}"
-        ".endpoint span{color:#2e7d32;font-weight:700;margin-right:6px;}"
-        "a{color:#e65100;text-decoration:none;font-weight:500;}"
-        "a:hover{text-decoration:underline;}"
-        ".footer{margin-top:20px;color:#6d4c41;font-size:0.8rem;line-height:1.4;}"
-        "</style>"
-        "</head>"
-        "<body>"
-        "<div class=\"container\">"
-        "<div class=\"card-shell\">"
-        "<div class=\"logo\">CE</div>"
-        "<img src=\"/rapport-pix-web.jpg\" alt=\"Caf\u00e9 Expresso Logo\" style=\"max-width:160px;max-height:160px;border-radius:16px;border:3px solid #ff9800;margin:8px auto;display:block;object-fit:contain;background:#fff3e0;\">"
-        "<span class=\"badge\">Caf\u00e9 Expresso</span>"
-        "<h1>Café Expresso</h1>"
-        "<p class=\"subtitle\">Sistema Cognitivo de Cobrança Embarcada para pagamentos PIX</p>"
-        "<div class=\"grid\">"
-        "<div class=\"card\">"
-        "<h2>Sobre o Sistema</h2>"
-        "<p>Café Expresso é um sistema embarcado de cobrança via PIX com ESP32, "
-        "integrando display, serviço HTTP e motores/atuadores para automação de vendas.</p>"
-        "</div>"
-        "<div class=\"card\">"
-        "<h2>Endpoints Disponíveis</h2>"
-        "<div class=\"endpoints\">"
-        "<div class=\"endpoint\"><span>GET</span> /status - Status do dispositivo</div>"
-        "<div class=\"endpoint\"><span>GET</span> /addapikey?key=KEY - Configurar API Key</div>"
-        "</div>"
-        "</div>"
-        "</div>"
-        "<div class=\"card\">"
-        "<h2>Repositório do Projeto</h2>"
-        "<p>Código fonte disponível em:<br>"
-        "<a href=\"https://github.com/RapportTecnologia/esp32-pix-firmware\" target=\"_blank\">github.com/RapportTecnologia/esp32-pix-firmware</a></p>"
-        "</div>"
-        "<div class=\"footer\">"
-        "<p><a href=\"https://rapport.tec.br\" target=\"_blank\">rapport.tec.br</a></p>"
-        "<p>E-mail: <a href=\"mailto:admin@rapport.tec.br\">admin@rapport.tec.br</a></p>"
-        "<p>WhatsApp: <a href=\"https://wa.me/5585985205490\" target=\"_blank\">(+55 85) 98520-5490</a></p>"
-        "<p style=\"margin-top:10px;\">&copy; 2026 Café Expresso - Sistema Cognitivo de Cobrança Embarcada</p>"
-        "</div>"
-        "</div>"
-        "</div>"
-        "</body>"
-        "</html>";
-    
-    httpd_resp_set_type(req, "text/html");
+    uint32_t hash = 2166136261u;
+    for (const uint8_t *p = start; p < end; p++) {
+        hash = (hash ^ *p) * 16777619u;
+    }
+    snprintf(etag, size, "\"%08" PRIx32 "\"", hash);
+}
+
+static void static_asset_init(static_asset_t *asset)
+{
+    make_etag(asset->start, asset->end, asset->etag, sizeof(asset->etag));
+    if (asset->gz_start != NULL) {
+        make_etag(asset->gz_start, asset->gz_end, asset->gz_etag, sizeof(asset->gz_etag));
+    }
+}
+
+/**
+ * @brief Read a request header, possibly truncated to the buffer size
+ */
+static bool get_header(httpd_req_t *req, const char *name, char *buf, size_t size)
+{
+    esp_err_t err = httpd_req_get_hdr_value_str(req, name, buf, size);
+    return err == ESP_OK || err == ESP_ERR_HTTPD_RESULT_TRUNC;
+}
+
+/**
+ * @brief Handler for static assets (user_ctx is the static_asset_t)
+ */
+static esp_err_t static_asset_handler(httpd_req_t *req)
+{
+    static_asset_t *asset = req->user_ctx;
+    char hdr[STATIC_HDR_MAX];
+
+    ESP_LOGI(TAG, "GET %s", req->uri);
+
+    // Pick the representation first: each one has its own ETag
+    bool gzip = asset->gz_start != NULL &&
+                get_header(req, "Accept-Encoding", hdr, sizeof(hdr)) && strstr(hdr, "gzip") != NULL;
+    const uint8_t *data = gzip ? asset->gz_start : asset->start;
+    const uint8_t *end = gzip ? asset->gz_end : asset->end;
+    const char *etag = gzip ? asset->gz_etag : asset->etag;
+
     httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-    httpd_resp_send(req, html_page, HTTPD_RESP_USE_STRLEN);
-    
-    return ESP_OK;
+    httpd_resp_set_hdr(req, "ETag", etag);
+    httpd_resp_set_hdr(req, "Cache-Control", asset->cache_control);
+    if (asset->gz_start != NULL) {
+        httpd_resp_set_hdr(req, "Vary", "Accept-Encoding");
+    }
+
+    // A list of tags or "*" may be sent; a substring match covers both
+    if (get_header(req, "If-None-Match", hdr, sizeof(hdr)) &&
+        (strstr(hdr, etag) != NULL || strcmp(hdr, "*") == 0)) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
+    }
+
+    httpd_resp_set_type(req, asset->type);
+    if (gzip) {
+        httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    }
+
+    // Stream straight from flash in segment-sized chunks
+    while (data < end) {
+        size_t len = MIN((size_t)(end - data), STATIC_CHUNK_SIZE);
+        esp_err_t err = httpd_resp_send_chunk(req, (const char *)data, len);
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG, "Failed to send %s: %s", req->uri, esp_err_to_name(err));
+            return err;
+        }
+        data += len;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
 }
 
+// Tasks whose stack high-water mark /status reports
+static const char *const s_status_tasks[] = {
+    "main", "charge", "net_worker", "reconciler", "payment_watch", "servo", "httpd", "esp_timer", "tiT",
+};
+
+// Handlers run one at a time on the server task, so the status response
+// can be built in a static buffer instead of on the heap
+static char s_status_buf[1024];
+
 /**
  * @brief Handler for GET /status endpoint
  */
 static esp_err_t status_handler(httpd_req_t *req)
 {
-    ESP_LOGI(TAG, "GET /status");
-    
-    cJSON *root = cJSON_CreateObject();
-    cJSON_AddStringToObject(root, "status", "online");
-    cJSON_AddStringToObject(root, "device", "ESP32-PIX");
-    cJSON_AddBoolToObject(root, "api_key_set", strlen(s_api_key) > 0);
-    
-    char *json_str = cJSON_PrintUnformatted(root);
-    
+    ESP_LOGD(TAG, "GET /status");
+
+    telemetry_snapshot_t t;
+    telemetry_get(&t);
+
+    json_writer_t w;
+    json_writer_init(&w, s_status_buf, sizeof(s_status_buf));
+    json_writer_begin_object(&w, NULL);
+    json_writer_string(&w, "status", "online");
+    json_writer_string(&w, "device", "ESP32-PIX");
+    json_writer_bool(&w, "api_key_set", s_api_key[0] != '\0');
+    json_writer_int(&w, "uptime_s", esp_timer_get_time() / 1000000);
+    json_writer_string(&w, "state", t.state);
+
+    json_writer_begin_object(&w, "heap");
+    json_writer_int(&w, "free", esp_get_free_heap_size());
+    json_writer_int(&w, "min_free", esp_get_minimum_free_heap_size());
+    json_writer_int(&w, "largest_block", heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT));
+    json_writer_end_object(&w);
+
+    int8_t rssi;
+    json_writer_begin_object(&w, "wifi");
+    json_writer_bool(&w, "connected", wifi_manager_is_connected());
+    if (wifi_manager_get_rssi(&rssi) == ESP_OK) {
+        json_writer_int(&w, "rssi", rssi);
+    } else {
+        json_writer_null(&w, "rssi");
+    }
+    json_writer_end_object(&w);
+
+    // Free stack in bytes at the lowest point so far
+    json_writer_begin_object(&w, "stack_free_min");
+    for (size_t i = 0; i < sizeof(s_status_tasks) / sizeof(s_status_tasks[0]); i++) {
+        TaskHandle_t task = xTaskGetHandle(s_status_tasks[i]);
+        if (task != NULL) {
+            json_writer_int(&w, s_status_tasks[i], uxTaskGetStackHighWaterMark(task));
+        }
+    }
+    json_writer_end_object(&w);
+
+    json_writer_begin_object(&w, "charges");
+    json_writer_int(&w, "created", metrics_get(METRIC_CHARGES_CREATED) +
+                                   metrics_get(METRIC_CHARGES_BUILT));
+    json_writer_int(&w, "paid", metrics_get(METRIC_CHARGES_PAID));
+    json_writer_int(&w, "discarded", metrics_get(METRIC_CHARGES_DISCARDED));
+    json_writer_int(&w, "ready", charge_pool_count());
+    json_writer_int(&w, "unsettled", reconciler_count());
+    json_writer_int(&w, "late", metrics_get(METRIC_LATE_PAYMENTS));
+    json_writer_end_object(&w);
+
+    json_writer_begin_object(&w, "backend_latency_ms");
+    json_writer_int(&w, "samples", t.latency_samples);
+    json_writer_int(&w, "p50", t.latency_p50_ms);
+    json_writer_int(&w, "p90", t.latency_p90_ms);
+    json_writer_int(&w, "p99", t.latency_p99_ms);
+    json_writer_int(&w, "max", t.latency_max_ms);
+    json_writer_end_object(&w);
+
+    json_writer_end_object(&w);
+
+    size_t len;
+    const char *json = json_writer_finish(&w, &len);
+    if (json == NULL) {
+        ESP_LOGE(TAG, "Status response does not fit in %u bytes", (unsigned)sizeof(s_status_buf));
+        return httpd_resp_send_500(req);
+    }
+
     httpd_resp_set_type(req, "application/json");
     httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-    httpd_resp_send(req, json_str, strlen(json_str));
-    
-    free(json_str);
-    cJSON_Delete(root);
-    
-    return ESP_OK;
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    return httpd_resp_send(req, json, len);
+}
+
+static esp_err_t metrics_write_chunk(void *ctx, const char *text, size_t len)
+{
+    return httpd_resp_send_chunk((httpd_req_t *)ctx, text, len);
 }
 
+/**
+ * @brief Handler for GET /metrics endpoint (Prometheus text format)
+ */
+static esp_err_t metrics_handler(httpd_req_t *req)
+{
+    ESP_LOGD(TAG, "GET /metrics");
+
+    httpd_resp_set_type(req, "text/plain; version=0.0.4");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+
+    esp_err_t err = metrics_export(metrics_write_chunk, req);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Metrics export failed: %s", esp_err_to_name(err));
+        return err;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+#if CONFIG_ESP_PIX_TRACE
+static esp_err_t trace_write_chunk(void *ctx, const char *text, size_t len)
+{
+    return httpd_resp_send_chunk((httpd_req_t *)ctx, text, len);
+}
+
+/**
+ * @brief Handler for GET /trace endpoint (Chrome trace-event JSON)
+ */
+static esp_err_t trace_handler(httpd_req_t *req)
+{
+    ESP_LOGD(TAG, "GET /trace");
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=\"esp-pix-trace.json\"");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+
+    esp_err_t err = trace_export(trace_write_chunk, req);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Trace export failed: %s", esp_err_to_name(err));
+        return err;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+#endif
+
 /**
  * @brief Handler for GET /addapikey endpoint
  */
@@ -289,8 +440,8 @@ static esp_err_t addapikey_handler(httpd_req_t *req)
 static const httpd_uri_t uri_root = {
     .uri       = "/",
     .method    = HTTP_GET,
-    .handler   = root_handler,
-    .user_ctx  = NULL
+    .handler   = static_asset_handler,
+    .user_ctx  = &s_index_asset
 };
 
 static const httpd_uri_t uri_status = {
@@ -300,6 +451,22 @@ static const httpd_uri_t uri_status = {
     .user_ctx  = NULL
 };
 
+static const httpd_uri_t uri_metrics = {
+    .uri       = "/metrics",
+    .method    = HTTP_GET,
+    .handler   = metrics_handler,
+    .user_ctx  = NULL
+};
+
+#if CONFIG_ESP_PIX_TRACE
+static const httpd_uri_t uri_trace = {
+    .uri       = "/trace",
+    .method    = HTTP_GET,
+    .handler   = trace_handler,
+    .user_ctx  = NULL
+};
+#endif
+
 static const httpd_uri_t uri_addapikey = {
     .uri       = "/addapikey",
     .method    = HTTP_GET,
@@ -310,8 +477,8 @@ static const httpd_uri_t uri_addapikey = {
 static const httpd_uri_t uri_logo = {
     .uri       = "/rapport-pix-web.jpg",
     .method    = HTTP_GET,
-    .handler   = logo_handler,
-    .user_ctx  = NULL
+    .handler   = static_asset_handler,
+    .user_ctx  = &s_logo_asset
 };
 
 esp_err_t http_server_start(void)
@@ -324,6 +491,9 @@ esp_err_t http_server_start(void)
     // Load API key from NVS
     load_api_key_from_nvs();
 
+    static_asset_init(&s_index_asset);
+    static_asset_init(&s_logo_asset);
+
     // Get and print IP address
     char ip_str[16];
     if (wifi_manager_get_ip(ip_str, sizeof(ip_str)) == ESP_OK) {
@@ -333,6 +503,10 @@ esp_err_t http_server_start(void)
         ESP_LOGI(TAG, "Endpoints:");
         ESP_LOGI(TAG, "  - http://%s/", ip_str);
         ESP_LOGI(TAG, "  - http://%s/status", ip_str);
+        ESP_LOGI(TAG, "  - http://%s/metrics", ip_str);
+#if CONFIG_ESP_PIX_TRACE
+        ESP_LOGI(TAG, "  - http://%s/trace", ip_str);
+#endif
         ESP_LOGI(TAG, "  - http://%s/addapikey?key=YOUR_KEY", ip_str);
         ESP_LOGI(TAG, "============================================");
     } else {
@@ -354,6 +528,10 @@ esp_err_t http_server_start(void)
     // Register URI handlers
     httpd_register_uri_handler(s_server, &uri_root);
     httpd_register_uri_handler(s_server, &uri_status);
+    httpd_register_uri_handler(s_server, &uri_metrics);
+#if CONFIG_ESP_PIX_TRACE
+    httpd_register_uri_handler(s_server, &uri_trace);
+#endif
     httpd_register_uri_handler(s_server, &uri_addapikey);
     httpd_register_uri_handler(s_server, &uri_logo);
 
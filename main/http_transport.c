@@ -0,0 +1,198 @@
+#include <string.h>
+#include <stdio.h>
+#include "esp_log.h"
+#include "esp_http_client.h"
+#include "esp_timer.h"
+
+#include "http_transport.h"
+
+static const char *TAG = "http_transport";
+
+// Certificado CA embarcado (ISRG Root X1 - Let's Encrypt)
+extern const char isrg_root_x1_pem_start[] asm("_binary_isrg_root_x1_pem_start");
+extern const char isrg_root_x1_pem_end[]   asm("_binary_isrg_root_x1_pem_end");
+
+/**
+ * @brief Long-lived backend connection
+ *
+ * The TCP/TLS connection is kept alive between requests; after a drop it is
+ * reopened lazily on the next request, resuming the TLS session from the
+ * saved ticket when the server allows it.
+ */
+typedef struct {
+    esp_http_client_handle_t client;
+    const http_request_t *req;  // Request in progress, NULL between requests
+    http_response_t *resp;
+} transport_conn_t;
+
+static transport_conn_t s_conns[HTTP_CONN_COUNT];
+
+static esp_err_t http_event_handler(esp_http_client_event_t *evt)
+{
+    transport_conn_t *conn = evt->user_data;
+
+    switch (evt->event_id) {
+        case HTTP_EVENT_ERROR:
+            ESP_LOGD(TAG, "HTTP_EVENT_ERROR");
+            break;
+        case HTTP_EVENT_ON_CONNECTED:
+            ESP_LOGD(TAG, "HTTP_EVENT_ON_CONNECTED");
+            conn->resp->connected = true;
+            break;
+        case HTTP_EVENT_HEADER_SENT:
+            ESP_LOGD(TAG, "HTTP_EVENT_HEADER_SENT");
+            // Connected with the full timeout; wait for the response in slices
+            if (conn->req->abort != NULL) {
+                esp_http_client_set_timeout_ms(evt->client, HTTP_ABORT_SLICE_MS);
+            }
+            break;
+        case HTTP_EVENT_ON_HEADER:
+            ESP_LOGD(TAG, "HTTP_EVENT_ON_HEADER, key=%s, value=%s", evt->header_key, evt->header_value);
+            // A body read timing out is an error, not EAGAIN; give it the full timeout
+            if (conn->req->abort != NULL && !conn->resp->responded) {
+                esp_http_client_set_timeout_ms(evt->client, conn->req->timeout_ms);
+            }
+            conn->resp->responded = true;
+            break;
+        case HTTP_EVENT_ON_DATA:
+            ESP_LOGD(TAG, "HTTP_EVENT_ON_DATA, len=%d", evt->data_len);
+            conn->resp->responded = true;
+            json_stream_feed(conn->req->json, evt->data, evt->data_len);
+            break;
+        case HTTP_EVENT_ON_FINISH:
+            ESP_LOGD(TAG, "HTTP_EVENT_ON_FINISH");
+            break;
+        case HTTP_EVENT_DISCONNECTED:
+            ESP_LOGD(TAG, "HTTP_EVENT_DISCONNECTED");
+            break;
+        case HTTP_EVENT_REDIRECT:
+            ESP_LOGD(TAG, "HTTP_EVENT_REDIRECT");
+            break;
+    }
+    return ESP_OK;
+}
+
+esp_err_t http_transport_init(void)
+{
+    // esp_http_client keeps its socket to itself, so an abortable wait cannot
+    // be cut by shutting the socket down from http_abort_wait(); it polls in
+    // HTTP_ABORT_SLICE_MS reads instead, and esp_http_client warns on every
+    // slice that times out (some 75 times per long-poll). http_client.c logs
+    // failed requests itself, so only the library's errors are kept.
+    esp_log_level_set("HTTP_CLIENT", ESP_LOG_ERROR);
+    return ESP_OK;
+}
+
+// Client of a connection, created on first use
+static esp_http_client_handle_t get_client(transport_conn_t *conn, const char *url)
+{
+    if (conn->client != NULL) {
+        esp_http_client_set_url(conn->client, url);
+        return conn->client;
+    }
+
+    esp_http_client_config_t config = {
+        .url = url,
+        .event_handler = http_event_handler,
+        .user_data = conn,
+        .timeout_ms = HTTP_TIMEOUT_MS,
+        .cert_pem = isrg_root_x1_pem_start,
+        .transport_type = HTTP_TRANSPORT_OVER_SSL,
+        .keep_alive_enable = true,
+#if CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+        .save_client_session = true,
+#endif
+    };
+
+    conn->client = esp_http_client_init(&config);
+    if (conn->client == NULL) {
+        ESP_LOGE(TAG, "Failed to create HTTP client");
+    }
+    return conn->client;
+}
+
+/**
+ * @brief esp_http_client_perform(), abortable when the request is
+ *
+ * A read that times out while waiting for the response headers leaves the
+ * request pending and returns ESP_ERR_HTTP_EAGAIN; calling perform again
+ * resumes it. Between slices the abort flag and the deadline are checked.
+ * Once the headers arrive the event handler restores the full timeout, as
+ * the body is read in the same perform and cannot be resumed.
+ */
+static esp_err_t perform(esp_http_client_handle_t client, const http_request_t *req)
+{
+    if (req->abort == NULL) {
+        return esp_http_client_perform(client);
+    }
+
+    int64_t deadline = esp_timer_get_time() / 1000 + req->timeout_ms;
+    esp_err_t err;
+    do {
+        if (atomic_load(req->abort)) {
+            return ESP_ERR_INVALID_STATE;
+        }
+        err = esp_http_client_perform(client);
+    } while (err == ESP_ERR_HTTP_EAGAIN && esp_timer_get_time() / 1000 < deadline);
+
+    return err == ESP_ERR_HTTP_EAGAIN ? ESP_ERR_TIMEOUT : err;
+}
+
+esp_err_t http_transport_perform(http_conn_t id, const http_request_t *req,
+                                 http_response_t *resp)
+{
+    transport_conn_t *conn = &s_conns[id];
+
+    memset(resp, 0, sizeof(*resp));
+
+    char url[256];
+    if (snprintf(url, sizeof(url), "%s%s", CONFIG_ESP_PIX_BACKEND_URL, req->path) >= (int)sizeof(url)) {
+        ESP_LOGE(TAG, "URL too long");
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    esp_http_client_handle_t client = get_client(conn, url);
+    if (client == NULL) {
+        return ESP_FAIL;
+    }
+
+    conn->req = req;
+    conn->resp = resp;
+
+    bool post = strcmp(req->method, "POST") == 0;
+    esp_http_client_set_method(client, post ? HTTP_METHOD_POST : HTTP_METHOD_GET);
+    if (req->body != NULL) {
+        esp_http_client_set_header(client, "Content-Type", "application/json");
+        esp_http_client_set_post_field(client, req->body, strlen(req->body));
+    }
+    esp_http_client_set_timeout_ms(client, req->timeout_ms);
+
+    esp_err_t err = perform(client, req);
+    if (err == ESP_OK) {
+        resp->status_code = esp_http_client_get_status_code(client);
+    }
+
+    if (req->body != NULL) {
+        esp_http_client_set_post_field(client, NULL, 0);
+        esp_http_client_delete_header(client, "Content-Type");
+    }
+    esp_http_client_set_timeout_ms(client, HTTP_TIMEOUT_MS);
+    conn->req = NULL;
+    conn->resp = NULL;
+    return err;
+}
+
+void http_transport_disconnect(http_conn_t id)
+{
+    if (s_conns[id].client != NULL) {
+        esp_http_client_close(s_conns[id].client);
+    }
+}
+
+void http_transport_close(http_conn_t id)
+{
+    if (s_conns[id].client != NULL) {
+        esp_http_client_cleanup(s_conns[id].client);
+        s_conns[id].client = NULL;
+    }
+}
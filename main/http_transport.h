@@ -0,0 +1,78 @@
+#ifndef HTTP_TRANSPORT_H
+#define HTTP_TRANSPORT_H
+
+#include <stdbool.h>
+#include <stdatomic.h>
+#include "esp_err.h"
+#include "json_stream.h"
+
+// Limit of a request unless the caller gives a shorter one
+#define HTTP_TIMEOUT_MS         10000
+
+// Longest an abortable request takes to notice its abort flag
+#define HTTP_ABORT_SLICE_MS     200
+
+/**
+ * @brief Kept-alive connections to the backend
+ */
+typedef enum {
+    HTTP_CONN_API,              // Network worker: charges, status checks, cancels
+    HTTP_CONN_WATCH,            // Payment watcher's long-polls
+    HTTP_CONN_COUNT
+} http_conn_t;
+
+/**
+ * @brief One request, as built by http_client.c
+ */
+typedef struct {
+    const char *method;         // "GET" or "POST"
+    const char *path;           // Below the backend URL, e.g. /status/<id>
+    const char *body;           // JSON body, NULL for none
+    int timeout_ms;             // Whole request, connection included
+    const atomic_bool *abort;   // Checked while waiting for the response, NULL if not abortable
+    json_stream_t *json;        // Fed with the response body as it arrives
+} http_request_t;
+
+/**
+ * @brief What came back of a request
+ *
+ * connected and responded are set even when the request fails; they tell
+ * whether resending it is safe.
+ */
+typedef struct {
+    int status_code;
+    bool connected;             // A new connection was opened for it
+    bool responded;             // Part of a response arrived
+} http_response_t;
+
+/**
+ * @brief Prepare the transport; called by http_client_init()
+ */
+esp_err_t http_transport_init(void);
+
+/**
+ * @brief Send a request on a connection and read the whole response
+ *
+ * Reuses the connection left open by the previous request, opening one if
+ * needed. Requests on one connection must not overlap.
+ *
+ * @return ESP_OK once the response was read, whatever its status code;
+ *         ESP_ERR_INVALID_STATE if aborted, ESP_ERR_TIMEOUT, or another
+ *         error if the connection failed
+ */
+esp_err_t http_transport_perform(http_conn_t conn, const http_request_t *req,
+                                 http_response_t *resp);
+
+/**
+ * @brief Drop the connection after a failed request
+ *
+ * The next request reconnects, resuming the TLS session where possible.
+ */
+void http_transport_disconnect(http_conn_t conn);
+
+/**
+ * @brief Close the connection and free everything it holds
+ */
+void http_transport_close(http_conn_t conn);
+
+#endif // HTTP_TRANSPORT_H
@@ -0,0 +1,89 @@
+#include <string.h>
+#include <stdbool.h>
+
+#include "image_codec.h"
+
+enum {
+    OP_LITERAL = 0,
+    OP_RUN = 1,
+    OP_COPY = 2,
+};
+
+static inline uint16_t swap16(uint16_t v)
+{
+    return (v >> 8) | (v << 8);
+}
+
+void image_decoder_init(image_decoder_t *dec, const image_t *image)
+{
+    dec->image = image;
+    dec->pos = 0;
+    dec->row = 0;
+}
+
+// Read one pixel value at pos, returned byte-swapped
+static bool read_pixel(const image_t *img, uint32_t *pos, uint16_t *px)
+{
+    const uint8_t *p = &img->data[*pos];
+
+    if (img->format == IMAGE_FORMAT_INDEXED8) {
+        if (*pos + 1 > img->data_size || p[0] >= img->palette_size) return false;
+        *px = swap16(img->palette[p[0]]);
+        *pos += 1;
+    } else {
+        if (*pos + 2 > img->data_size) return false;
+        // Stored big-endian, which is already the panel byte order
+        *px = p[0] | (p[1] << 8);
+        *pos += 2;
+    }
+    return true;
+}
+
+esp_err_t image_decode_row(image_decoder_t *dec, const uint16_t *prev, uint16_t *out)
+{
+    const image_t *img = dec->image;
+    uint32_t pos = dec->pos;
+    int x = 0;
+
+    if (dec->row >= img->height) return ESP_ERR_INVALID_STATE;
+
+    while (x < img->width) {
+        if (pos >= img->data_size) return ESP_ERR_INVALID_SIZE;
+
+        uint8_t op = img->data[pos] >> 6;
+        int count = (img->data[pos] & 0x3F) + 1;
+        pos++;
+        if (count == 64) {
+            if (pos >= img->data_size) return ESP_ERR_INVALID_SIZE;
+            count += img->data[pos++];
+        }
+        if (count > img->width - x) return ESP_ERR_INVALID_SIZE;
+
+        switch (op) {
+        case OP_LITERAL:
+            for (int i = 0; i < count; i++) {
+                if (!read_pixel(img, &pos, &out[x + i])) return ESP_ERR_INVALID_SIZE;
+            }
+            break;
+        case OP_RUN: {
+            uint16_t px;
+            if (!read_pixel(img, &pos, &px)) return ESP_ERR_INVALID_SIZE;
+            for (int i = 0; i < count; i++) {
+                out[x + i] = px;
+            }
+            break;
+        }
+        case OP_COPY:
+            if (prev == NULL) return ESP_ERR_INVALID_SIZE;
+            memcpy(&out[x], &prev[x], count * sizeof(uint16_t));
+            break;
+        default:
+            return ESP_ERR_INVALID_SIZE;
+        }
+        x += count;
+    }
+
+    dec->pos = pos;
+    dec->row++;
+    return ESP_OK;
+}
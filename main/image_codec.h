@@ -0,0 +1,70 @@
+#ifndef IMAGE_CODEC_H
+#define IMAGE_CODEC_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+/**
+ * @brief Pixel encoding of a compressed image
+ */
+typedef enum {
+    IMAGE_FORMAT_INDEXED8,  // One-byte palette indices
+    IMAGE_FORMAT_RGB565,    // Big-endian RGB565 values, two bytes each
+} image_format_t;
+
+/**
+ * @brief Compressed image asset generated by tools/convert_logo_rgb565.py
+ *
+ * Rows are coded top to bottom as a sequence of operations that never
+ * cross a row boundary. Each operation starts with a byte holding the
+ * opcode in bits 7..6 and the pixel count minus one in bits 5..0; a value
+ * of 63 there means the count is 64 plus the next byte.
+ *
+ *   0 literal: count pixel values follow
+ *   1 run:     one pixel value follows, repeated count times
+ *   2 copy:    count pixels are copied from the row above
+ *
+ * Decoding only needs the previous row, so images can be streamed to the
+ * panel without a full-image buffer.
+ */
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint8_t format;            // image_format_t
+    uint16_t palette_size;
+    const uint16_t *palette;   // RGB565, IMAGE_FORMAT_INDEXED8 only
+    const uint8_t *data;
+    uint32_t data_size;
+} image_t;
+
+/**
+ * @brief Row-by-row decoder state
+ */
+typedef struct {
+    const image_t *image;
+    uint32_t pos;     // Next byte of image->data
+    uint16_t row;     // Next row to decode
+} image_decoder_t;
+
+/**
+ * @brief Start decoding an image from its first row
+ * @param dec Decoder state
+ * @param image Image to decode
+ */
+void image_decoder_init(image_decoder_t *dec, const image_t *image);
+
+/**
+ * @brief Decode the next row
+ *
+ * Pixels are written byte-swapped (big-endian RGB565), the order the
+ * panel expects them in.
+ *
+ * @param dec Decoder state
+ * @param prev Previously decoded row, NULL for the first row
+ * @param out Output row, image->width pixels; may not overlap prev
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE when all rows were
+ *         decoded, ESP_ERR_INVALID_SIZE if the data is corrupt
+ */
+esp_err_t image_decode_row(image_decoder_t *dec, const uint16_t *prev, uint16_t *out);
+
+#endif // IMAGE_CODEC_H
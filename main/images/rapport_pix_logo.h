@@ -1,920 +1,339 @@
-// Generated from rapport-pix.png
+// Generated from rapport-pix.png by tools/convert_logo_rgb565.py
 #ifndef RAPPORT_PIX_LOGO_H
 #define RAPPORT_PIX_LOGO_H
 
-#include <stdint.h>
+#include "image_codec.h"
 
 #define RAPPORT_PIX_LOGO_WIDTH  128
 #define RAPPORT_PIX_LOGO_HEIGHT 85
 
-static const uint16_t RAPPORT_PIX_LOGO_DATA[] = {
-    0xE420, 0xE420, 0xE420, 0xE421, 0xE421, 0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 0xEC41, 0xEC41, 
-    0xEC41, 0xEC41, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC81, 
-    0xEC81, 0xEC81, 0xEC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF4A2, 
-    0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 
-    0xF4A2, 0xF4A2, 0xF4A2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4E3, 0xF4C3, 0xF4E3, 
-    0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 
-    0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4C3, 0xF4C3, 0xF4C3, 
-    0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 
-    0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF482, 0xEC82, 0xE420, 0xE420, 0xE421, 0xE441, 
-    0xE441, 0xE441, 0xE441, 0xE441, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xF481, 0xF481, 0xF481, 
-    0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF482, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 
-    0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C3, 0xF4C3, 
-    0xF4C3, 0xF4C3, 0xF4E3, 0xF4C3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 
-    0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 
-    0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4C3, 0xF4E3, 0xF4C3, 0xF4C3, 0xF4C3, 
-    0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 
-    0xF4A2, 0xF4A2, 0xF4A2, 0xF482, 0xE420, 0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 0xEC41, 0xEC41, 
-    0xEC41, 0xEC41, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC81, 0xEC81, 0xEC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF4A2, 0xF4A2, 0xF4A2, 
-    0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 
-    0xF4A2, 0xF4A2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 
-    0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 
-    0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 
-    0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4C3, 0xF4E3, 0xF4C3, 0xF4C3, 
-    0xF4C3, 0xF4C3, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 
-    0xE441, 0xE441, 0xE441, 0xE441, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xF481, 0xF481, 
-    0xF481, 0xF481, 0xF481, 0xF481, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 
-    0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 
-    0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 
-    0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4E3, 0xF4E3, 
-    0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 
-    0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4C3, 0xF4C3, 0xF4C3, 0xF4C3, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xE441, 0xE441, 0xEC41, 0xEC41, 
-    0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF4A1, 0xF4A2, 
-    0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4C2, 0xEC82, 0xF4C3, 0xF4E3, 
-    0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF503, 0xF4E3, 0xF4E3, 0xF4E3, 0xF503, 0xF503, 0xF503, 
-    0xF503, 0xF503, 0xF503, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 
-    0xF504, 0xF524, 0xF524, 0xF524, 0xF524, 0xF524, 0xF524, 0xF524, 0xF524, 0xF524, 0xF524, 0xF525, 
-    0xF525, 0xF524, 0xF525, 0xF525, 0xF525, 0xF525, 0xF4C3, 0xF4C3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 
-    0xF4E3, 0xF4E3, 0xFCE3, 0xF4E3, 0xF4E3, 0xFCE3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 
-    0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4C3, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4A2, 0xF4A2, 0xF4A2, 
-    0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xE441, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC61, 0xEC61, 
-    0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC81, 0xEC81, 0xEC81, 0xF481, 0xF481, 
-    0xF481, 0xF481, 0xF481, 0xF481, 0xF4A1, 0xF4A1, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 
-    0xF4A2, 0xF4A2, 0xF4C2, 0xF4A2, 0xD402, 0xECE2, 0xFD83, 0xFD83, 0xFD83, 0xFD83, 0xFD83, 0xFD83, 
-    0xFD83, 0xFD83, 0xFDA3, 0xFDA3, 0xFDA3, 0xFDA3, 0xFDA3, 0xFDA4, 0xFDA4, 0xFDA4, 0xFDA4, 0xFDC4, 
-    0xFDC4, 0xFDC4, 0xFDC4, 0xFDC4, 0xFDC4, 0xFDC4, 0xFDC5, 0xFDE5, 0xFDE5, 0xFDE5, 0xFDE5, 0xFDE5, 
-    0xFDE5, 0xFDE5, 0xFDE5, 0xFDE5, 0xFE05, 0xFE06, 0xFE06, 0xFE06, 0xFE06, 0xFE06, 0xFE06, 0xFE06, 
-    0xFE26, 0xFE48, 0xF609, 0xF525, 0xF4C3, 0xF4E3, 0xF4E3, 0xF4E3, 0xFCE3, 0xF4E3, 0xF4E3, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xF4E3, 0xF4E3, 0xFCE3, 0xFCE3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 
-    0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4C3, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 
-    0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC61, 0xEC61, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF4A1, 
-    0xF4A1, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4C2, 0xEC62, 0xD3C1, 0xAAE0, 
-    0xDC61, 0xFDA2, 0xFD62, 0xFD62, 0xFD82, 0xFD82, 0xFD82, 0xFD82, 0xFD82, 0xFDA2, 0xFDA2, 0xFDA2, 
-    0xFDA2, 0xFDA2, 0xFDA3, 0xFDA3, 0xFDA3, 0xFDA3, 0xFDC3, 0xFDC3, 0xFDC3, 0xFDC3, 0xFDC3, 0xFDC3, 
-    0xFDC3, 0xFDC3, 0xFDE4, 0xFDE4, 0xFDE4, 0xFDE4, 0xFDE4, 0xFDE4, 0xFDE4, 0xFDE4, 0xFDE4, 0xFE04, 
-    0xFE04, 0xFE04, 0xFE05, 0xFE05, 0xFE05, 0xFE05, 0xFE05, 0xFE25, 0xFE05, 0xFDE5, 0xFE46, 0xFE8A, 
-    0xF564, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xF4E3, 0xFCE3, 0xFCE3, 0xF4E3, 0xF4E3, 0xF4E3, 
-    0xF4E3, 0xF4E3, 0xF4E3, 0xF4E2, 0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 
-    0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC81, 0xEC81, 0xEC81, 
-    0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF4A1, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 
-    0xF4A2, 0xF4A2, 0xF4A2, 0xF4C2, 0xD3C1, 0xAAC0, 0xA280, 0xB321, 0xFDA2, 0xFD62, 0xFD82, 0xFD62, 
-    0xE4C2, 0xE4E2, 0xE4E2, 0xE4E2, 0xE4E2, 0xE4E2, 0xE4E2, 0xE4E2, 0xE4E2, 0xE4E2, 0xE502, 0xE502, 
-    0xE502, 0xE502, 0xE503, 0xE503, 0xE503, 0xE503, 0xE503, 0xE503, 0xE503, 0xE523, 0xE523, 0xE523, 
-    0xE523, 0xE523, 0xE523, 0xE523, 0xE523, 0xE523, 0xE524, 0xE524, 0xE524, 0xE524, 0xE524, 0xE524, 
-    0xE544, 0xE544, 0xE544, 0xE544, 0xFDC5, 0xFE46, 0xFDE5, 0xFE48, 0xF648, 0xFDA2, 0xF523, 0xF4E3, 
-    0xF4E3, 0xF4E3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 0xF4E3, 
-    0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4A2, 0xF4A2, 0xF4A2, 0xEC41, 0xEC41, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC81, 0xEC81, 0xEC81, 0xF481, 0xF481, 0xF481, 0xF481, 
-    0xF481, 0xF481, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4C2, 0xE442, 
-    0xA2A1, 0xAAE1, 0x9A81, 0xC3E1, 0xFDA2, 0xFD82, 0xDCA2, 0x4961, 0x30C1, 0x38E1, 0x38E1, 0x38E1, 
-    0x38E1, 0x38E1, 0x38E1, 0x38E1, 0x38E1, 0x38E1, 0x38E1, 0x38E1, 0x3901, 0x38E1, 0x38E1, 0x38E1, 
-    0x38E1, 0x3901, 0x3901, 0x3901, 0x3901, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 
-    0x4121, 0x4122, 0x4122, 0x4122, 0x4122, 0x4122, 0x4122, 0x4122, 0x4122, 0x4922, 0x4942, 0x4142, 
-    0x4961, 0xCC83, 0xFE46, 0xFE06, 0xF628, 0xFDC2, 0xFDE2, 0xFD62, 0xF4E3, 0xF4E3, 0xFCE3, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xF4E3, 0xF4E2, 0xF4E2, 0xF4E2, 0xF4E2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4A2, 0xF4A2, 
-    0xEC41, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC81, 0xEC81, 0xEC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4C2, 0xCB81, 0xA280, 0xAAC0, 0x9A40, 0xCBE1, 
-    0xFDA2, 0xFDA2, 0x6222, 0x2061, 0x38E1, 0x38E1, 0x38E1, 0x38E1, 0x38E1, 0x38E1, 0x38E1, 0x38E1, 
-    0x4101, 0x4102, 0x4101, 0x4102, 0x38C1, 0x4101, 0x4102, 0x4102, 0x4122, 0x4122, 0x4122, 0x4122, 
-    0x4922, 0x4922, 0x4922, 0x4922, 0x4942, 0x4942, 0x4942, 0x4942, 0x4943, 0x4942, 0x4943, 0x5163, 
-    0x4943, 0x5163, 0x5163, 0x5163, 0x5163, 0x5163, 0x5163, 0x5183, 0x4123, 0x5181, 0xFDE5, 0xFE26, 
-    0xF606, 0xF5A2, 0xFDC2, 0xFDA1, 0xFD23, 0xF4E3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xF4E3, 0xFCE3, 0xF4E2, 0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4A2, 0xF4A2, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xF481, 
-    0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A2, 0xF4A2, 0xF4A2, 
-    0xF4A2, 0xF4A2, 0xF4C2, 0xC341, 0xA280, 0xB2C0, 0x9A20, 0xC3C1, 0xFDA2, 0xF563, 0x51A3, 0x30C1, 
-    0x38E1, 0x38E1, 0x3080, 0x38C0, 0x3901, 0x38E1, 0x38C1, 0x4101, 0x38C0, 0x30A0, 0x38C1, 0x38E1, 
-    0x6A66, 0x4122, 0x4101, 0x38C1, 0x38C0, 0x40E1, 0x4101, 0x4102, 0x40E1, 0x40E1, 0x38C1, 0x4922, 
-    0x4101, 0x40E1, 0x4922, 0x4101, 0x40E1, 0x4922, 0x4922, 0x40E1, 0x5162, 0x4922, 0x4101, 0x5163, 
-    0x4942, 0x4101, 0x4942, 0x5163, 0x5163, 0x4962, 0xED85, 0xFE46, 0xF5E6, 0xF5A2, 0xFDC2, 0xFDA1, 
-    0xFD42, 0xF4E3, 0xFD03, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xF4E2, 0xF4E2, 0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4A2, 0xF4A2, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC61, 0xEC61, 0xEC61, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 
-    0xF481, 0xF481, 0xF4A1, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4C2, 0xC340, 
-    0xAA80, 0xB2C0, 0x9A20, 0xC3E1, 0xFDA2, 0xF563, 0x51C3, 0x30C1, 0x38C1, 0x3901, 0x72C8, 0x51A4, 
-    0x30A0, 0x4943, 0x4963, 0x38C1, 0x5A05, 0x72C8, 0x5183, 0x72C8, 0xA48E, 0x4102, 0x4101, 0x6226, 
-    0x72A7, 0x6205, 0x5163, 0x4942, 0x59E5, 0x6225, 0x72A7, 0x4122, 0x6225, 0x72C8, 0x4922, 0x6205, 
-    0x7AE8, 0x59A4, 0x6205, 0x7AE8, 0x4922, 0x6205, 0x7AE8, 0x4942, 0x5183, 0x8329, 0x59C4, 0x4922, 
-    0x5163, 0x5162, 0xED85, 0xFE46, 0xF5E7, 0xF5A2, 0xFDC2, 0xFDA1, 0xFD42, 0xF4E3, 0xFD03, 0xFD03, 
-    0xFD03, 0xFCE3, 0xFCE3, 0xFD03, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xF4E2, 0xF4E2, 
-    0xF4E2, 0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4A2, 
-    0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4C2, 0xC340, 0xAA60, 0xB2C0, 0x9A20, 0xC3E1, 
-    0xFDA2, 0xFD63, 0x51A3, 0x30A1, 0x38E1, 0xACAE, 0x9C4D, 0xBD50, 0x4123, 0x9C0C, 0xC550, 0x30A0, 
-    0xCD91, 0x836A, 0x7AE8, 0xC550, 0x7B09, 0x4942, 0x4942, 0xCD91, 0x8B8A, 0x72A7, 0xB4AE, 0xAC8E, 
-    0x8329, 0xBCEF, 0xA46E, 0xA42D, 0xB4CF, 0xA48E, 0xA42D, 0xB4EF, 0x9C0C, 0x7AE8, 0xC550, 0xA42C, 
-    0x8309, 0xC530, 0xA44D, 0x7AC8, 0xB4CF, 0xA46D, 0xC530, 0x61E4, 0x4942, 0x5162, 0xED85, 0xFE46, 
-    0xF5E7, 0xF5A2, 0xFDC2, 0xFDA1, 0xFD42, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFCE3, 0xFD03, 0xFD03, 0xFD03, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE2, 0xF4E2, 0xF4E2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4A2, 0xEC41, 0xEC41, 0xEC61, 0xEC61, 
-    0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC81, 0xEC81, 
-    0xEC81, 0xEC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF4A1, 0xF4A2, 0xF4A2, 0xF4A2, 
-    0xF4A2, 0xF4A2, 0xF4C2, 0xC340, 0xAA60, 0xB2C0, 0x9A20, 0xC3C1, 0xFDA2, 0xFD63, 0x51C3, 0x2860, 
-    0x6225, 0xACAE, 0x1800, 0x4101, 0x4963, 0xAC8E, 0xB4EF, 0x59C4, 0xBD30, 0x8BAB, 0x6A46, 0xC571, 
-    0x8329, 0x40E1, 0x4942, 0xC550, 0x93CB, 0x3080, 0xA42C, 0xCD91, 0x38A0, 0xBD10, 0x93EC, 0xAC8E, 
-    0xAC8D, 0x93EC, 0xA44D, 0xB4CE, 0x9C2D, 0x6205, 0xAC6D, 0x93CB, 0x59C4, 0xAC8E, 0x938A, 0x8B6A, 
-    0xAC6D, 0x2000, 0x9BCB, 0x93AB, 0x40E1, 0x5182, 0xED84, 0xFE46, 0xF5E6, 0xF5A2, 0xFDC2, 0xFDA1, 
-    0xFD42, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE2, 0xF4E2, 0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4A2, 0xEC41, 0xEC41, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 
-    0xEC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF482, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4C2, 0xC340, 
-    0xAA80, 0xB2C0, 0x9A20, 0xC3C1, 0xFDA2, 0xFD63, 0x51A3, 0x30A0, 0x4963, 0xBD30, 0x6226, 0x8B8A, 
-    0x93CB, 0xC571, 0xBD50, 0x9C0C, 0xBCEF, 0x6226, 0x6A46, 0xCD71, 0x72C8, 0x4122, 0x4942, 0xCD91, 
-    0x8329, 0x59C4, 0xB4CF, 0xC551, 0x7287, 0xC571, 0x8329, 0x5163, 0xBD0F, 0xCDB2, 0x7AE8, 0xBCEF, 
-    0x93CB, 0x6A46, 0x8329, 0xBD30, 0xA44D, 0x72A8, 0xBD10, 0xB4CF, 0xB4CF, 0x6A46, 0xBD10, 0x72A7, 
-    0x4902, 0x5182, 0xED84, 0xFE26, 0xF5E6, 0xF5A2, 0xFDC2, 0xFDA1, 0xFD42, 0xF4E3, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 
-    0xFCE2, 0xFCE2, 0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xF481, 
-    0xF481, 0xF481, 0xF482, 0xF482, 0xF4A2, 0xEC82, 0xF4A2, 0xC340, 0xAA80, 0xB2C0, 0x9A20, 0xC3C1, 
-    0xFDA2, 0xF563, 0x51A3, 0x30C1, 0x30A0, 0x6246, 0xACCF, 0x8329, 0x72A7, 0x51C4, 0x4963, 0x7B29, 
-    0x72C8, 0x30A0, 0x4943, 0x9C0C, 0x93CB, 0x4942, 0x4101, 0x93CB, 0x93CB, 0x7AE8, 0x6A67, 0x61E5, 
-    0x8329, 0x72C8, 0x38C0, 0x4942, 0x7AC8, 0x61E5, 0x7AC8, 0x8329, 0x9C2D, 0x6A66, 0x93CB, 0xA42D, 
-    0x59E5, 0x9BEB, 0xA44D, 0x5184, 0x7AC8, 0xB4EF, 0x8329, 0x4922, 0x5163, 0x5162, 0xED84, 0xFE26, 
-    0xF5E6, 0xF5A2, 0xFDC2, 0xFDA1, 0xFD42, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFCE3, 0xFD03, 0xFD03, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE2, 0xFCE2, 0xF4E2, 0xF4E2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xE441, 0xE441, 0xE441, 0xE441, 
-    0xE441, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC82, 
-    0xEC82, 0xEC82, 0xF4A2, 0xC340, 0xAA80, 0xB2C0, 0x9A20, 0xC3C1, 0xFDA2, 0xFD63, 0x51A2, 0x30C1, 
-    0x4101, 0x30A0, 0x3080, 0x30A0, 0x38C0, 0x38E1, 0x38E1, 0x38A0, 0x38C0, 0x4101, 0x4101, 0x38A0, 
-    0x38A0, 0x4101, 0x4101, 0x38A0, 0x38C0, 0x40E1, 0x40E1, 0x4101, 0x40E1, 0x40E1, 0x4942, 0x4922, 
-    0x4101, 0x4922, 0x4101, 0x4101, 0x40E1, 0x4922, 0x40E1, 0x4101, 0x4922, 0x4101, 0x4101, 0x4942, 
-    0x4922, 0x40E1, 0x4922, 0x5163, 0x5163, 0x4962, 0xED84, 0xFE26, 0xF5E6, 0xF5A2, 0xFDC2, 0xFDA1, 
-    0xFD42, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xFCE3, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 
-    0xE441, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC61, 0xEC61, 0xEC61, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC82, 0xF4A2, 0xC340, 
-    0xAA80, 0xB2C0, 0x9A20, 0xC3C1, 0xFD82, 0xFDA3, 0x82E4, 0x2040, 0x30A1, 0x30A1, 0x30C1, 0x30A1, 
-    0x30A1, 0x30A1, 0x30A1, 0x38C1, 0x38C1, 0x30A1, 0x38C1, 0x38C1, 0x38C1, 0x38C1, 0x38C1, 0x38E1, 
-    0x38E1, 0x38C1, 0x38E1, 0x38E1, 0x38E1, 0x38E1, 0x38E1, 0x38E1, 0x40E2, 0x40E2, 0x4102, 0x4102, 
-    0x4102, 0x4102, 0x4102, 0x4102, 0x4102, 0x4922, 0x4922, 0x4102, 0x4922, 0x4922, 0x4922, 0x4922, 
-    0x38E2, 0x6A22, 0xFE05, 0xFE05, 0xF5E6, 0xF5A2, 0xFDC2, 0xFDA1, 0xFD42, 0xF4E3, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xF4E2, 0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 
-    0xE441, 0xE441, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC61, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xECA2, 0xC340, 0xAA80, 0xB2C0, 0x9A40, 0xC3C1, 
-    0xFDA2, 0xFD62, 0xF564, 0x8304, 0x6203, 0x6223, 0x6223, 0x6223, 0x6223, 0x6223, 0x6223, 0x6223, 
-    0x6223, 0x6223, 0x6223, 0x6A23, 0x6A23, 0x6A23, 0x6A43, 0x6A43, 0x6A43, 0x6A43, 0x6A43, 0x6A43, 
-    0x6A43, 0x6A44, 0x6A44, 0x6A64, 0x6A64, 0x6A64, 0x7264, 0x7264, 0x7264, 0x7264, 0x7264, 0x7264, 
-    0x7284, 0x7284, 0x7284, 0x7284, 0x7284, 0x7284, 0x7284, 0x7264, 0x82E4, 0xE564, 0xFE05, 0xFE05, 
-    0xF5E6, 0xF582, 0xFDC2, 0xFDA1, 0xFD62, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xF4E2, 
-    0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xE421, 0xE420, 0xE421, 0xE421, 
-    0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE441, 0xE441, 0xE441, 
-    0xE441, 0xEC41, 0xEC41, 0xEC41, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC61, 0xEC61, 0xEC82, 0xC340, 0xAA80, 0xB2C0, 0x9A40, 0xC3C1, 0xFDA2, 0xFD62, 0xFD62, 0xFDA2, 
-    0xFDC3, 0xFDC3, 0xFDC3, 0xFDC3, 0xFDC3, 0xFDC3, 0xFDC3, 0xFDC3, 0xFDE3, 0xFDE3, 0xFDE3, 0xFDE3, 
-    0xFDE3, 0xFDE4, 0xFDE4, 0xFDE4, 0xFE04, 0xFE04, 0xFE04, 0xFE04, 0xFE04, 0xFE04, 0xFE04, 0xFE04, 
-    0xFDE4, 0xFE04, 0xFE04, 0xFE05, 0xFE05, 0xFE25, 0xFE25, 0xFE25, 0xFE45, 0xFE45, 0xFE45, 0xFE45, 
-    0xFE45, 0xFE45, 0xFE46, 0xFE45, 0xFE45, 0xFE05, 0xFDE5, 0xFE05, 0xF5E6, 0xF582, 0xFDC2, 0xFDA1, 
-    0xFD62, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xFCE3, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xE420, 0xE421, 0xE420, 0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 
-    0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE441, 0xE441, 0xE441, 0xE441, 
-    0xE441, 0xEC41, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC82, 0xC340, 
-    0xAA80, 0xB2C0, 0x9A40, 0xC3C1, 0xFDA2, 0xFD62, 0xFD82, 0xFD62, 0xED01, 0xECE1, 0xECE1, 0xED02, 
-    0xED01, 0xED02, 0xED02, 0xED02, 0xED02, 0xED02, 0xED02, 0xED02, 0xED22, 0xED22, 0xF522, 0xED22, 
-    0xF522, 0xF522, 0xF542, 0xED42, 0xED42, 0xF542, 0xED43, 0xFD63, 0xFDE3, 0xFDA3, 0xFDA3, 0xFDC3, 
-    0xFDE3, 0xED43, 0xED43, 0xED43, 0xED43, 0xED44, 0xED44, 0xED44, 0xED44, 0xED44, 0xED44, 0xED44, 
-    0xED64, 0xFE05, 0xFDE5, 0xFE05, 0xF5E6, 0xF582, 0xFDC2, 0xFDA1, 0xFD62, 0xF4E3, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFCE3, 0xFD03, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xE420, 0xE420, 0xE420, 0xE400, 0xE400, 0xE400, 0xE400, 0xE400, 0xE401, 0xE401, 0xE421, 0xE421, 
-    0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 
-    0xEC41, 0xEC41, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC82, 0xC340, 0xAA80, 0xBAC0, 0x9A40, 0xC3C1, 
-    0xFDA2, 0xFD62, 0xF542, 0x6201, 0x28C1, 0x30E1, 0x30E1, 0x30E1, 0x3101, 0x3101, 0x3101, 0x3101, 
-    0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 
-    0x3101, 0x3101, 0x3101, 0x3922, 0xB403, 0xFDE3, 0xFDA3, 0xFDA3, 0x8AC2, 0x5142, 0x5162, 0x5162, 
-    0x5162, 0x5162, 0x5162, 0x5162, 0x5162, 0x5983, 0x5983, 0x5983, 0x5983, 0xA383, 0xFE04, 0xFE05, 
-    0xF5E6, 0xF582, 0xFDC2, 0xFDA1, 0xFD62, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xE400, 0xE400, 0xE400, 0xDC00, 
-    0xDC00, 0xDC00, 0xDC00, 0xDC00, 0xDC00, 0xDC00, 0xE400, 0xE400, 0xE401, 0xE401, 0xE401, 0xE421, 
-    0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 0xEC41, 
-    0xEC41, 0xE441, 0xEC61, 0xC320, 0xAA80, 0xBAC0, 0x9A40, 0xC3C1, 0xFDA2, 0xFDA2, 0xA382, 0x0021, 
-    0x18A1, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 
-    0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1061, 0x1060, 0x1041, 0x0840, 0x1061, 0x1882, 
-    0x3942, 0xF563, 0xFE03, 0xC443, 0x30C2, 0x4942, 0x4942, 0x4942, 0x4942, 0x4942, 0x4942, 0x4943, 
-    0x4942, 0x4902, 0x4101, 0x4922, 0x4963, 0x4923, 0xE504, 0xFE25, 0xF5C6, 0xF582, 0xFDC2, 0xFDA1, 
-    0xFD42, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFCE3, 0xFCE3, 0xFCE3, 
-    0xFCE3, 0xFCE3, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xF4E2, 0xF4E2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xDC00, 0xDC00, 0xDC00, 0xDC00, 0xDC00, 0xDC00, 0xDC00, 0xDC00, 
-    0xDC00, 0xDC00, 0xDC00, 0xDC00, 0xDC00, 0xDC00, 0xDC01, 0xDC01, 0xE401, 0xE401, 0xE421, 0xE421, 
-    0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 0xEC61, 0xC320, 
-    0xAA80, 0xBAC0, 0x9A40, 0xC3C1, 0xFD82, 0xFDA2, 0x8B22, 0x1061, 0x20C1, 0x0820, 0x0820, 0x0820, 
-    0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 
-    0x1040, 0x1040, 0x1040, 0x1040, 0x0820, 0x0820, 0x0000, 0x18A1, 0x3122, 0xE503, 0xFE23, 0xABE4, 
-    0x38E2, 0x5142, 0x4942, 0x5142, 0x5162, 0x5142, 0x5162, 0x5142, 0x5183, 0x72C8, 0x834A, 0x6A26, 
-    0x5163, 0x4943, 0xD4C4, 0xFE45, 0xEDC6, 0xF582, 0xFDC2, 0xFDA1, 0xFD62, 0xF4E3, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xF4E2, 0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xDC00, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 
-    0xDBE0, 0xDBE0, 0xDC00, 0xDC01, 0xDC01, 0xDC01, 0xDC01, 0xE401, 0xE401, 0xE421, 0xE421, 0xE421, 
-    0xE421, 0xE421, 0xE441, 0xE441, 0xE441, 0xE441, 0xEC61, 0xC320, 0xAA80, 0xBAC0, 0x9A40, 0xC3C1, 
-    0xFD82, 0xFDA2, 0x9322, 0x1061, 0x20E2, 0x1060, 0x1060, 0x1860, 0x1880, 0x2080, 0x2080, 0x28A0, 
-    0x28A0, 0x28A0, 0x30A0, 0x30A0, 0x30A0, 0x30A0, 0x28A0, 0x28A0, 0x2880, 0x2080, 0x2080, 0x1860, 
-    0x1860, 0x1040, 0x0820, 0x1881, 0x3122, 0xED23, 0xFE03, 0xABE4, 0x38E2, 0x5142, 0x4922, 0x4902, 
-    0x4922, 0x4922, 0x4942, 0x4922, 0x7AE9, 0xCDB3, 0xC5B2, 0xBD31, 0x59A4, 0x4922, 0xDCC4, 0xFE25, 
-    0xEDC6, 0xF582, 0xFDC2, 0xFDA1, 0xFD42, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 
-    0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 
-    0xDBE0, 0xDC01, 0xDC01, 0xDC01, 0xDC01, 0xE401, 0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 
-    0xE421, 0xE441, 0xEC61, 0xC320, 0xB280, 0xBAC0, 0xA240, 0xC3C1, 0xFD82, 0xFDA2, 0x9322, 0x0861, 
-    0x2903, 0x1881, 0x1860, 0x2080, 0x28A0, 0x28A0, 0x30C0, 0x38C0, 0x38C0, 0x40C0, 0x40E0, 0x40E0, 
-    0x40E0, 0x40E0, 0x38C0, 0x38C0, 0x30C0, 0x30A0, 0x28A0, 0x2080, 0x1860, 0x1060, 0x0820, 0x1881, 
-    0x3122, 0xE503, 0xFE03, 0xABE3, 0x38E2, 0x4922, 0x7287, 0x8329, 0x8309, 0x7AC8, 0x8309, 0x8B8A, 
-    0x6226, 0x7AE8, 0xA44D, 0x6A46, 0x5142, 0x4943, 0xD4C4, 0xFE25, 0xEDC6, 0xF582, 0xFDC2, 0xFDA1, 
-    0xFD42, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFCE3, 0xFCE3, 
-    0xFCE3, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBC0, 0xDBC0, 0xDBC0, 0xDBC0, 0xDBC0, 
-    0xDBC0, 0xDBC0, 0xDBC0, 0xDBC0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDC01, 
-    0xDC01, 0xDC01, 0xDC01, 0xE401, 0xE401, 0xE421, 0xE421, 0xE421, 0xE421, 0xE421, 0xE441, 0xC320, 
-    0xB280, 0xBAC0, 0xA240, 0xC3C1, 0xFD82, 0xFDA2, 0x8B22, 0x0861, 0x2902, 0x1881, 0x2080, 0x28A1, 
-    0x30C0, 0x38C0, 0x40E0, 0x40E0, 0x48E0, 0x4900, 0x5100, 0x5100, 0xA281, 0x5920, 0x48E0, 0x48E0, 
-    0x40E0, 0x38C0, 0x30A0, 0x28A0, 0x2080, 0x1860, 0x0820, 0x1881, 0x3122, 0xE503, 0xFE03, 0xABE4, 
-    0x38E2, 0x4101, 0x7AC8, 0xC551, 0xBD10, 0x93AB, 0xAC6E, 0x93AB, 0x7AE8, 0x6225, 0x93CC, 0x5183, 
-    0x5142, 0x4943, 0xD4C3, 0xFE25, 0xEDC6, 0xF582, 0xFDC2, 0xFDA1, 0xFD62, 0xF4E3, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFCE3, 0xFCE3, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xDBC0, 0xDBC0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 
-    0xD3C0, 0xD3C0, 0xDBC0, 0xDBC0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE1, 0xDC01, 0xDC01, 0xDC01, 
-    0xDC01, 0xDC01, 0xE421, 0xE421, 0xE421, 0xE421, 0xE441, 0xC320, 0xB280, 0xBAC0, 0xA240, 0xC3C1, 
-    0xFD82, 0xFDA2, 0x8B22, 0x0841, 0x2902, 0x18A1, 0x2080, 0x30A1, 0x38C0, 0x40E0, 0x48E0, 0x5100, 
-    0x5920, 0x6140, 0xA261, 0x81C0, 0xDB80, 0x5900, 0x5920, 0x5100, 0x4900, 0x40E0, 0x38C0, 0x30A0, 
-    0x2880, 0x1860, 0x0820, 0x1881, 0x3122, 0xE502, 0xFE03, 0xABE3, 0x38E2, 0x4921, 0x59E5, 0x8B4A, 
-    0x8329, 0x7287, 0x8329, 0x61E5, 0x6A66, 0x6A46, 0x93CC, 0x59A4, 0x5142, 0x4943, 0xD4C3, 0xFE25, 
-    0xEDC5, 0xF582, 0xFDC2, 0xFDA1, 0xFD42, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFCE3, 0xFCE3, 0xFCE3, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 
-    0xD3C0, 0xD3C0, 0xD3C0, 0xD3A0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 
-    0xD3C0, 0xDBC0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDC01, 0xDC01, 0xDC01, 0xDC01, 0xE401, 
-    0xE421, 0xE421, 0xE441, 0xC320, 0xB280, 0xBAC0, 0xA240, 0xC3C1, 0xFD82, 0xFDA2, 0x9322, 0x0841, 
-    0x2902, 0x20A1, 0x28A0, 0x30C0, 0x40E0, 0x4900, 0x5100, 0x6120, 0x6120, 0x81C0, 0xDB80, 0x7980, 
-    0xEBE0, 0x89E0, 0x6120, 0x6120, 0x5920, 0x4900, 0x40E0, 0x38C0, 0x28A0, 0x1860, 0x0820, 0x1881, 
-    0x3122, 0xE502, 0xFE03, 0xABE3, 0x38E2, 0x5142, 0x4922, 0x4901, 0x4901, 0x4922, 0x4922, 0x4942, 
-    0x5142, 0x4942, 0x4922, 0x5142, 0x5163, 0x4923, 0xD4C3, 0xFE25, 0xEDC5, 0xF582, 0xFDC2, 0xFDA1, 
-    0xFD62, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xD3C0, 0xD3C0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 
-    0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xDBC0, 
-    0xDBE0, 0xDBE0, 0xDBE0, 0xDBE1, 0xDBE1, 0xDC01, 0xDC01, 0xDC01, 0xDC01, 0xE401, 0xE421, 0xC320, 
-    0xB2A0, 0xBAC0, 0xA240, 0xC3C1, 0xFD82, 0xFDA2, 0x8B22, 0x0841, 0x2902, 0x20A1, 0x28A0, 0x38C0, 
-    0x48E0, 0x5100, 0x6120, 0x7140, 0x7980, 0x8160, 0xDB80, 0x9A00, 0xBAE0, 0xB2A0, 0x7140, 0x7160, 
-    0x6120, 0x5900, 0x48E0, 0x40C0, 0x30A0, 0x2060, 0x0820, 0x1881, 0x3122, 0xE502, 0xFE03, 0xABE3, 
-    0x38E2, 0x4922, 0x4122, 0x4122, 0x4122, 0x4122, 0x4122, 0x4122, 0x4143, 0x4143, 0x4143, 0x4943, 
-    0x5163, 0x4922, 0xD4C3, 0xFE25, 0xEDC5, 0xF582, 0xFDC2, 0xFDA1, 0xFD62, 0xF4E3, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD02, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 
-    0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xDBE0, 0xDBE0, 0xDBE0, 
-    0xDBE1, 0xDBE1, 0xDC01, 0xDC01, 0xDC01, 0xDC01, 0xE421, 0xC320, 0xB2A0, 0xBAC0, 0xA240, 0xC3C1, 
-    0xFD82, 0xFDA2, 0x8B22, 0x0841, 0x2902, 0x20A1, 0x30A0, 0x40E0, 0x4900, 0x5920, 0x6940, 0x7960, 
-    0x8980, 0x8960, 0xBAC0, 0xAA20, 0xB260, 0x99E0, 0x8160, 0x7140, 0x6940, 0x6120, 0x5100, 0x40E0, 
-    0x30A0, 0x2060, 0x0820, 0x1881, 0x3122, 0xE502, 0xFE03, 0xABE3, 0x38E2, 0x20C1, 0x1081, 0x1081, 
-    0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x3123, 0x4922, 0xD4C3, 0xFE24, 
-    0xEDC5, 0xF582, 0xFDC2, 0xFDA1, 0xFD62, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCC2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 
-    0xD380, 0xD380, 0xCB80, 0xCB80, 0xD380, 0xD380, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 
-    0xD3A0, 0xD3A0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xDBC0, 0xDBE0, 0xDBE0, 0xDBE1, 0xDBE1, 0xDBE1, 
-    0xDC01, 0xDC01, 0xE421, 0xC320, 0xB2A0, 0xBAC0, 0xA240, 0xC3C1, 0xFD81, 0xFD81, 0x8B22, 0x0841, 
-    0x2902, 0x20A1, 0x30A0, 0x40E0, 0x5100, 0x6140, 0x7160, 0x9A00, 0xAA60, 0xB280, 0xC2C1, 0xBAA0, 
-    0xBAA0, 0xB260, 0xAA40, 0xA240, 0x7960, 0x5900, 0x5100, 0x48E0, 0x30A0, 0x2060, 0x0820, 0x1881, 
-    0x3122, 0xE502, 0xFE02, 0xABC3, 0x38C2, 0x20A1, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 
-    0x1061, 0x1061, 0x1081, 0x0861, 0x28E2, 0x4943, 0xD4C3, 0xFE24, 0xEDC5, 0xF582, 0xFDC2, 0xFDA1, 
-    0xFD42, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFCE3, 0xFD02, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xD3A0, 0xD380, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 
-    0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xD380, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3C0, 
-    0xD3C0, 0xD3C0, 0xD3C0, 0xDBC0, 0xDBE0, 0xDBE0, 0xDBE1, 0xDBE1, 0xDBE1, 0xDC01, 0xE401, 0xC320, 
-    0xB2A0, 0xBAC0, 0xA240, 0xC3C1, 0xFD81, 0xFD81, 0x8B22, 0x0841, 0x2902, 0x20A1, 0x30A0, 0x40E0, 
-    0x5100, 0x6940, 0x7980, 0xEBE1, 0xFCC1, 0xFD02, 0xFD22, 0xFD42, 0xFD42, 0xFD22, 0xFCE2, 0xFCC1, 
-    0xDBC1, 0xBAE0, 0x6140, 0x48E0, 0x30A0, 0x2080, 0x0820, 0x1881, 0x3122, 0xE502, 0xFE03, 0xABE3, 
-    0x38C2, 0x20A1, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 
-    0x28E2, 0x4923, 0xD4C3, 0xFE24, 0xEDC5, 0xF582, 0xFDC2, 0xFDA1, 0xFD62, 0xF4E3, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 
-    0xCB80, 0xCB80, 0xCB80, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3C0, 0xD3C0, 0xD3C0, 
-    0xD3C0, 0xDBE0, 0xDBE0, 0xDBE1, 0xDBE1, 0xDBE1, 0xDC01, 0xC320, 0xB2A0, 0xBAE0, 0xA240, 0xCBC1, 
-    0xFD61, 0xFD81, 0x8B22, 0x0841, 0x28E2, 0x20A1, 0x30A0, 0x40E0, 0x5900, 0x6940, 0x8180, 0xEBE1, 
-    0xFCC1, 0xFD02, 0xFD42, 0xFD62, 0xFD42, 0xFD22, 0xFCE1, 0xFCC1, 0xC300, 0xCB20, 0xA280, 0x38A0, 
-    0x38C0, 0x2080, 0x0820, 0x1881, 0x3122, 0xE4E2, 0xFE03, 0xABC3, 0x38C2, 0x20A1, 0x0861, 0x1081, 
-    0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x28E2, 0x4923, 0xD4A3, 0xFE24, 
-    0xEDA5, 0xF582, 0xFDC2, 0xFDA1, 0xFD62, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD02, 
-    0xFD02, 0xFD03, 0xFD02, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 
-    0xCB80, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 
-    0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xDBC0, 0xDBE0, 
-    0xDBE1, 0xDBE1, 0xDC01, 0xC320, 0xB2A0, 0xBAC0, 0xA240, 0xC3C1, 0xFD61, 0xFD81, 0x8B22, 0x0841, 
-    0x28E2, 0x20A1, 0x30A0, 0x40E0, 0x5900, 0x6940, 0x7960, 0xDB80, 0xFCE1, 0xFD02, 0xFD42, 0xFD62, 
-    0xFD42, 0xFD22, 0xFCE1, 0xFCA1, 0x89C0, 0xBAA0, 0xAAA0, 0x38A0, 0x38C0, 0x2080, 0x0820, 0x1881, 
-    0x3102, 0xE4E2, 0xFE02, 0xABC3, 0x38C2, 0x20A1, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 
-    0x1081, 0x1081, 0x1081, 0x1061, 0x28E2, 0x4922, 0xD4A3, 0xFE24, 0xEDA5, 0xF582, 0xFDC2, 0xFDA1, 
-    0xFD42, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD02, 0xFD02, 0xFD02, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xCB80, 0xCB80, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 
-    0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xD380, 0xD3A0, 0xD3A0, 
-    0xD3A0, 0xD3A0, 0xD3A0, 0xD3C0, 0xD3C0, 0xD3C0, 0xDBC0, 0xDBE0, 0xDBE0, 0xDBE1, 0xDC01, 0xC320, 
-    0xB2A0, 0xBAC0, 0xA240, 0xC3A1, 0xFD61, 0xFD81, 0x8B02, 0x0841, 0x28E2, 0x20A1, 0x30A0, 0x40E0, 
-    0x5100, 0x6940, 0x7940, 0xC2E0, 0xFCE1, 0xFCE2, 0xFD22, 0xFD42, 0xFD22, 0xFD02, 0xFCC1, 0xFC60, 
-    0xD360, 0xE3A0, 0x6960, 0x40C0, 0x30A0, 0x2060, 0x0820, 0x1881, 0x3102, 0xE4E2, 0xFDE2, 0xABC3, 
-    0x38C2, 0x20C2, 0x0861, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x0861, 
-    0x20C2, 0x4922, 0xD4A3, 0xFE24, 0xEDA5, 0xF582, 0xFDC2, 0xFDA1, 0xFD62, 0xF4E3, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD02, 0xFD03, 0xFD02, 0xFD02, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 
-    0xCB60, 0xCB60, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xD380, 0xD380, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 
-    0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xDBC0, 0xDBE0, 0xDBE1, 0xC320, 0xB2A0, 0xBAC0, 0xA240, 0xC3A1, 
-    0xFD61, 0xFD81, 0x8B21, 0x0841, 0x28E2, 0x20A1, 0x30A0, 0x40E0, 0x5100, 0x6140, 0x7960, 0x9A00, 
-    0xFC81, 0xFCE1, 0xFCE2, 0xFD02, 0xFD02, 0xFCC1, 0xFCC1, 0xE3A0, 0xB2A0, 0x7160, 0x50E0, 0x40E0, 
-    0x30A0, 0x2060, 0x0820, 0x1881, 0x3122, 0xE4E2, 0xFDE2, 0xABC3, 0x38C2, 0x4122, 0x30E2, 0x30E2, 
-    0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3902, 0x3102, 0x4122, 0x4922, 0xD4A3, 0xFE24, 
-    0xEDA5, 0xF582, 0xFDC2, 0xFDA1, 0xFD62, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD02, 0xFD03, 
-    0xFD02, 0xFD02, 0xFD02, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 
-    0xCB60, 0xC360, 0xCB40, 0xCB60, 0xC360, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB80, 
-    0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xD380, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3C0, 0xD3C0, 
-    0xD3C0, 0xDBC0, 0xDBE1, 0xC320, 0xB2A0, 0xBAC0, 0xA240, 0xCBA1, 0xFD61, 0xFD81, 0x8B01, 0x0841, 
-    0x28E2, 0x20A1, 0x30A0, 0x40E0, 0x4900, 0x5920, 0x6920, 0x7140, 0xAA60, 0xF441, 0xFC81, 0xFC81, 
-    0xFC81, 0xFC60, 0xE3A0, 0x7960, 0x58C0, 0x5900, 0x5100, 0x38C0, 0x30A0, 0x2060, 0x0820, 0x1881, 
-    0x3122, 0xE4E2, 0xFDE2, 0xABC3, 0x38C2, 0x4942, 0x4922, 0x4921, 0x4921, 0x4901, 0x4901, 0x4922, 
-    0x4922, 0x4901, 0x4922, 0x5142, 0x5142, 0x4922, 0xD4A3, 0xFE24, 0xEDA5, 0xF582, 0xFDC2, 0xFDA1, 
-    0xFD62, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xCB60, 0xCB60, 0xC360, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 
-    0xC340, 0xC340, 0xC360, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB80, 0xCB80, 0xCB80, 
-    0xCB80, 0xCB80, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3C0, 0xD3C0, 0xD3C0, 0xDBE0, 0xC320, 
-    0xB2A0, 0xBAC0, 0xA240, 0xC3A0, 0xFD61, 0xFD81, 0x8B01, 0x0841, 0x28E2, 0x20A1, 0x30A0, 0x38C0, 
-    0x48E0, 0x5920, 0x9A20, 0xAA60, 0xAA40, 0xBAC0, 0xCB21, 0xCB21, 0xCB20, 0xCB00, 0xAA60, 0xA220, 
-    0x9A40, 0x79A0, 0x40C0, 0x38C0, 0x28A0, 0x1860, 0x0820, 0x1881, 0x3102, 0xE4E2, 0xFDE2, 0xABC3, 
-    0x38C2, 0x4942, 0x4122, 0x59C5, 0x5A05, 0x6226, 0x6206, 0x59C5, 0x51A4, 0x6226, 0x51A4, 0x4922, 
-    0x4942, 0x4922, 0xD4A3, 0xFE04, 0xEDA5, 0xF582, 0xFDC1, 0xFDA1, 0xFD42, 0xF4E3, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xC360, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 
-    0xC340, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xD380, 
-    0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3C0, 0xD3C0, 0xDBE0, 0xC300, 0xB2A0, 0xBAC0, 0xA240, 0xC3A0, 
-    0xFD61, 0xFD61, 0x8B01, 0x0841, 0x28E2, 0x20A1, 0x28A0, 0x38C0, 0x40E0, 0x5100, 0xAA80, 0xCB20, 
-    0xCB20, 0xCB20, 0xCB00, 0xCB00, 0xC300, 0xC300, 0xCB20, 0xCB20, 0xC320, 0x79C0, 0x38C0, 0x38C0, 
-    0x2880, 0x1860, 0x0820, 0x1881, 0x3102, 0xE4E2, 0xFDE2, 0xABC3, 0x38C2, 0x4942, 0x4122, 0x6A67, 
-    0x72C9, 0x72C8, 0x6A88, 0x6A88, 0x59E5, 0x72C8, 0x6246, 0x4922, 0x4942, 0x4922, 0xD4A3, 0xFE04, 
-    0xEDA5, 0xF582, 0xFDC1, 0xFDA1, 0xFD42, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD02, 0xFD02, 
-    0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xC340, 0xC340, 0xC340, 0xC340, 
-    0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xCB60, 0xCB60, 
-    0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 
-    0xD3A0, 0xD3A0, 0xD3C0, 0xC300, 0xB2A0, 0xBAC0, 0xA240, 0xCBA0, 0xFD61, 0xFD61, 0x8B01, 0x0841, 
-    0x20E2, 0x20A1, 0x28A0, 0x30A0, 0x38C0, 0x40E0, 0x40C0, 0x48E0, 0x50E0, 0x5100, 0x5900, 0x5900, 
-    0x5100, 0x50E0, 0x48E0, 0x48C0, 0x40C0, 0x38C0, 0x38C0, 0x30A0, 0x2080, 0x1860, 0x0820, 0x1881, 
-    0x3102, 0xE4E2, 0xFDE2, 0xABC3, 0x38C2, 0x4922, 0x40E1, 0x4102, 0x4922, 0x40E1, 0x4902, 0x4922, 
-    0x40E2, 0x40E1, 0x4102, 0x4902, 0x4942, 0x4922, 0xD4A3, 0xFE04, 0xEDA5, 0xF582, 0xFDC1, 0xFDA1, 
-    0xFD42, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xC320, 0xC320, 0xC320, 
-    0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 
-    0xCB60, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xD380, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3C0, 0xC300, 
-    0xB2A0, 0xBAC0, 0xA240, 0xC3A0, 0xFD61, 0xFD61, 0x8B01, 0x0841, 0x3143, 0x3123, 0x2080, 0x28A1, 
-    0x30C1, 0x38C1, 0x40E0, 0x40E0, 0x40E0, 0x4900, 0x4900, 0x4900, 0x4900, 0x40E0, 0x40E0, 0x40E0, 
-    0x38C0, 0x30C0, 0x28A0, 0x2080, 0x1860, 0x1040, 0x0820, 0x1881, 0x3102, 0xE4E2, 0xFDE2, 0xABC3, 
-    0x30C2, 0x4122, 0x32E5, 0x3325, 0x3325, 0x3346, 0x3345, 0x3345, 0x3B46, 0x3B46, 0x3366, 0x3B05, 
-    0x4942, 0x4902, 0xD4A3, 0xFE04, 0xEDA5, 0xF582, 0xFDC1, 0xFDA1, 0xFD41, 0xF4E3, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD02, 
-    0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xC340, 0xC340, 0xC320, 0xC320, 0xC320, 0xC320, 0xC320, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 
-    0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB80, 
-    0xCB80, 0xCB80, 0xD380, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3C0, 0xC300, 0xB2A0, 0xBAE0, 0xA240, 0xC3A0, 
-    0xFD61, 0xFD61, 0x8B01, 0x0841, 0x2902, 0x2923, 0x20C2, 0x20C2, 0x20C2, 0x20C2, 0x20C2, 0x20C2, 
-    0x20C2, 0x20C2, 0x20C2, 0x20C2, 0x28E2, 0x20E2, 0x20C2, 0x20E2, 0x20C2, 0x20C2, 0x20C2, 0x20C2, 
-    0x20C2, 0x18A1, 0x1881, 0x20C2, 0x3102, 0xE4E1, 0xFDC2, 0xABC3, 0x30A1, 0x28E1, 0x2BC6, 0x2C07, 
-    0x2BE6, 0x2C06, 0x2C06, 0x2C06, 0x2C06, 0x2C06, 0x2C27, 0x3407, 0x4162, 0x4902, 0xD4A3, 0xFE04, 
-    0xEDA5, 0xF582, 0xFDC1, 0xFDA1, 0xFD41, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD03, 0xFD03, 0xFD02, 0xFD03, 0xFD02, 0xFD02, 0xFD03, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 
-    0xFD02, 0xFD02, 0xFCE2, 0xFCE2, 0xFD02, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xC320, 0xC320, 0xC320, 0xC320, 
-    0xC320, 0xC320, 0xC320, 0xC320, 0xC320, 0xC320, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 
-    0xC340, 0xC340, 0xC340, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 
-    0xD380, 0xD3A0, 0xD3A0, 0xC300, 0xB2A0, 0xBAE0, 0xA240, 0xCBA0, 0xFD41, 0xFD61, 0x8B01, 0x0841, 
-    0x20A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x20C1, 0x20C1, 0x20C1, 
-    0x20C1, 0x20C1, 0x20C2, 0x20C1, 0x20C2, 0x20C2, 0x20C2, 0x20C2, 0x20C2, 0x20C2, 0x20C2, 0x20C1, 
-    0x3102, 0xE4E1, 0xFDC2, 0xABC3, 0x2881, 0x20C1, 0x2B86, 0x3C07, 0x4C48, 0x4C48, 0x4C68, 0x4C48, 
-    0x4C48, 0x4C48, 0x4427, 0x2BA6, 0x4162, 0x4902, 0xD4A3, 0xFE03, 0xEDA5, 0xF582, 0xFDA1, 0xFDA1, 
-    0xFD41, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD03, 0xFD02, 0xFD02, 
-    0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 0xFCC2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xC320, 0xC320, 0xBB20, 0xBB20, 0xBB20, 0xBB20, 0xBB20, 0xBB20, 
-    0xBB20, 0xBB20, 0xBB20, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 
-    0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xD380, 0xD3A0, 0xC300, 
-    0xBAA0, 0xC2E0, 0xA240, 0xCBA0, 0xFD41, 0xFD61, 0x8B01, 0x0841, 0x20C1, 0x20A1, 0x20C1, 0x20C1, 
-    0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 
-    0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x3102, 0xE4C1, 0xFDC1, 0xABA3, 
-    0x2881, 0x20C1, 0x2385, 0x950B, 0xA4AC, 0x944A, 0x942A, 0x9C8B, 0xA4AB, 0xA4AC, 0x950B, 0x2BA6, 
-    0x4162, 0x4102, 0xD482, 0xFE03, 0xEDA4, 0xF582, 0xFDA1, 0xFDA1, 0xFD41, 0xF4E3, 0xFD03, 0xFD03, 
-    0xFD03, 0xFD02, 0xFD03, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 
-    0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xC320, 0xBB20, 0xBB20, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB20, 0xBB20, 
-    0xBB20, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 0xC340, 0xC340, 0xCB60, 0xCB60, 0xCB60, 
-    0xCB60, 0xCB60, 0xCB80, 0xCB80, 0xCB80, 0xCB80, 0xD3A0, 0xC300, 0xBAA0, 0xC2E0, 0xA240, 0xCBA0, 
-    0xFD41, 0xFD61, 0x8B01, 0x0841, 0x20C1, 0x1881, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 
-    0x1060, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1060, 0x1060, 0x1061, 0x1060, 
-    0x1060, 0x1060, 0x18A1, 0x20C1, 0x2902, 0xE4C1, 0xFDC1, 0xABA2, 0x2881, 0x20C1, 0x2385, 0x8CCA, 
-    0x8BCA, 0x7369, 0x5AA7, 0x7369, 0x8C0A, 0x8389, 0x8CEB, 0x2BA6, 0x4162, 0x4102, 0xD482, 0xFE03, 
-    0xEDA4, 0xF582, 0xFDA1, 0xFD81, 0xFD41, 0xF4E3, 0xFD03, 0xFD03, 0xFD03, 0xFD02, 0xFD02, 0xFD02, 
-    0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 
-    0xFD02, 0xFD02, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCC2, 0xF4E2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xBB20, 0xBB00, 0xBB00, 0xBB00, 
-    0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB20, 0xC320, 0xC320, 
-    0xC320, 0xC320, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 
-    0xCB80, 0xCB80, 0xD3A0, 0xC300, 0xBAA0, 0xC2E0, 0xA240, 0xCBA0, 0xFD41, 0xFD60, 0x8B01, 0x0861, 
-    0x18A1, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0840, 0x1881, 0x1881, 0x1881, 
-    0x1881, 0x1881, 0x18A1, 0x1081, 0x0000, 0x0820, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x18A1, 
-    0x3102, 0xE4C1, 0xFDC1, 0xABA2, 0x2881, 0x20C1, 0x2385, 0x94EB, 0xB4EC, 0x942A, 0x7349, 0x8C2A, 
-    0x7BA9, 0xA4AC, 0x9D4B, 0x2385, 0x4162, 0x4102, 0xD482, 0xFE03, 0xEDA4, 0xF582, 0xFDA1, 0xFD81, 
-    0xFD41, 0xF4E3, 0xFD03, 0xFD03, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 
-    0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 
-    0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB20, 0xC320, 0xC320, 0xC320, 0xC320, 
-    0xC340, 0xC340, 0xC340, 0xC340, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB80, 0xCB80, 0xC300, 
-    0xBAA0, 0xC2E0, 0xAA40, 0xCBA0, 0xFD40, 0xFD60, 0x8B01, 0x1061, 0x1881, 0x0020, 0x0840, 0x0840, 
-    0x0840, 0x0840, 0x0840, 0x0820, 0x0820, 0x1040, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 
-    0x0840, 0x1040, 0x1040, 0x1040, 0x0840, 0x0840, 0x0820, 0x1081, 0x3102, 0xE4C1, 0xFDC1, 0xABA2, 
-    0x2881, 0x20E1, 0x2365, 0x9D2B, 0xA46B, 0x8C2A, 0x5A87, 0x8BEA, 0x7349, 0x7329, 0x950B, 0x23A6, 
-    0x4162, 0x4102, 0xD482, 0xFE03, 0xED84, 0xF581, 0xFDA1, 0xFD81, 0xFD41, 0xF4E3, 0xFD02, 0xFD02, 
-    0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 
-    0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 
-    0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 0xC340, 
-    0xC340, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB60, 0xCB80, 0xC300, 0xBAA0, 0xC2E0, 0xAA40, 0xCBA0, 
-    0xFD40, 0xFD40, 0x8B01, 0x1061, 0x18A1, 0x0820, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 
-    0x0840, 0x0820, 0x0820, 0x1060, 0x1061, 0x0820, 0x0840, 0x1040, 0x1040, 0x1040, 0x0840, 0x0840, 
-    0x0840, 0x0840, 0x0820, 0x1081, 0x3102, 0xE4C1, 0xFDC1, 0xABA2, 0x2881, 0x20C1, 0x2365, 0x9D2B, 
-    0x940B, 0x6B08, 0x5A87, 0x9C8B, 0x83CA, 0x6AE8, 0x950B, 0x2386, 0x4162, 0x4102, 0xD482, 0xFE03, 
-    0xED84, 0xF561, 0xFDA1, 0xFD81, 0xFD41, 0xF4E3, 0xFCE2, 0xFCE2, 0xFCE2, 0xFD02, 0xFCE2, 0xFD02, 
-    0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFCE2, 0xFD02, 0xFD02, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCC2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xBB00, 0xBB00, 0xBB00, 0xBAE0, 
-    0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 
-    0xBB00, 0xBB00, 0xBB20, 0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 0xC340, 0xC340, 0xCB60, 0xCB60, 
-    0xCB60, 0xCB60, 0xCB80, 0xC300, 0xBAA0, 0xC2C0, 0xAA40, 0xCBA0, 0xFD40, 0xFD40, 0x8B01, 0x1061, 
-    0x18A1, 0x0840, 0x1060, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x1060, 
-    0x1061, 0x1060, 0x1060, 0x1040, 0x1040, 0x1040, 0x1040, 0x0840, 0x0840, 0x0840, 0x0820, 0x1081, 
-    0x3102, 0xE4C1, 0xFDA1, 0xABA2, 0x2881, 0x20C1, 0x2365, 0x950B, 0x940A, 0x7389, 0x83AA, 0x7369, 
-    0x5266, 0x7349, 0x8CCB, 0x2386, 0x4162, 0x4102, 0xD482, 0xFE03, 0xED84, 0xF561, 0xFDA1, 0xFD81, 
-    0xFD41, 0xF4E3, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFD02, 0xFD02, 0xFCE2, 0xFD02, 0xFD02, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFD02, 0xFD02, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 0xFCC2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xBB00, 0xBAE0, 0xBAE0, 0xBAE0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 
-    0xB2E0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB20, 
-    0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 0xC340, 0xC340, 0xCB60, 0xCB60, 0xCB60, 0xCB80, 0xC2E0, 
-    0xBAA0, 0xC2C0, 0xAA40, 0xCBA0, 0xFD40, 0xFD40, 0x8B01, 0x1061, 0x18A1, 0x0840, 0x1060, 0x0840, 
-    0x0840, 0x0840, 0x1040, 0x1040, 0x1040, 0x1060, 0x1061, 0x1081, 0x18A1, 0x1081, 0x1061, 0x1060, 
-    0x1060, 0x1040, 0x1040, 0x1040, 0x0840, 0x0840, 0x0820, 0x1081, 0x3102, 0xE4C1, 0xFDA1, 0xABA2, 
-    0x2881, 0x20C1, 0x2385, 0x94CB, 0x8BCA, 0x7B69, 0x940A, 0x8BEA, 0x8BCA, 0xA44B, 0x9D0B, 0x2385, 
-    0x4162, 0x4102, 0xD482, 0xFDE3, 0xED84, 0xF561, 0xFDA1, 0xFD81, 0xFD41, 0xF4E3, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 0xFCC2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xBAE0, 0xBAE0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xBAE0, 
-    0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB20, 0xC320, 0xC320, 0xC320, 0xC320, 
-    0xC340, 0xC340, 0xC340, 0xC340, 0xCB60, 0xCB60, 0xCB60, 0xC2E0, 0xBAA0, 0xC2C0, 0xAA40, 0xCBA0, 
-    0xFD20, 0xFD40, 0x8B01, 0x1061, 0x18A1, 0x0840, 0x1061, 0x0840, 0x1060, 0x1060, 0x1060, 0x1060, 
-    0x1061, 0x1061, 0x1081, 0x18A1, 0x18A2, 0x18A1, 0x1081, 0x1061, 0x1060, 0x1060, 0x1040, 0x1040, 
-    0x0840, 0x0840, 0x0820, 0x1081, 0x3102, 0xE4A1, 0xFDA1, 0xABA2, 0x2881, 0x20C1, 0x2365, 0x74A9, 
-    0x8CCA, 0x84AA, 0x8CCA, 0x8CEB, 0x8CCA, 0x950B, 0x74A9, 0x2386, 0x4162, 0x40E2, 0xD482, 0xFDE3, 
-    0xED84, 0xF561, 0xFDA1, 0xFD81, 0xFD41, 0xF4E2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCC2, 0xFCC2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C1, 0xF4C1, 0xBAE0, 0xB2E0, 0xB2E0, 0xB2E0, 
-    0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xBAE0, 0xBAE0, 0xBAE0, 
-    0xBAE0, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 0xC340, 
-    0xCB40, 0xCB60, 0xCB60, 0xC2E0, 0xBAA0, 0xC2C0, 0xAA40, 0xCBA0, 0xFD20, 0xFD40, 0x8AE1, 0x1061, 
-    0x18A1, 0x0840, 0x1061, 0x1060, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x18C2, 
-    0x18C2, 0x18C2, 0x1881, 0x1081, 0x1060, 0x1060, 0x1060, 0x1040, 0x0840, 0x0840, 0x0820, 0x1081, 
-    0x3102, 0xE4A1, 0xFDA1, 0xABA2, 0x2881, 0x20C1, 0x2B86, 0x23A6, 0x23A5, 0x2385, 0x2385, 0x2385, 
-    0x2385, 0x23A5, 0x23A6, 0x2BA6, 0x3942, 0x40E2, 0xD482, 0xFDE3, 0xED84, 0xF561, 0xFDA1, 0xFD81, 
-    0xFD41, 0xF4E2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 0xFCC2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C1, 0xF4C1, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2C0, 0xB2C0, 0xB2C0, 
-    0xB2C0, 0xB2C0, 0xB2C0, 0xB2E0, 0xB2E0, 0xB2E0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 
-    0xBB00, 0xBB00, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 0xC340, 0xCB40, 0xCB60, 0xBAE0, 
-    0xBAA0, 0xC2C0, 0xAA40, 0xCBA0, 0xFD20, 0xFD40, 0x8AE1, 0x1061, 0x18A1, 0x0860, 0x1061, 0x1061, 
-    0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x18A1, 0x18C2, 0x20C2, 0x20E2, 0x20E2, 0x18A1, 0x1081, 
-    0x1061, 0x1060, 0x1060, 0x1040, 0x0840, 0x0840, 0x0820, 0x1081, 0x3102, 0xE4A1, 0xFDA1, 0xAB82, 
-    0x2881, 0x20C0, 0x2385, 0x3406, 0x33E6, 0x2B66, 0x2B66, 0x2B66, 0x2B66, 0x3407, 0x3407, 0x2BA6, 
-    0x4142, 0x40E2, 0xD482, 0xFDE2, 0xED84, 0xF561, 0xFDA1, 0xFD80, 0xFD41, 0xF4E2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 0xFCC2, 0xFCC2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C1, 
-    0xB2E0, 0xB2E0, 0xB2E0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 
-    0xB2E0, 0xB2E0, 0xB2E0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 0xC320, 0xC320, 
-    0xC320, 0xC320, 0xC340, 0xC340, 0xC340, 0xC340, 0xCB60, 0xBAE0, 0xBAA0, 0xC2C0, 0xAA40, 0xCBA0, 
-    0xFD20, 0xFD40, 0x8AE1, 0x1061, 0x18A1, 0x0861, 0x1081, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 
-    0x0840, 0x0840, 0x0840, 0x1081, 0x1081, 0x1081, 0x0840, 0x0840, 0x1061, 0x1061, 0x1060, 0x1040, 
-    0x0840, 0x0840, 0x0820, 0x1081, 0x3102, 0xE4A1, 0xFDA1, 0xAB82, 0x2881, 0x28A0, 0x1901, 0x2162, 
-    0x1942, 0x2162, 0x2162, 0x2162, 0x1962, 0x2142, 0x2162, 0x3182, 0x4922, 0x4102, 0xD462, 0xFDE2, 
-    0xED84, 0xF561, 0xFDA1, 0xFD80, 0xFD41, 0xF4E2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCC2, 0xFCC2, 0xF4C2, 0xF4C2, 0xF4C1, 0xF4C1, 0xF4C1, 0xB2E0, 0xB2C0, 0xB2C0, 0xB2C0, 
-    0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2E0, 0xB2E0, 0xB2E0, 
-    0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 
-    0xC340, 0xC340, 0xCB60, 0xBAE0, 0xBAA0, 0xC2C0, 0xAA40, 0xCBA0, 0xFD20, 0xFD40, 0x8AE1, 0x1061, 
-    0x18A1, 0x0861, 0x1081, 0x1061, 0x1061, 0x1081, 0x0840, 0x1082, 0x31A6, 0x4A69, 0x5ACA, 0x630B, 
-    0x62CA, 0x5268, 0x4207, 0x3185, 0x1081, 0x0840, 0x1060, 0x0840, 0x0840, 0x0840, 0x0820, 0x1061, 
-    0x3102, 0xE4A1, 0xFDA1, 0xABA2, 0x28A1, 0x38E1, 0x30A0, 0x3080, 0x2880, 0x3080, 0x3080, 0x3080, 
-    0x3080, 0x30A1, 0x38C1, 0x40E1, 0x4922, 0x40E2, 0xD462, 0xFDE2, 0xED84, 0xF561, 0xFDA1, 0xFD80, 
-    0xFD41, 0xF4E2, 0xF4E2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 0xFCC2, 0xFCC2, 0xF4C2, 
-    0xF4C2, 0xF4C1, 0xF4C1, 0xF4C1, 0xB2E0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 
-    0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2E0, 0xB2E0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 
-    0xBB00, 0xBB00, 0xBB00, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 0xC340, 0xCB60, 0xBAE0, 
-    0xBAA0, 0xC2C0, 0xAA40, 0xCBA0, 0xFD20, 0xFD40, 0x8AE1, 0x1061, 0x18A1, 0x0861, 0x1081, 0x1061, 
-    0x1081, 0x0840, 0x3185, 0xCE16, 0xEE53, 0xEDD0, 0xE54D, 0xDCC9, 0xCC27, 0xBBA6, 0xA345, 0x92E5, 
-    0x8B8B, 0x2944, 0x0820, 0x1060, 0x0840, 0x0840, 0x0820, 0x1081, 0x3102, 0xE4A1, 0xFD80, 0xAB82, 
-    0x30A1, 0x4101, 0x3901, 0x3901, 0x38E1, 0x30E1, 0x30E1, 0x3102, 0x3922, 0x4101, 0x4121, 0x4122, 
-    0x4921, 0x40E2, 0xD462, 0xFDC2, 0xED84, 0xF561, 0xFDA1, 0xFD80, 0xFD21, 0xF4C2, 0xF4E2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 0xFCC2, 0xFCC2, 0xFCC2, 0xFCC1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 
-    0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 
-    0xB2C0, 0xB2C0, 0xB2E0, 0xB2E0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xC320, 
-    0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 0xCB40, 0xBAE0, 0xBAA0, 0xC2C0, 0xAA40, 0xCBA0, 
-    0xFD20, 0xFD40, 0x8AE1, 0x1061, 0x18A1, 0x0861, 0x1081, 0x1061, 0x1061, 0x0840, 0x20E2, 0x9BCA, 
-    0xBC4A, 0xC48B, 0xC48B, 0xBC6B, 0xB44B, 0xB42C, 0xB44D, 0xBCD0, 0xB512, 0x20E3, 0x0820, 0x0840, 
-    0x0840, 0x0840, 0x0820, 0x1081, 0x3102, 0xE4A1, 0xFD80, 0xAB82, 0x30A1, 0x4101, 0x4101, 0x38E1, 
-    0x20A1, 0x20C2, 0x18C2, 0x20E2, 0x3164, 0x4184, 0x4101, 0x4101, 0x4922, 0x4102, 0xD461, 0xFDC2, 
-    0xED83, 0xF561, 0xFD81, 0xFD80, 0xFD21, 0xF4C2, 0xF4E2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 
-    0xFCC2, 0xFCC1, 0xF4C2, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 
-    0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2E0, 0xB2E0, 
-    0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 
-    0xC340, 0xC340, 0xCB40, 0xBAE0, 0xBAA0, 0xC2C0, 0xAA40, 0xCBA0, 0xFD20, 0xFD20, 0x8AE1, 0x1061, 
-    0x18A1, 0x0861, 0x1081, 0x1061, 0x1061, 0x1060, 0x0820, 0x6A45, 0x9368, 0x9BA9, 0xAC2B, 0xC4EE, 
-    0xCD71, 0xDDF4, 0xE656, 0xEEB7, 0x942E, 0x0000, 0x1060, 0x0840, 0x0840, 0x0840, 0x0820, 0x1081, 
-    0x3102, 0xE4A0, 0xFD80, 0xAB82, 0x30A1, 0x4101, 0x38E1, 0x20A1, 0x18A1, 0x18A1, 0x2923, 0x2923, 
-    0x1081, 0x2923, 0x41A4, 0x4101, 0x4921, 0x40E1, 0xD461, 0xFDC2, 0xED83, 0xF561, 0xFD81, 0xFD80, 
-    0xFD21, 0xF4C2, 0xF4E2, 0xF4E2, 0xFCC2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 0xFCC2, 0xFCC2, 0xFCC2, 0xFCC1, 0xF4C1, 0xF4C1, 0xF4C1, 
-    0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 
-    0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2E0, 0xB2E0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 
-    0xBB00, 0xBB00, 0xBB00, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 0xC340, 0xCB60, 0xBAE0, 
-    0xBAA0, 0xC2C0, 0xAA40, 0xCB80, 0xFD20, 0xFD20, 0x8AE1, 0x1061, 0x18A1, 0x0840, 0x1081, 0x1060, 
-    0x1060, 0x1060, 0x0820, 0x6246, 0xA3EA, 0xB42B, 0xC4EE, 0xDDD2, 0xE675, 0xEED7, 0xEED8, 0xF719, 
-    0x8BED, 0x0000, 0x1060, 0x0840, 0x0840, 0x0840, 0x0820, 0x1081, 0x30E1, 0xE4A0, 0xFD80, 0xAB82, 
-    0x30A1, 0x4101, 0x28A0, 0x18A1, 0x20C2, 0x6287, 0x62A7, 0x6AE8, 0x6AC7, 0x20C1, 0x2923, 0x4143, 
-    0x4901, 0x40E1, 0xD461, 0xFDC2, 0xED63, 0xF561, 0xFD81, 0xFD80, 0xFD21, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xFCC2, 0xFCC2, 0xFCC2, 0xFCE2, 0xFCC2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 0xFCC2, 0xFCC2, 0xFCC2, 
-    0xFCC2, 0xFCC2, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 
-    0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 
-    0xB2C0, 0xB2E0, 0xB2E0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xC320, 
-    0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 0xCB40, 0xCB40, 0xBAE0, 0xBAA0, 0xC2C0, 0xAA40, 0xCB80, 
-    0xFD20, 0xFD20, 0x8AE1, 0x1061, 0x18A1, 0x0840, 0x1061, 0x1060, 0x1060, 0x1060, 0x0020, 0x51E4, 
-    0x9BC9, 0xAC2B, 0xC4EE, 0xDDD2, 0xE655, 0xEEB7, 0xEEB8, 0xEED8, 0x6B2B, 0x0000, 0x1060, 0x0840, 
-    0x0840, 0x0840, 0x0820, 0x1081, 0x3101, 0xE4A1, 0xFD80, 0xAB82, 0x30A1, 0x38E1, 0x1880, 0x1081, 
-    0x6287, 0x6AC7, 0x2923, 0x1061, 0x4A05, 0x6AC7, 0x18A1, 0x3143, 0x4921, 0x40E1, 0xD461, 0xFDC2, 
-    0xED83, 0xF561, 0xFD81, 0xFD80, 0xFD21, 0xF4A2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xFCC2, 
-    0xFCC2, 0xFCC2, 0xFCC2, 0xFCC2, 0xFCC2, 0xFCC2, 0xFCC2, 0xFCC2, 0xFCC2, 0xFCC2, 0xFCC2, 0xFCC2, 
-    0xFCC2, 0xFCC2, 0xFCC2, 0xFCC2, 0xFCC1, 0xFCC2, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 
-    0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4A1, 0xF4A1, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 
-    0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2E0, 0xB2E0, 0xBAE0, 0xBAE0, 
-    0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 
-    0xC340, 0xCB40, 0xCB40, 0xBAE0, 0xBAA0, 0xC2C0, 0xAA40, 0xCB80, 0xFD00, 0xFD20, 0x8AE1, 0x1061, 
-    0x18A1, 0x0840, 0x1061, 0x1060, 0x1040, 0x1060, 0x0000, 0x4184, 0x9389, 0xA40B, 0xC4EE, 0xD5D2, 
-    0xE655, 0xEEB7, 0xEEB8, 0xEEB8, 0x5A88, 0x0000, 0x1060, 0x0840, 0x0840, 0x0840, 0x0020, 0x1081, 
-    0x3102, 0xE4A0, 0xFD80, 0xAB82, 0x30A1, 0x30C0, 0x1860, 0x3123, 0x5A46, 0x7B48, 0x7B48, 0x0820, 
-    0x1060, 0x6AC7, 0x3143, 0x28E2, 0x4121, 0x40E1, 0xD461, 0xFDC2, 0xED63, 0xF561, 0xFD81, 0xFD60, 
-    0xFD21, 0xF4A2, 0xF4C2, 0xF4C2, 0xF4C1, 0xF4C2, 0xF4C1, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C1, 0xFCC2, 0xF4C2, 0xFCC1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 
-    0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 
-    0xB2C0, 0xB2C0, 0xB2C0, 0xB2E0, 0xB2E0, 0xB2E0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 
-    0xBB00, 0xC300, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 0xC340, 0xCB40, 0xCB60, 0xBAE0, 
-    0xBAA0, 0xC2C0, 0xAA40, 0xCB80, 0xFD00, 0xFD20, 0x8AE1, 0x1061, 0x1881, 0x0840, 0x1060, 0x0840, 
-    0x0840, 0x0840, 0x0020, 0x3123, 0x8B69, 0x9BEB, 0xBCCE, 0xD5B2, 0xE655, 0xEEB7, 0xEEB8, 0xE697, 
-    0x41C6, 0x0000, 0x0840, 0x0840, 0x0820, 0x0820, 0x0020, 0x1061, 0x3101, 0xE480, 0xFD80, 0xAB82, 
-    0x30A1, 0x30A0, 0x1060, 0x2922, 0x6286, 0x3163, 0x7B49, 0x5A46, 0x3984, 0x5A66, 0x3984, 0x20C1, 
-    0x4101, 0x40E1, 0xD461, 0xFDC2, 0xED63, 0xF561, 0xFD81, 0xFD60, 0xFD21, 0xF4A2, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 
-    0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2E0, 0xB2E0, 
-    0xB2E0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xC320, 0xC320, 0xC320, 
-    0xC320, 0xC340, 0xC340, 0xCB40, 0xCB40, 0xCB40, 0xCB60, 0xC2E0, 0xBAA0, 0xC2C0, 0xAA40, 0xCB80, 
-    0xFD00, 0xFD20, 0x8AE1, 0x1061, 0x1881, 0x0840, 0x1060, 0x0840, 0x0840, 0x0840, 0x0020, 0x20C2, 
-    0x8328, 0x9BCA, 0xB4AE, 0xD5B2, 0xE655, 0xEEB7, 0xEEB8, 0xD636, 0x2944, 0x0000, 0x0840, 0x0840, 
-    0x0820, 0x0820, 0x0020, 0x1081, 0x3101, 0xE480, 0xFD80, 0xAB82, 0x30A1, 0x30C0, 0x1880, 0x18A1, 
-    0x6AC7, 0x18A1, 0x2902, 0x8BA9, 0x6AC7, 0x6AC7, 0x20E2, 0x28E1, 0x4901, 0x40E1, 0xD461, 0xFDC2, 
-    0xED63, 0xF561, 0xFD80, 0xFD60, 0xFD01, 0xF4A2, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF481, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 
-    0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2E0, 0xB2E0, 0xB2E0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 
-    0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xC320, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 0xCB40, 
-    0xCB40, 0xCB40, 0xCB60, 0xC2E0, 0xBA80, 0xC2C0, 0xA240, 0xCB80, 0xFD00, 0xFD20, 0x8AE1, 0x1061, 
-    0x1881, 0x0840, 0x1060, 0x0840, 0x0840, 0x0840, 0x0820, 0x1881, 0x72C7, 0x93AA, 0xB48E, 0xCD92, 
-    0xDE35, 0xE697, 0xE6B8, 0xCDD4, 0x18C2, 0x0020, 0x0840, 0x0820, 0x0820, 0x0820, 0x0020, 0x1081, 
-    0x3101, 0xE480, 0xFD80, 0xAB81, 0x30A1, 0x38C0, 0x2060, 0x1060, 0x7328, 0x6AE7, 0x49E5, 0x41A4, 
-    0x6AE8, 0x3984, 0x18A1, 0x38E1, 0x4901, 0x40E1, 0xD441, 0xFDA1, 0xED63, 0xF561, 0xFD80, 0xFD60, 
-    0xFD00, 0xF481, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF481, 0xF481, 
-    0xF481, 0xF481, 0xF481, 0xF481, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2E0, 0xB2E0, 
-    0xB2E0, 0xB2E0, 0xB2E0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xC320, 
-    0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 0xC340, 0xCB40, 0xCB40, 0xCB40, 0xCB60, 0xBAE0, 
-    0xBA80, 0xC2C0, 0xAA40, 0xCB80, 0xFD00, 0xFD20, 0x8AE1, 0x1061, 0x1881, 0x0840, 0x0860, 0x0840, 
-    0x0840, 0x0840, 0x0820, 0x1060, 0x6287, 0x836A, 0xA46D, 0xC571, 0xDE15, 0xE677, 0xE698, 0xB552, 
-    0x1061, 0x0820, 0x0840, 0x0820, 0x0020, 0x0820, 0x0020, 0x1061, 0x3101, 0xE480, 0xFD80, 0xAB81, 
-    0x30A1, 0x38E0, 0x2880, 0x1860, 0x3963, 0x3984, 0x4A05, 0x5245, 0x3122, 0x18A1, 0x28E1, 0x4101, 
-    0x4901, 0x40E1, 0xD441, 0xFDA1, 0xED63, 0xF541, 0xFD80, 0xFD60, 0xFD00, 0xF481, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 
-    0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xBAE0, 0xBAE0, 0xBAE0, 
-    0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB20, 0xC320, 0xC320, 0xC320, 0xC320, 0xC320, 
-    0xC340, 0xC340, 0xC340, 0xCB40, 0xCB40, 0xCB60, 0xCB60, 0xBAE0, 0xBA80, 0xC2C0, 0xAA40, 0xCB80, 
-    0xFD00, 0xFD20, 0x8AE1, 0x1061, 0x18A1, 0x0840, 0x1061, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 
-    0x5226, 0x7B29, 0x9C0C, 0xBD31, 0xD5F4, 0xDE56, 0xE697, 0xA4B0, 0x0820, 0x0840, 0x0840, 0x0820, 
-    0x0820, 0x0820, 0x0000, 0x1081, 0x3101, 0xE480, 0xFD60, 0xAB81, 0x30A1, 0x40E1, 0x30C0, 0x2880, 
-    0x1840, 0x1880, 0x1880, 0x1880, 0x20A1, 0x30C1, 0x40E1, 0x4101, 0x4901, 0x40E1, 0xD441, 0xFDA1, 
-    0xED63, 0xF541, 0xFD80, 0xFD60, 0xFD00, 0xEC81, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF481, 0xF481, 0xF481, 0xF481, 
-    0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 
-    0xB2E0, 0xB2E0, 0xB2E0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 
-    0xBB00, 0xBB00, 0xC320, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 0xC340, 0xC340, 0xCB40, 
-    0xCB40, 0xCB60, 0xCB60, 0xBAE0, 0xBA80, 0xC2C0, 0xAA40, 0xCB80, 0xFD00, 0xFD20, 0x8AE1, 0x1061, 
-    0x18A1, 0x0020, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0000, 0x49C5, 0x72E8, 0x8BCB, 0xB4F0, 
-    0xCDD4, 0xD616, 0xDE77, 0x8C0E, 0x0000, 0x0840, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x1881, 
-    0x3101, 0xE480, 0xFD60, 0xAB81, 0x30A1, 0x4101, 0x38E1, 0x38C0, 0x30A0, 0x2880, 0x28A0, 0x30A0, 
-    0x38C0, 0x40E1, 0x4101, 0x4101, 0x4901, 0x40E1, 0xD441, 0xFDA1, 0xED63, 0xF541, 0xFD80, 0xFD60, 
-    0xFD00, 0xF481, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 
-    0xF481, 0xF481, 0xF481, 0xF481, 0xBAE0, 0xB2E0, 0xB2E0, 0xB2E0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 
-    0xBAE0, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB20, 0xC320, 0xC320, 
-    0xC320, 0xC320, 0xC320, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xCB40, 0xCB60, 0xCB60, 0xBAE0, 
-    0xBA80, 0xC2C0, 0xA240, 0xCB80, 0xFD00, 0xFD20, 0x8AE1, 0x1061, 0x18A1, 0x0820, 0x0840, 0x0820, 
-    0x0820, 0x0820, 0x0820, 0x0000, 0x3143, 0x6AE9, 0x83AC, 0xB511, 0xCDF5, 0xD657, 0xD657, 0x6B2B, 
-    0x0000, 0x0840, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x1881, 0x3101, 0xE480, 0xFD60, 0xAB81, 
-    0x30A1, 0x4101, 0x40E1, 0x40E1, 0x40E1, 0x40E1, 0x40E1, 0x40E1, 0x4101, 0x4101, 0x4101, 0x4101, 
-    0x4901, 0x40E1, 0xD441, 0xFDA1, 0xED63, 0xF541, 0xFD80, 0xFD60, 0xFD00, 0xF481, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 
-    0xBB00, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 
-    0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB20, 0xBB20, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 
-    0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xC340, 0xCB60, 0xBAE0, 0xBA80, 0xC2C0, 0xA240, 0xCB80, 
-    0xFD00, 0xFD20, 0x8AE1, 0x1061, 0x20E2, 0x0861, 0x1061, 0x0861, 0x0840, 0x0861, 0x1061, 0x1061, 
-    0x1081, 0x2924, 0x41E6, 0x5AA9, 0x6B2B, 0x6B4C, 0x5ACA, 0x3165, 0x10A1, 0x1061, 0x0840, 0x0840, 
-    0x0820, 0x0020, 0x0020, 0x1881, 0x3101, 0xE480, 0xFD60, 0xAB81, 0x30A1, 0x4101, 0x40E1, 0x40E1, 
-    0x40E1, 0x40E1, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4901, 0x40E1, 0xD441, 0xFDA1, 
-    0xED63, 0xF541, 0xFD80, 0xFD60, 0xFD00, 0xF481, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF481, 0xF481, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 
-    0xBB00, 0xBB00, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 
-    0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB20, 0xC320, 0xC320, 0xC320, 0xC320, 0xC320, 0xC320, 0xC340, 
-    0xC340, 0xC340, 0xC340, 0xBAC0, 0xB280, 0xC2C0, 0xA240, 0xCB80, 0xFD00, 0xFD20, 0x8AE1, 0x1061, 
-    0x28E2, 0x20C2, 0x18A1, 0x18A1, 0x18A1, 0x18A2, 0x18C2, 0x20C2, 0x20E2, 0x20C2, 0x20C2, 0x20C2, 
-    0x20E2, 0x2903, 0x2923, 0x3144, 0x20E2, 0x20C2, 0x20C2, 0x18A2, 0x18A1, 0x18A1, 0x18A1, 0x20A1, 
-    0x30E1, 0xE480, 0xFD60, 0xAB81, 0x30A1, 0x4101, 0x40E1, 0x40E1, 0x4101, 0x4101, 0x4101, 0x4101, 
-    0x4901, 0x4901, 0x4901, 0x4101, 0x4901, 0x40E1, 0xD441, 0xFDA1, 0xED43, 0xF541, 0xFD80, 0xFD60, 
-    0xFD00, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBAE0, 
-    0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 0xBB00, 0xBB00, 
-    0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB20, 0xBB20, 0xBB20, 0xC320, 0xC320, 0xC320, 0xC340, 0xBAC0, 
-    0xB280, 0xBAC0, 0xA240, 0xCB80, 0xFD00, 0xFD20, 0x8AE1, 0x1061, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 
-    0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20A1, 0x20A1, 
-    0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20A1, 0x30E1, 0xE480, 0xFD60, 0xAB81, 
-    0x30A1, 0x4101, 0x40E1, 0x38C1, 0x2880, 0x2880, 0x2880, 0x2880, 0x2880, 0x2080, 0x38C0, 0x4901, 
-    0x4901, 0x40E1, 0xD441, 0xFDA1, 0xED43, 0xF541, 0xFD80, 0xFD60, 0xFD00, 0xF4A1, 0xF4C1, 0xF4C1, 
-    0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 
-    0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 
-    0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4C1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 
-    0xC320, 0xBB20, 0xBB20, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBAE0, 0xBAE0, 0xB2E0, 0xB2E0, 
-    0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xB2E0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBAE0, 0xBB00, 
-    0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBB20, 0xB2A0, 0xB280, 0xBAA0, 0xA240, 0xC380, 
-    0xFD00, 0xFD20, 0x8AE1, 0x1061, 0x28E1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 
-    0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x20C1, 0x28C1, 0x28C1, 
-    0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x30E1, 0xE480, 0xFD60, 0xAB81, 0x30A1, 0x4921, 0x4101, 0x4101, 
-    0x28E2, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28C1, 0x38E1, 0x4921, 0x4921, 0x40E1, 0xD441, 0xFDA1, 
-    0xED63, 0xF541, 0xFD80, 0xFD60, 0xFD00, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 
-    0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C2, 0xF4C1, 0xF4C2, 0xFCC1, 0xF4C1, 0xF4C1, 0xF4C1, 0xFCC2, 
-    0xFCC2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C1, 0xF4C2, 0xF4C2, 0xF4C1, 0xF4C1, 0xF4C2, 0xF4C1, 0xF4C2, 
-    0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xC340, 0xC340, 0xC320, 0xC320, 
-    0xBB20, 0xBB00, 0xBB00, 0xBB00, 0xBB00, 0xBAE0, 0xBAE0, 0xB2E0, 0xB2E0, 0xB2C0, 0xB2C0, 0xB2C0, 
-    0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2E0, 0xB2E0, 
-    0xB2E0, 0xB2C0, 0xB2E0, 0xB280, 0xB260, 0xBAA0, 0xA240, 0xC380, 0xFD00, 0xFD00, 0xBBE1, 0x1061, 
-    0x1060, 0x1061, 0x1861, 0x1061, 0x1061, 0x1061, 0x1861, 0x1061, 0x1861, 0x1861, 0x1861, 0x1861, 
-    0x1861, 0x1861, 0x1861, 0x1861, 0x1861, 0x1861, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1041, 
-    0x4941, 0xF4E0, 0xFD20, 0xD462, 0x30C1, 0x30A0, 0x38A0, 0x38A0, 0x38C1, 0x38C1, 0x38C1, 0x38C1, 
-    0x38C1, 0x38C1, 0x38C1, 0x38C1, 0x38A1, 0x5141, 0xECE0, 0xFD61, 0xF563, 0xF541, 0xFD80, 0xFD40, 
-    0xFD00, 0xF4C1, 0xF4C1, 0xF4C1, 0xF4C1, 0xFCC1, 0xFCC2, 0xFCC2, 0xFCE2, 0xFCC2, 0xFCC2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCC2, 0xFCC2, 0xFCC2, 0xF4C2, 
-    0xFCC2, 0xF4C2, 0xF4C2, 0xF4C2, 0xC360, 0xC340, 0xC340, 0xC340, 0xC340, 0xC320, 0xC320, 0xBB20, 
-    0xBB20, 0xBB00, 0xBB00, 0xBAE0, 0xB2E0, 0xB2E0, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2A0, 0xAAA0, 0xAAA0, 
-    0xAAA0, 0xAAA0, 0xAAA0, 0xAAA0, 0xAAA0, 0xAAA0, 0xAAA0, 0xAAA0, 0xAAA0, 0xAAA0, 0xB2C0, 0xAA60, 
-    0xAA20, 0xBA80, 0xA220, 0xCB80, 0xFD00, 0xF4C0, 0xFD00, 0xAB82, 0x6221, 0x6A21, 0x6A21, 0x6A21, 
-    0x6A21, 0x6A21, 0x6A21, 0x6A21, 0x6A21, 0x6A41, 0x6A41, 0x6A41, 0x6A41, 0x6A41, 0x6A41, 0x6A41, 
-    0x6A41, 0x6A41, 0x6A41, 0x6A41, 0x6A41, 0x6A41, 0x6A41, 0x7261, 0xD440, 0xFD20, 0xFCE0, 0xFD20, 
-    0xBBE2, 0x7241, 0x7A61, 0x7A61, 0x7A61, 0x7A61, 0x7A61, 0x7A61, 0x7A61, 0x7A61, 0x7A61, 0x8281, 
-    0x8281, 0xD441, 0xFD60, 0xFD41, 0xF563, 0xF540, 0xFD60, 0xFD20, 0xFCE1, 0xF4C2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 
-    0xCB80, 0xCB80, 0xCB80, 0xCB60, 0xCB60, 0xCB60, 0xC360, 0xC340, 0xC340, 0xC340, 0xC320, 0xBB20, 
-    0xBB00, 0xBB00, 0xB2E0, 0xB2E0, 0xB2C0, 0xB2C0, 0xAAA0, 0xAAA0, 0xAA80, 0xAA80, 0xAA80, 0xAA80, 
-    0xAA80, 0xAA80, 0xAA80, 0xA280, 0xA280, 0xAA80, 0xAA80, 0xAA80, 0x9A20, 0xB240, 0xA220, 0xCB80, 
-    0xFD00, 0xF4C0, 0xF4C0, 0xFD00, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 
-    0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD40, 
-    0xFD40, 0xFD40, 0xFD40, 0xFD40, 0xFD20, 0xFCE0, 0xFD00, 0xFD00, 0xFD20, 0xFD40, 0xFD40, 0xFD40, 
-    0xFD40, 0xFD60, 0xFD60, 0xFD60, 0xFD60, 0xFD60, 0xFD60, 0xFD60, 0xFD81, 0xFD60, 0xFD41, 0xFD61, 
-    0xF562, 0xF540, 0xFD60, 0xFCE0, 0xF4C2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFCE2, 0xFD02, 0xFD02, 0xFD02, 
-    0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 
-    0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 
-    0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xD3C0, 0xD3A0, 0xD3A0, 0xD3A0, 
-    0xD3A0, 0xCBA0, 0xCB80, 0xCB80, 0xCB80, 0xCB60, 0xCB60, 0xC340, 0xC340, 0xC320, 0xC320, 0xBB00, 
-    0xBB00, 0xBAE0, 0xB2C0, 0xB2C0, 0xAAA0, 0xAA80, 0xA280, 0xA260, 0xA260, 0xA260, 0xA260, 0xA260, 
-    0xA260, 0xA260, 0xA260, 0x9A40, 0x9A40, 0x91E0, 0xA200, 0xC340, 0xFD00, 0xF4C0, 0xF4E0, 0xF4C0, 
-    0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 
-    0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4E0, 0xF4E0, 0xF4E0, 0xF4E0, 0xF4E0, 0xF4E0, 
-    0xFCE0, 0xFD00, 0xFD00, 0xFD00, 0xFCE0, 0xFCE0, 0xFCE0, 0xFD00, 0xFD00, 0xFD00, 0xFD00, 0xFD00, 
-    0xFD00, 0xFD00, 0xFD00, 0xFD00, 0xFD20, 0xFD20, 0xFD20, 0xFD41, 0xF541, 0xF520, 0xDC00, 0xEC81, 
-    0xFCE2, 0xFCE2, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 
-    0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 
-    0xFD02, 0xFD02, 0xFD22, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 
-    0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xDBE0, 0xD3C0, 0xD3C0, 0xD3C0, 
-    0xD3C0, 0xD3A0, 0xD3A0, 0xD3A0, 0xCB80, 0xCB80, 0xCB60, 0xCB60, 0xC340, 0xC340, 0xBB20, 0xBB00, 
-    0xB2E0, 0xB2C0, 0xAAA0, 0xAA80, 0xA260, 0xA240, 0x9A40, 0x9A40, 0x9A20, 0x9A20, 0x9200, 0x89E0, 
-    0x81A0, 0x6940, 0x6920, 0x9A40, 0xFCC0, 0xF4E0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 
-    0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 0xF4C0, 
-    0xF4C0, 0xF4C0, 0xF4E0, 0xF4E0, 0xF4E0, 0xF4E0, 0xF4E0, 0xF4E0, 0xF4E0, 0xF4E0, 0xF4E0, 0xF4E0, 
-    0xF4E0, 0xF4E0, 0xFCE0, 0xFD00, 0xFD00, 0xFD00, 0xFD00, 0xFD00, 0xFD00, 0xFD00, 0xFD00, 0xFD00, 
-    0xFD20, 0xFD20, 0xFD20, 0xFD60, 0xDC81, 0xBB20, 0xCB80, 0xF4C1, 0xFD01, 0xFD02, 0xFD22, 0xFD22, 
-    0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 
-    0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 
-    0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 
-    0xDC01, 0xDC01, 0xDC01, 0xDC01, 0xDC01, 0xDC01, 0xDC01, 0xDC00, 0xDC00, 0xDC00, 0xDBE0, 0xDBE0, 
-    0xDBE0, 0xDBE0, 0xD3C0, 0xD3C0, 0xD3A0, 0xD3A0, 0xCB80, 0xCB60, 0xC360, 0xC340, 0xBB20, 0xBAE0, 
-    0xB2C0, 0xAA80, 0xA260, 0x9A20, 0x9200, 0x9200, 0x89E0, 0x89E0, 0x79A0, 0x7160, 0x5900, 0x48C0, 
-    0xA280, 0xFCC0, 0xFD00, 0xFD00, 0xFD00, 0xFD00, 0xFD00, 0xFD00, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 
-    0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD20, 
-    0xFD20, 0xFD40, 0xFD40, 0xFD40, 0xFD40, 0xFD40, 0xFD40, 0xFD40, 0xFD40, 0xFD40, 0xFD40, 0xFD40, 
-    0xFD40, 0xFD40, 0xFD40, 0xFD60, 0xFD60, 0xFD60, 0xFD60, 0xFD60, 0xFD60, 0xFD60, 0xFD40, 0xD401, 
-    0xB2E0, 0xDBE0, 0xFD01, 0xFD01, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 
-    0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 
-    0xFD22, 0xFD23, 0xFD43, 0xFD23, 0xFD23, 0xFD23, 0xFD23, 0xFD22, 0xFD23, 0xFD23, 0xFD22, 0xFD23, 
-    0xFD23, 0xFD23, 0xFD22, 0xFD23, 0xFD23, 0xFD23, 0xFD23, 0xFD23, 0xE441, 0xE441, 0xE441, 0xE441, 
-    0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 0xE441, 0xE421, 0xE421, 
-    0xE421, 0xE421, 0xE400, 0xDC00, 0xDBE0, 0xDBE0, 0xD3C0, 0xD3A0, 0xCB80, 0xC340, 0xBB00, 0xB2C0, 
-    0xA280, 0x9A20, 0x9200, 0x89E0, 0x81C0, 0x7980, 0x7160, 0x5900, 0x4080, 0x6960, 0x9A80, 0x9AA0, 
-    0x9AA0, 0xA2C0, 0xA2C0, 0x9AA0, 0x9AA0, 0x9AA0, 0x9AA0, 0xA2A0, 0xA2A0, 0xA2A0, 0xA2C0, 0xA2C0, 
-    0xA2C0, 0xA2C0, 0xA2C0, 0xA2C0, 0xA2C0, 0xA2C0, 0xA2C0, 0xA2C0, 0xA2C0, 0xA2C0, 0xA2C0, 0xA2C0, 
-    0xA2C0, 0xA2C0, 0xA2C0, 0xA2C0, 0xA2C0, 0xA2C0, 0xA2C0, 0xA2E0, 0xA2E0, 0xA2E0, 0xA2E0, 0xA2E0, 
-    0xA2E0, 0xAB00, 0xAB00, 0xA300, 0xB300, 0xC340, 0xAAA0, 0xB2A0, 0xEC40, 0xFD21, 0xFD21, 0xFD22, 
-    0xFD42, 0xFD42, 0xFD42, 0xFD42, 0xFD42, 0xFD42, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 
-    0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 
-    0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 
-    0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xE461, 0xE461, 0xE461, 0xE461, 0xE461, 0xEC61, 0xEC61, 0xEC61, 
-    0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 
-    0xEC81, 0xEC61, 0xEC61, 0xEC61, 0xE441, 0xE441, 0xE420, 0xDC00, 0xD3C0, 0xCB80, 0xBB20, 0xAAA0, 
-    0x9A20, 0x89E0, 0x81A0, 0x7960, 0x6920, 0x48A0, 0x3840, 0x1800, 0x0000, 0x0000, 0x0000, 0x1000, 
-    0x2800, 0x2820, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 
-    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 
-    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3000, 0x2800, 0x2800, 0x0800, 0x0000, 0x0800, 0x1020, 
-    0x50C0, 0x8180, 0xB2C0, 0xEC60, 0xFD21, 0xFD22, 0xFD42, 0xFD42, 0xFD42, 0xFD42, 0xFD43, 0xFD43, 
-    0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 
-    0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 
-    0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 
-    0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC61, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC81, 0xEC82, 
-    0xEC81, 0xEC81, 0xEC82, 0xEC82, 0xECA2, 0xECA2, 0xECA2, 0xECA2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 
-    0xF4A2, 0xF4A2, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xF4A1, 0xEC81, 0xE441, 0xDC21, 0xDBE0, 0xD3C0, 
-    0xD3A0, 0xCBA0, 0xCBA0, 0xCB80, 0xBB60, 0xB360, 0xBB60, 0xCBA0, 0xD3A0, 0xD3A0, 0xD3C0, 0xD3A0, 
-    0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 0xD3C0, 
-    0xD3C1, 0xD3C0, 0xD3C0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 0xD3A0, 
-    0xD3A0, 0xD3A0, 0xCBA0, 0xCBA0, 0xCB80, 0xBB61, 0xBB81, 0xCBC1, 0xE421, 0xEC61, 0xFCE1, 0xFD22, 
-    0xFD42, 0xFD42, 0xFD42, 0xFD42, 0xFD43, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 
-    0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 
-    0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD43, 0xFD63, 0xFD43, 
-    0xFD63, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xEC82, 0xEC82, 0xEC82, 0xEC82, 
-    0xEC82, 0xEC82, 0xEC82, 0xEC82, 0xEC82, 0xEC82, 0xEC82, 0xEC82, 0xECA2, 0xECA2, 0xECA2, 0xECA2, 
-    0xECA2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xFCE2, 0xFCE2, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD22, 
-    0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD22, 0xFD42, 0xFD42, 0xFD42, 0xFD42, 0xFD42, 
-    0xFD42, 0xFD42, 0xFD42, 0xFD42, 0xFD42, 0xFD42, 0xFD42, 0xFD42, 0xFD42, 0xFD42, 0xFD62, 0xFD62, 
-    0xFD42, 0xFD62, 0xFD62, 0xFD62, 0xFD62, 0xFD62, 0xFD62, 0xFD62, 0xFD62, 0xFD62, 0xFD62, 0xFD62, 
-    0xFD62, 0xFD82, 0xFD82, 0xFD82, 0xFD62, 0xFD62, 0xFD42, 0xFD42, 0xFD62, 0xFD63, 0xFD63, 0xFD63, 
-    0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 
-    0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 
-    0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 
-    0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xEC82, 0xEC82, 0xEC82, 0xEC82, 0xEC82, 0xEC82, 0xEC82, 0xEC82, 
-    0xECA2, 0xECA2, 0xECA2, 0xECA2, 0xECA2, 0xECA2, 0xECA2, 0xECA2, 0xECA2, 0xF4A2, 0xF4A2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4C2, 0xF4E2, 0xF4E2, 0xF4E2, 0xF4E2, 0xF4E2, 0xF4E2, 0xF4E2, 0xF4E2, 0xF502, 
-    0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD23, 0xFD23, 0xFD23, 0xFD23, 
-    0xFD23, 0xFD23, 0xFD23, 0xFD23, 0xFD23, 0xFD23, 0xFD23, 0xFD23, 0xFD23, 0xFD23, 0xFD23, 0xFD23, 
-    0xFD43, 0xFD43, 0xFD43, 0xFD23, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 
-    0xFD43, 0xFD43, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 
-    0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 
-    0xFD64, 0xFD64, 0xFD64, 0xFD64, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD64, 0xFD64, 0xFD64, 
-    0xFD64, 0xFD64, 0xFD64, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD64, 0xFD64, 0xFD63, 0xFD63, 
-    0xEC82, 0xEC82, 0xEC82, 0xEC82, 0xEC82, 0xEC82, 0xEC82, 0xECA2, 0xECA2, 0xECA2, 0xECA2, 0xECA2, 
-    0xECA2, 0xECA2, 0xF4C2, 0xF4A2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 0xF4C2, 
-    0xF4C2, 0xF4C2, 0xF4E2, 0xF4E2, 0xF4E2, 0xF4E2, 0xF4E2, 0xF4E2, 0xF4E2, 0xF4E2, 0xF4E2, 0xF4E2, 
-    0xF4E2, 0xF502, 0xF502, 0xF502, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD02, 0xFD23, 0xFD23, 0xFD23, 
-    0xFD23, 0xFD23, 0xFD23, 0xFD23, 0xFD23, 0xFD23, 0xFD23, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 
-    0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 0xFD43, 
-    0xFD43, 0xFD43, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD63, 0xFD83, 
-    0xFD83, 0xFD83, 0xFD63, 0xFD83, 0xFD83, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD64, 
-    0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 
-    0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 
-    0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 0xFD84, 
+static const uint16_t RAPPORT_PIX_LOGO_PALETTE[] = {
+    0xF4A1, 0xFCE2, 0xE4A1, 0xF4C2, 0xD3A0, 0xFD02, 0xC340, 0x38C1, 0xF481, 0xEC61, 0xFCE3, 0xF503,
+    0xFD03, 0xFCA1, 0xB2C0, 0xC320, 0xDBE0, 0xEEB8, 0xCB80, 0xC2C0, 0xFCC2, 0x20C1, 0x2365, 0xFE05,
+    0xDC80, 0xB2C0, 0x72C8, 0x4941, 0xEC20, 0xEC81, 0xECA2, 0xF4A2, 0xD3C0, 0xDBA0, 0x0840, 0xFD23,
+    0xF628, 0x48E0, 0x9C2C, 0xBBA1, 0xFD00, 0xA2C0, 0x6120, 0x59A4, 0x38E2, 0x6A43, 0xFCE0, 0x4922,
+    0xFCC0, 0xB4CE, 0x20E2, 0xF4C0, 0xF4C1, 0x4922, 0xF4E2, 0xBAE0, 0xBB00, 0x1881, 0x62C7, 0x7160,
+    0xFD84, 0xED23, 0xFD22, 0x2880, 0x20C2, 0x2142, 0x5163, 0xC340, 0xCB60, 0x7241, 0x4900, 0xF4C3,
+    0xF4E3, 0xA220, 0xFE04, 0xFDA1, 0x0841, 0xBD51, 0xCDB2, 0x0820, 0x2123, 0x3102, 0xC380, 0xCB80,
+    0x3942, 0x3963, 0xD4A3, 0x38A1, 0x48C0, 0xD441, 0xFDC5, 0x38E2, 0xFD43, 0xFD63, 0x30C2, 0xAB00,
+    0xB2E0, 0x6AA7, 0x6B0A, 0xABE3, 0x8308, 0x9B85, 0xB320, 0xBB00, 0xDC00, 0xE421, 0xED40, 0xED02,
+    0xE401, 0xE441, 0x7328, 0xFE03, 0xFDC2, 0x82C1, 0x8B01, 0x5161, 0x5183, 0xEC82, 0xF481, 0x40E0,
+    0x4101, 0xBC4A, 0xBCAD, 0xBAA0, 0xD615, 0xDE56, 0xC300, 0xCB40, 0xABA2, 0xFD82, 0xE461, 0xEC41,
+    0xDBE0, 0xDC01, 0x4A26, 0x5A46, 0xFD20, 0xFD60, 0x1061, 0x1081, 0xED04, 0xF564, 0x3880, 0x38C0,
+    0x2020, 0x3020, 0x8B23, 0xABC3, 0xE502, 0xE524, 0xED43, 0xF563, 0xC422, 0xD482, 0xFD41, 0xFD42,
+    0xD4A3, 0xE4E2, 0xFD20, 0xFD01, 0x2880, 0x30A1, 0x94AB, 0x950B, 0xA240, 0xA260, 0x1840, 0x1080,
+    0x0860, 0x1060, 0x8BAB, 0x93EB, 0xF5E6, 0xFE26, 0x28E1, 0xF560, 0xFD81, 0xF562, 0xFD62, 0x0820,
+    0x1040, 0x2385, 0x2BE6, 0x844A, 0x93EA, 0x48E0, 0x4921, 0x53A9, 0x6221, 0x6202, 0x31C4, 0x3325,
+    0x8369, 0x8BA9, 0x18A2, 0x5900, 0x5141, 0xC3C1, 0xD440, 0x4942, 0x4983, 0x3101, 0x3123, 0x7980,
+    0x89C0, 0xF5A4, 0xFDE4, 0xED65, 0xEDC5, 0xB260, 0xB2A0, 0x18E1, 0x28C1, 0xA361, 0xAB82, 0x3901,
+    0x4122, 0x10A1, 0x18A1, 0x9200, 0x9A40, 0x0800, 0x30C0, 0x3101, 0x2080, 0x20A1, 0x0000, 0x0021,
+    0xF5A2, 0xFDC1, 0x6A45, 0x6A67, 0xA46D, 0xA48E, 0x38E0, 0x40E1, 0xB50F, 0xBD10, 0x8AE1, 0x9322,
+    0x6205, 0x6266, 0xA280, 0xAAA0, 0xECE0, 0xECE1, 0xED84, 0xFDE3, 0x3B86, 0x4C48, 0xFDA3, 0xFE02,
+    0x7349, 0x7409, 0xEE11, 0xEEB7,
+};
+
+static const uint8_t RAPPORT_PIX_LOGO_DATA[] = {
+    0x42, 0x68, 0x41, 0x69, 0x44, 0x6D, 0x44, 0x83, 0x47, 0x09, 0x43, 0x1D, 0x47, 0x08, 0x4F, 0x1F,
+    0x4D, 0x03, 0x43, 0x47, 0x01, 0x48, 0x47, 0x55, 0x48, 0x4A, 0x47, 0x49, 0x03, 0x4B, 0x1F, 0x01,
+    0x76, 0x75, 0x81, 0x00, 0x69, 0x44, 0x6D, 0x44, 0x83, 0x47, 0x09, 0x43, 0x1D, 0x47, 0x08, 0x00,
+    0x76, 0x4D, 0x1F, 0x4D, 0x03, 0x43, 0x47, 0x01, 0x48, 0x47, 0x5A, 0x48, 0x01, 0x47, 0x48, 0x48,
+    0x47, 0x49, 0x03, 0x4A, 0x1F, 0x00, 0x76, 0x00, 0x68, 0x44, 0x6D, 0x44, 0x83, 0x48, 0x09, 0x42,
+    0x1D, 0x45, 0x08, 0x50, 0x1F, 0x4A, 0x03, 0x46, 0x47, 0x63, 0x48, 0x01, 0x47, 0x48, 0x8D, 0x41,
+    0x03, 0x49, 0x1F, 0x43, 0x6D, 0x44, 0x83, 0x48, 0x09, 0x43, 0x1D, 0x45, 0x08, 0x5C, 0x1F, 0x47,
+    0x03, 0x50, 0x47, 0x55, 0x48, 0x43, 0x47, 0x4B, 0x03, 0x87, 0x81, 0x45, 0x83, 0x47, 0x09, 0x43,
+    0x1D, 0x45, 0x08, 0x00, 0x00, 0x48, 0x1F, 0x02, 0x03, 0x75, 0x47, 0x45, 0x48, 0x00, 0x0B, 0x42,
+    0x48, 0x45, 0x0B, 0x53, 0x8C, 0x41, 0xCF, 0x00, 0x8C, 0x43, 0xCF, 0x41, 0x47, 0x85, 0x00, 0x0A,
+    0x81, 0x00, 0x0A, 0x4D, 0x48, 0x00, 0x47, 0x4B, 0x03, 0x86, 0x00, 0x6D, 0x44, 0x83, 0x48, 0x09,
+    0x42, 0x1D, 0x45, 0x08, 0x41, 0x00, 0x47, 0x1F, 0x03, 0x03, 0x1F, 0x98, 0xF5, 0x47, 0x97, 0x44,
+    0xFA, 0x4A, 0xCD, 0x49, 0x5A, 0x00, 0x17, 0x46, 0xAC, 0x00, 0xAD, 0x41, 0x24, 0x01, 0xCF, 0x47,
+    0x82, 0x00, 0x0A, 0x41, 0x48, 0x44, 0x0A, 0x81, 0x41, 0x0A, 0x49, 0x48, 0x00, 0x47, 0x4B, 0x03,
+    0x84, 0x45, 0x83, 0x87, 0x43, 0x1D, 0x84, 0x41, 0x00, 0x46, 0x1F, 0x05, 0x03, 0x1C, 0xC5, 0x29,
+    0x18, 0xE4, 0x41, 0xB2, 0x44, 0x81, 0x44, 0xE4, 0x4B, 0xFA, 0x48, 0xCE, 0x42, 0x4A, 0x46, 0x17,
+    0x03, 0x5A, 0xAD, 0x24, 0x8D, 0x44, 0x48, 0x4B, 0x0A, 0x00, 0x48, 0x41, 0x0A, 0x45, 0x48, 0x41,
+    0x36, 0x8E, 0x84, 0x47, 0x09, 0x42, 0x1D, 0x46, 0x08, 0x00, 0x00, 0x46, 0x1F, 0x09, 0x03, 0xC5,
+    0x29, 0xA5, 0x7E, 0xE4, 0xB2, 0x81, 0xB2, 0x9C, 0x48, 0x9D, 0x53, 0x94, 0x49, 0x95, 0x02, 0x5A,
+    0xAD, 0x5A, 0x41, 0x24, 0x01, 0xE4, 0x3D, 0x8E, 0x44, 0x0A, 0x44, 0x48, 0x8A, 0x41, 0x03, 0x82,
+    0x82, 0x49, 0x09, 0x88, 0x43, 0x00, 0x83, 0x0A, 0x03, 0x9C, 0xF2, 0xD5, 0xEE, 0xC5, 0xE4, 0x81,
+    0x9C, 0x1B, 0xDE, 0x4A, 0x07, 0x00, 0xC9, 0x43, 0x07, 0x43, 0xC9, 0x46, 0x78, 0x00, 0xD7, 0x47,
+    0xD8, 0x07, 0x2F, 0x35, 0x54, 0x1B, 0x98, 0xAD, 0xAC, 0x24, 0x41, 0x70, 0x00, 0xB2, 0x92, 0x42,
+    0x0A, 0x00, 0x48, 0x43, 0x36, 0x4A, 0x03, 0x81, 0x81, 0x49, 0x09, 0x42, 0x1D, 0x45, 0x08, 0x42,
+    0x00, 0x45, 0x1F, 0x04, 0x03, 0x12, 0xA5, 0x29, 0xDC, 0x81, 0x02, 0xE4, 0xBD, 0x90, 0x47, 0x07,
+    0x05, 0x78, 0xD7, 0x78, 0xD7, 0x07, 0x78, 0x41, 0xD7, 0x43, 0xD8, 0x43, 0x2F, 0x43, 0x35, 0x04,
+    0xC7, 0x35, 0xC7, 0x42, 0xC7, 0x45, 0x42, 0x09, 0x74, 0x54, 0x73, 0x5A, 0xAD, 0xAC, 0xE4, 0x70,
+    0x4B, 0x23, 0x94, 0x41, 0x0A, 0x01, 0x48, 0x0A, 0x41, 0x36, 0x8B, 0x00, 0x83, 0x49, 0x09, 0x43,
+    0x1D, 0x46, 0x08, 0x42, 0x00, 0x85, 0x08, 0x7E, 0xA5, 0x0E, 0xDB, 0x27, 0xE4, 0x97, 0x74, 0xDE,
+    0x81, 0x02, 0xA0, 0x8F, 0xC9, 0x81, 0x02, 0x78, 0x8F, 0xA0, 0x41, 0x07, 0x07, 0xE6, 0xD8, 0x78,
+    0x07, 0x8F, 0xEB, 0x78, 0xD7, 0x41, 0xEB, 0x06, 0x07, 0x2F, 0x78, 0xEB, 0x2F, 0x78, 0xEB, 0x41,
+    0x2F, 0x07, 0xEB, 0x73, 0x2F, 0x78, 0x42, 0x35, 0x78, 0x35, 0x41, 0x42, 0x01, 0xC7, 0xCD, 0x84,
+    0x02, 0x9B, 0x48, 0x0C, 0x56, 0x0A, 0x42, 0x36, 0x8A, 0x96, 0x46, 0x1F, 0x02, 0x03, 0x06, 0xF2,
+    0x81, 0x00, 0xC5, 0x84, 0x28, 0xC9, 0x61, 0x74, 0xA0, 0xC7, 0xC8, 0x07, 0x86, 0x61, 0x74, 0x61,
+    0xE8, 0xD7, 0x78, 0xF0, 0x61, 0x87, 0x42, 0x35, 0x2B, 0xF0, 0x61, 0xD8, 0xF0, 0x61, 0x2F, 0x87,
+    0x1A, 0x2B, 0x87, 0x1A, 0x2F, 0x87, 0x1A, 0x35, 0x74, 0x64, 0x2B, 0x2F, 0x42, 0x73, 0x81, 0x00,
+    0x24, 0x85, 0x41, 0x0C, 0x81, 0x00, 0x0C, 0x94, 0x00, 0x36, 0x48, 0x03, 0x00, 0x1F, 0x8A, 0x00,
+    0x09, 0x43, 0x1D, 0x86, 0x41, 0x00, 0x86, 0x00, 0xA5, 0x83, 0x0F, 0x5D, 0x74, 0xA1, 0x07, 0xE9,
+    0x26, 0xEC, 0x54, 0x26, 0xED, 0xA0, 0x4D, 0xC0, 0x1A, 0xED, 0x1A, 0x41, 0x35, 0x19, 0x4D, 0xC0,
+    0x61, 0x7A, 0xE9, 0x64, 0xEC, 0xE8, 0x26, 0x31, 0xE8, 0x26, 0xEC, 0x26, 0x1A, 0xED, 0x26, 0x64,
+    0xED, 0x26, 0x1A, 0x31, 0xE8, 0xED, 0x2B, 0x35, 0x8B, 0x44, 0x0C, 0x00, 0x0A, 0x42, 0x0C, 0x4C,
+    0x0A, 0x00, 0x01, 0x8B, 0x41, 0x83, 0x4B, 0x09, 0x43, 0x1D, 0x45, 0x08, 0x8A, 0x00, 0x27, 0x82,
+    0x2D, 0x90, 0xF0, 0xE9, 0xA6, 0x78, 0xC8, 0xE9, 0xEC, 0x2B, 0xEC, 0xAA, 0xE6, 0x4D, 0x64, 0xEB,
+    0x35, 0xED, 0xAA, 0xA0, 0x26, 0x4D, 0x8E, 0xED, 0xAB, 0xE9, 0xE8, 0xAB, 0x26, 0x31, 0x26, 0x87,
+    0xE8, 0xAA, 0x2B, 0xE9, 0xC1, 0xC0, 0xE8, 0x90, 0xAB, 0xAA, 0xEB, 0x73, 0xF6, 0xAD, 0xAC, 0x8C,
+    0x44, 0x0C, 0x4C, 0x0A, 0x00, 0x01, 0x41, 0x36, 0x88, 0x42, 0x83, 0x4B, 0x09, 0x45, 0x1D, 0x43,
+    0x08, 0x00, 0x76, 0x85, 0x00, 0xF2, 0x85, 0x23, 0xA0, 0xC8, 0xEC, 0xF0, 0xC0, 0xAA, 0x4D, 0xEC,
+    0x26, 0xEC, 0xF0, 0xE6, 0x4E, 0x61, 0xD8, 0x35, 0x4D, 0x64, 0x2B, 0x31, 0x4D, 0xE7, 0x4D, 0x64,
+    0x42, 0xEC, 0x4E, 0x1A, 0xEC, 0xAA, 0xE6, 0x64, 0xEC, 0x26, 0x61, 0xED, 0x41, 0x31, 0x03, 0xE6,
+    0xED, 0x61, 0x46, 0x95, 0x42, 0x0C, 0x8A, 0x00, 0x01, 0x88, 0x00, 0x03, 0x47, 0x83, 0x48, 0x09,
+    0x45, 0x1D, 0x42, 0x08, 0x41, 0x76, 0x02, 0x1F, 0x75, 0x1F, 0x85, 0x11, 0x97, 0x74, 0xDE, 0xA0,
+    0xF1, 0xE9, 0x64, 0x61, 0x74, 0xC8, 0x6E, 0x61, 0xA0, 0xC7, 0x26, 0xAA, 0x35, 0x78, 0x41, 0xAA,
+    0x17, 0x1A, 0xE7, 0x2B, 0x64, 0x61, 0x8F, 0x35, 0x1A, 0x2B, 0x1A, 0x64, 0x26, 0xE6, 0xAA, 0x26,
+    0x2B, 0xAB, 0x26, 0x74, 0x1A, 0xEC, 0x64, 0x2F, 0x42, 0x96, 0x00, 0x0A, 0x41, 0x0C, 0x87, 0x41,
+    0x01, 0x41, 0x36, 0x88, 0x44, 0x6D, 0x45, 0x83, 0x48, 0x09, 0x46, 0x1D, 0x42, 0x75, 0x86, 0x03,
+    0x5D, 0x73, 0xDE, 0x78, 0x42, 0xA0, 0x00, 0x8F, 0x41, 0x07, 0x01, 0x8E, 0x8F, 0x41, 0x78, 0x41,
+    0x8E, 0x41, 0x78, 0x01, 0x8E, 0x8F, 0x41, 0xEB, 0x00, 0x78, 0x41, 0xEB, 0x03, 0x35, 0x2F, 0x78,
+    0x2F, 0x41, 0x78, 0x04, 0xEB, 0x2F, 0xEB, 0x78, 0x2F, 0x41, 0x78, 0x03, 0x35, 0x2F, 0xEB, 0x2F,
+    0x41, 0x42, 0x00, 0xC7, 0x95, 0x42, 0x0C, 0x89, 0x41, 0x01, 0x00, 0x36, 0x87, 0x48, 0x6D, 0x44,
+    0x83, 0x48, 0x09, 0x45, 0x1D, 0x86, 0x03, 0x81, 0xFA, 0x92, 0x90, 0x41, 0xA1, 0x00, 0xDE, 0x43,
+    0xA1, 0x41, 0x07, 0x00, 0xA1, 0x4D, 0x07, 0x41, 0x2C, 0x46, 0xD7, 0x41, 0x2F, 0x00, 0xD7, 0x43,
+    0x2F, 0x01, 0x5B, 0x45, 0x41, 0x17, 0x96, 0x00, 0x0C, 0x8B, 0x00, 0x36, 0x86, 0x45, 0x69, 0x47,
+    0x6D, 0x43, 0x83, 0x46, 0x09, 0x44, 0x1D, 0x00, 0x1E, 0x82, 0x05, 0xDC, 0x27, 0xE4, 0xB2, 0x8D,
+    0x92, 0x4A, 0xBD, 0x42, 0x45, 0x59, 0x2D, 0x01, 0x92, 0x95, 0x82, 0x00, 0xB1, 0x81, 0x00, 0xB2,
+    0x91, 0x46, 0x0A, 0x44, 0x01, 0x88, 0x01, 0x69, 0x68, 0x4A, 0x69, 0x43, 0x6D, 0x43, 0x83, 0x48,
+    0x09, 0x00, 0x75, 0x86, 0x01, 0xB2, 0xE4, 0x47, 0xFA, 0x44, 0xF7, 0x42, 0xCE, 0x47, 0x4A, 0x00,
+    0xCE, 0x41, 0x4A, 0x4A, 0x17, 0x00, 0xAD, 0x42, 0x17, 0x00, 0x5A, 0x97, 0x00, 0x0C, 0x46, 0x0A,
+    0x45, 0x01, 0x86, 0x02, 0x68, 0x69, 0x68, 0x4C, 0x69, 0x44, 0x6D, 0x41, 0x83, 0x8E, 0x02, 0x81,
+    0xB2, 0x6A, 0x41, 0xF5, 0x01, 0x6B, 0x6A, 0x50, 0x6B, 0x02, 0x96, 0x5D, 0xF7, 0x42, 0xFA, 0x00,
+    0xF7, 0x43, 0x96, 0x47, 0x8C, 0x9A, 0x02, 0x0C, 0x0A, 0x0C, 0x88, 0x00, 0x36, 0x86, 0x47, 0x68,
+    0x41, 0x6C, 0x48, 0x69, 0x44, 0x6D, 0x41, 0x83, 0x86, 0x00, 0x19, 0x83, 0x02, 0x6B, 0xBC, 0xD4,
+    0x42, 0xDE, 0x52, 0xDF, 0x02, 0xD7, 0x98, 0xF7, 0x81, 0x01, 0x71, 0xC4, 0x46, 0x73, 0x43, 0x2B,
+    0x01, 0x92, 0x4A, 0x99, 0x00, 0x0C, 0x43, 0x0A, 0x45, 0x01, 0x87, 0x82, 0x46, 0x84, 0x41, 0x68,
+    0x42, 0x6C, 0x46, 0x69, 0x44, 0x6D, 0x41, 0x83, 0x02, 0x6D, 0x09, 0x0F, 0x84, 0x03, 0xE4, 0xD5,
+    0xE3, 0xDA, 0x4A, 0xB4, 0x45, 0xA9, 0x0A, 0x8A, 0xA9, 0x4C, 0x22, 0x8A, 0xA7, 0x54, 0x97, 0x6F,
+    0x98, 0x5E, 0x45, 0x35, 0x07, 0xC7, 0x35, 0x46, 0x78, 0x2F, 0xC8, 0x35, 0x95, 0x84, 0x00, 0x9B,
+    0x93, 0x44, 0x0A, 0x86, 0x00, 0x36, 0x85, 0x4D, 0x84, 0x41, 0x85, 0x41, 0x6C, 0x46, 0x69, 0x44,
+    0x6D, 0x85, 0x04, 0x81, 0xE4, 0xEE, 0x8A, 0x15, 0x42, 0x4F, 0x4F, 0xB4, 0x41, 0x4F, 0x14, 0xE2,
+    0xDA, 0xC9, 0x94, 0x6F, 0x65, 0x5B, 0xC4, 0x35, 0xC4, 0x73, 0xC4, 0x73, 0xC4, 0x74, 0x61, 0xC0,
+    0xF1, 0x42, 0xC7, 0x9C, 0x84, 0x00, 0xB2, 0x97, 0x46, 0x01, 0x87, 0x00, 0x84, 0x4C, 0x10, 0x00,
+    0x84, 0x43, 0x85, 0x41, 0x6C, 0x44, 0x69, 0x8B, 0x02, 0xEF, 0x8A, 0xD3, 0x41, 0xA9, 0x01, 0xA6,
+    0xA7, 0x41, 0xE0, 0x42, 0x3F, 0x43, 0xA0, 0x42, 0x3F, 0x41, 0xE0, 0x41, 0xA6, 0x04, 0xB4, 0x4F,
+    0x39, 0xC9, 0x3D, 0x83, 0x01, 0x2F, 0x46, 0x41, 0x2F, 0x03, 0x35, 0x2F, 0x1A, 0x4E, 0x41, 0x4D,
+    0x01, 0x2B, 0x2F, 0x85, 0x00, 0x9B, 0x92, 0x44, 0x0A, 0x47, 0x01, 0x46, 0x03, 0x50, 0x10, 0x43,
+    0x85, 0x00, 0x6C, 0x46, 0x69, 0x82, 0x02, 0xD1, 0x19, 0x49, 0x83, 0x04, 0x4C, 0x32, 0x39, 0xA6,
+    0xE0, 0x41, 0x3F, 0x00, 0xDE, 0x41, 0x8F, 0x00, 0x57, 0x43, 0x77, 0x41, 0x8F, 0x05, 0xDE, 0xA0,
+    0x3F, 0xE0, 0xA6, 0xA9, 0x82, 0x05, 0x94, 0x6F, 0x63, 0x5B, 0x2F, 0xE7, 0x41, 0x64, 0x08, 0x1A,
+    0x64, 0xC0, 0xF0, 0x1A, 0x26, 0xE6, 0xC4, 0xC7, 0x99, 0x41, 0x0C, 0x91, 0x82, 0x48, 0x21, 0x46,
+    0x10, 0x43, 0x85, 0x41, 0x6C, 0x44, 0x69, 0x00, 0x6D, 0x86, 0x00, 0xEE, 0x82, 0x03, 0xE0, 0xA0,
+    0xDE, 0x8F, 0x41, 0x77, 0x01, 0x25, 0x46, 0x41, 0xB9, 0x01, 0xF2, 0xC3, 0x41, 0x25, 0x05, 0x77,
+    0x8F, 0xA0, 0x3F, 0xE0, 0xA6, 0x84, 0x0C, 0x65, 0x5B, 0x78, 0x1A, 0x4D, 0xED, 0xAA, 0xE8, 0xAA,
+    0x1A, 0xF0, 0xAB, 0x74, 0x87, 0x00, 0xB2, 0x96, 0x48, 0x01, 0x86, 0x41, 0x21, 0x4B, 0x20, 0x41,
+    0x21, 0x43, 0x10, 0x00, 0x84, 0x44, 0x85, 0x8C, 0x0D, 0xB3, 0x32, 0xDA, 0xE0, 0xA1, 0x8F, 0x77,
+    0x25, 0xB9, 0xC3, 0x2A, 0xA5, 0xCB, 0x21, 0x41, 0xC3, 0x05, 0xB9, 0x46, 0x77, 0x8F, 0xA0, 0x3F,
+    0x85, 0x08, 0x63, 0x5B, 0xBA, 0x2B, 0xC0, 0x64, 0xE7, 0x64, 0x2B, 0x41, 0xE6, 0x01, 0xAB, 0x2B,
+    0x83, 0x00, 0xD0, 0x82, 0x00, 0x9B, 0x93, 0x42, 0x0A, 0x49, 0x01, 0x85, 0x46, 0x20, 0x00, 0x04,
+    0x48, 0x20, 0x00, 0x21, 0x44, 0x10, 0x43, 0x85, 0x00, 0x6C, 0x89, 0x00, 0xEF, 0x81, 0x05, 0xE1,
+    0x3F, 0xDE, 0x77, 0x46, 0xB9, 0x41, 0x2A, 0x04, 0xCB, 0x21, 0x3B, 0x1C, 0xCC, 0x41, 0x2A, 0x03,
+    0xC3, 0x46, 0x77, 0x8F, 0x88, 0x01, 0xC4, 0x2F, 0x41, 0xB9, 0x41, 0x2F, 0x06, 0x35, 0xC4, 0x35,
+    0x2F, 0xC4, 0x42, 0x35, 0x85, 0x00, 0xB2, 0x93, 0x41, 0x0C, 0x4A, 0x01, 0x85, 0x81, 0x4B, 0x04,
+    0x44, 0x20, 0x00, 0x21, 0x82, 0x41, 0x84, 0x43, 0x85, 0x03, 0x6C, 0x69, 0x0F, 0xD2, 0x84, 0x00,
+    0xEE, 0x83, 0x03, 0x8F, 0x25, 0xB9, 0x2A, 0x41, 0x3B, 0x81, 0x02, 0xDB, 0x37, 0xD2, 0x41, 0x3B,
+    0x05, 0x2A, 0xC3, 0x25, 0x57, 0xA0, 0x90, 0x86, 0x00, 0x2F, 0x45, 0xD8, 0x42, 0x55, 0x02, 0xC7,
+    0x42, 0x2F, 0x9B, 0x00, 0x05, 0x90, 0x4F, 0x04, 0x44, 0x20, 0x42, 0x10, 0x41, 0x84, 0x43, 0x85,
+    0x8B, 0x03, 0xA0, 0x77, 0x46, 0xC3, 0x81, 0x41, 0xCC, 0x04, 0x19, 0xA4, 0xD1, 0xDB, 0xCB, 0x81,
+    0x02, 0x2A, 0xB9, 0x77, 0x88, 0x00, 0x15, 0x45, 0x8B, 0x00, 0xA7, 0x42, 0xD9, 0x00, 0xCA, 0x81,
+    0x00, 0x4A, 0x99, 0x4A, 0x01, 0x00, 0x14, 0x85, 0x83, 0x41, 0x12, 0x41, 0x53, 0x41, 0x12, 0x47,
+    0x04, 0x43, 0x20, 0x00, 0x21, 0x41, 0x10, 0x42, 0x84, 0x87, 0x41, 0xB0, 0x85, 0x06, 0xB9, 0x2A,
+    0x3B, 0xDB, 0xA5, 0xD1, 0x7E, 0x41, 0x7B, 0x06, 0xD1, 0xA4, 0x49, 0x3B, 0xC3, 0xB9, 0x25, 0x85,
+    0x04, 0xFB, 0x93, 0x57, 0xE1, 0x4C, 0x46, 0x8A, 0x03, 0x8B, 0x4C, 0x32, 0xC7, 0x85, 0x00, 0x9B,
+    0x94, 0x01, 0x0A, 0x05, 0x49, 0x01, 0x00, 0x14, 0x84, 0x01, 0x04, 0x12, 0x49, 0x53, 0x00, 0x12,
+    0x45, 0x04, 0x43, 0x20, 0x00, 0x21, 0x41, 0x10, 0x42, 0x84, 0x01, 0x85, 0x6C, 0x8F, 0x03, 0x1C,
+    0x30, 0x05, 0x3E, 0x41, 0x9B, 0x05, 0x3E, 0x01, 0x30, 0x59, 0x37, 0x2A, 0x81, 0x00, 0xE0, 0x83,
+    0x01, 0x6F, 0x63, 0x81, 0x00, 0x8A, 0x47, 0x8B, 0x02, 0x8A, 0x32, 0x35, 0x85, 0x00, 0xB2, 0x94,
+    0x00, 0x0C, 0x4A, 0x01, 0x85, 0x4E, 0x53, 0x45, 0x04, 0x43, 0x20, 0x41, 0x10, 0x42, 0x84, 0x00,
+    0x85, 0x81, 0x03, 0x37, 0x49, 0xC5, 0xAF, 0x86, 0x02, 0xC3, 0x2A, 0xCB, 0x82, 0x01, 0x9B, 0xB2,
+    0x81, 0x06, 0x2E, 0x30, 0x67, 0x43, 0xA5, 0x8E, 0x8F, 0x83, 0x02, 0x9D, 0x6F, 0x93, 0x81, 0x02,
+    0x4C, 0x8B, 0x8A, 0x88, 0x02, 0x56, 0x4A, 0xCF, 0x95, 0x41, 0x05, 0x01, 0x0C, 0x05, 0x4B, 0x01,
+    0x00, 0x36, 0x83, 0x84, 0x43, 0x44, 0x46, 0x53, 0x45, 0x04, 0x43, 0x20, 0x01, 0x21, 0x10, 0x84,
+    0x02, 0x19, 0x49, 0x27, 0x89, 0x02, 0x3B, 0x21, 0x2E, 0x85, 0x03, 0x0D, 0xCC, 0x7B, 0xF3, 0x84,
+    0x02, 0x51, 0x9D, 0xFB, 0x82, 0x00, 0x8A, 0x47, 0x8B, 0x81, 0x00, 0x2F, 0x85, 0x00, 0x9B, 0x93,
+    0x00, 0x05, 0x4B, 0x01, 0x00, 0x14, 0x44, 0x03, 0x81, 0x4A, 0x44, 0x43, 0x53, 0x00, 0x12, 0x44,
+    0x04, 0x84, 0x00, 0x10, 0x88, 0x00, 0x72, 0x84, 0x00, 0xB9, 0x81, 0x0E, 0x13, 0x2E, 0x01, 0x3E,
+    0x9B, 0x3E, 0x05, 0x30, 0x1C, 0x12, 0x21, 0x2A, 0x57, 0xA0, 0x90, 0x83, 0x00, 0x70, 0x81, 0x01,
+    0x40, 0x4C, 0x42, 0x8A, 0x84, 0x01, 0x4C, 0x40, 0x86, 0x00, 0xB2, 0x92, 0x00, 0x0C, 0x41, 0x05,
+    0x4C, 0x01, 0x83, 0x4D, 0x44, 0x43, 0x53, 0x41, 0x12, 0x43, 0x04, 0x43, 0x20, 0x02, 0x21, 0x10,
+    0x84, 0x8F, 0x03, 0xDB, 0x76, 0x2E, 0x01, 0x41, 0x05, 0x41, 0x30, 0x04, 0x21, 0xD2, 0x3B, 0xB9,
+    0x77, 0x83, 0x00, 0xC9, 0x83, 0x00, 0xD8, 0x41, 0x5E, 0x45, 0x51, 0x02, 0x2C, 0x51, 0xD8, 0x98,
+    0x01, 0x05, 0x0C, 0x42, 0x05, 0x8B, 0x00, 0x14, 0x83, 0x84, 0x03, 0x43, 0x7F, 0x44, 0x43, 0x45,
+    0x44, 0x44, 0x53, 0x00, 0x12, 0x44, 0x04, 0x42, 0x20, 0x00, 0x21, 0x84, 0x00, 0x12, 0x87, 0x05,
+    0x46, 0xC3, 0x2A, 0x3B, 0xA5, 0x1C, 0x42, 0x76, 0x02, 0x1C, 0x21, 0x3B, 0x41, 0xC3, 0x01, 0xB9,
+    0x8F, 0x88, 0x01, 0x35, 0x2F, 0x41, 0xBA, 0x41, 0xB9, 0x41, 0x2F, 0x01, 0xB9, 0x2F, 0x41, 0xC4,
+    0x98, 0x00, 0x0C, 0x44, 0x05, 0x4B, 0x01, 0x83, 0x81, 0x00, 0x43, 0x46, 0x06, 0x00, 0x43, 0x45,
+    0x44, 0x44, 0x53, 0x44, 0x04, 0x42, 0x20, 0x00, 0x10, 0x83, 0x00, 0x52, 0x86, 0x06, 0x8F, 0x25,
+    0xC3, 0xDB, 0xA5, 0xA4, 0x19, 0x41, 0x7E, 0x09, 0x43, 0x7E, 0xA5, 0x49, 0xDC, 0x3B, 0x57, 0x8F,
+    0x3F, 0xA6, 0x81, 0x00, 0x51, 0x84, 0x02, 0xD8, 0x2B, 0x86, 0x41, 0xF0, 0x05, 0x2B, 0x74, 0xF0,
+    0x74, 0x2F, 0x35, 0x84, 0x02, 0xE5, 0x4B, 0x9B, 0x95, 0x4B, 0x01, 0x00, 0x14, 0x83, 0x00, 0x43,
+    0x4B, 0x06, 0x45, 0x44, 0x43, 0x53, 0x00, 0x12, 0x43, 0x04, 0x82, 0x00, 0x67, 0x84, 0x00, 0xAF,
+    0x83, 0x04, 0x3F, 0x8F, 0x77, 0xB9, 0xF2, 0x42, 0x43, 0x81, 0x41, 0x67, 0x41, 0x43, 0x01, 0x0F,
+    0xCB, 0x41, 0x8F, 0x8A, 0x02, 0xE7, 0x1A, 0x61, 0x41, 0xE7, 0x02, 0x2B, 0x61, 0xF1, 0x9A, 0x45,
+    0x05, 0x8A, 0x00, 0x36, 0x83, 0x4D, 0x06, 0x45, 0x44, 0x43, 0x53, 0x45, 0x04, 0x00, 0x20, 0x83,
+    0x00, 0x12, 0x83, 0x00, 0xD3, 0x81, 0x04, 0xA0, 0x8F, 0x77, 0x57, 0x25, 0x41, 0xB9, 0x41, 0xC3,
+    0x41, 0xB9, 0x02, 0x25, 0x58, 0x57, 0x41, 0x8F, 0x01, 0xA0, 0xE0, 0x87, 0x0A, 0x2F, 0xEB, 0xD7,
+    0x2F, 0xEB, 0x46, 0x2F, 0x2C, 0xEB, 0xD7, 0x46, 0x98, 0x46, 0x05, 0x8A, 0x00, 0x14, 0x83, 0x84,
+    0x42, 0x0F, 0x47, 0x06, 0x44, 0x44, 0x43, 0x53, 0x00, 0x12, 0x88, 0x00, 0x52, 0x83, 0x41, 0xCA,
+    0x03, 0xE0, 0xA0, 0xDE, 0x07, 0x42, 0x77, 0x43, 0x46, 0x42, 0x77, 0x05, 0x8F, 0xDE, 0x3F, 0xE0,
+    0xA6, 0xB4, 0x85, 0x02, 0x5E, 0xD8, 0xBE, 0x44, 0xBF, 0x41, 0xF8, 0x03, 0x16, 0xF8, 0x35, 0x46,
+    0x85, 0x00, 0x9A, 0x8D, 0x47, 0x05, 0x4B, 0x01, 0x00, 0x36, 0x83, 0x81, 0x48, 0x0F, 0x45, 0x06,
+    0x45, 0x44, 0x42, 0x53, 0x00, 0x12, 0x85, 0x00, 0x37, 0x85, 0x01, 0x32, 0x50, 0x49, 0x40, 0x03,
+    0x32, 0xD3, 0x40, 0xD3, 0x44, 0x40, 0x04, 0xDA, 0x39, 0x40, 0x51, 0x02, 0x81, 0x01, 0xA1, 0xAE,
+    0x49, 0xB6, 0x00, 0x54, 0x91, 0x01, 0x05, 0x0C, 0x41, 0x05, 0x00, 0x0C, 0x85, 0x41, 0x01, 0x00,
+    0x05, 0x89, 0x44, 0x03, 0x4D, 0x0F, 0x44, 0x06, 0x44, 0x44, 0x43, 0x53, 0x00, 0x12, 0x41, 0x04,
+    0x83, 0x01, 0x12, 0x9A, 0x82, 0x00, 0xE1, 0x47, 0xDA, 0x44, 0x15, 0x01, 0x40, 0x15, 0x46, 0x40,
+    0x00, 0x15, 0x83, 0x03, 0x3F, 0x15, 0xB5, 0xF8, 0x41, 0xF9, 0x00, 0xBB, 0x42, 0xF9, 0x01, 0xF8,
+    0xB5, 0x82, 0x00, 0x6F, 0x81, 0x41, 0x4B, 0x89, 0x4B, 0x05, 0x4B, 0x01, 0x41, 0x14, 0x83, 0x81,
+    0x48, 0x66, 0x43, 0x0F, 0x44, 0x06, 0x44, 0x44, 0x43, 0x53, 0x00, 0x12, 0x81, 0x01, 0x7B, 0x13,
+    0x85, 0x01, 0x15, 0xE1, 0x55, 0x15, 0x81, 0x01, 0xE5, 0x92, 0x81, 0x02, 0x16, 0xA3, 0xA2, 0x41,
+    0xB8, 0x42, 0xA2, 0x00, 0xA3, 0x81, 0x03, 0xD7, 0x99, 0x6F, 0xCD, 0x87, 0x01, 0x05, 0x0C, 0x4E,
+    0x05, 0x8B, 0x45, 0x03, 0x00, 0x0F, 0x41, 0x66, 0x46, 0x38, 0x42, 0x66, 0x43, 0x0F, 0x43, 0x06,
+    0x44, 0x44, 0x43, 0x53, 0x8A, 0x00, 0x39, 0x46, 0xA9, 0x46, 0x39, 0x41, 0xA9, 0x00, 0x8A, 0x42,
+    0xA9, 0x02, 0xDA, 0x15, 0x32, 0x81, 0x00, 0x80, 0x82, 0x07, 0xB7, 0xC1, 0xFC, 0x87, 0xFC, 0xB7,
+    0xC0, 0xA2, 0x87, 0x00, 0xB0, 0x85, 0x4F, 0x05, 0x8B, 0x01, 0x14, 0x36, 0x83, 0x00, 0x66, 0x4B,
+    0x38, 0x00, 0x66, 0x43, 0x0F, 0x44, 0x06, 0x44, 0x44, 0x88, 0x03, 0x89, 0x72, 0x4C, 0xDA, 0x46,
+    0xE2, 0x00, 0x22, 0x84, 0x02, 0xDA, 0x8B, 0xE2, 0x42, 0x4F, 0x42, 0xE2, 0x01, 0xDA, 0x51, 0x85,
+    0x08, 0xA3, 0x7A, 0xB8, 0x6E, 0xB7, 0xFD, 0xA2, 0xA3, 0x16, 0x8B, 0x4F, 0x05, 0x4D, 0x01, 0x00,
+    0x14, 0x44, 0x03, 0x4E, 0x38, 0x00, 0x66, 0x43, 0x0F, 0x43, 0x06, 0x44, 0x44, 0x41, 0x53, 0x82,
+    0x02, 0xA4, 0x12, 0x88, 0x81, 0x02, 0x8A, 0x39, 0xE2, 0x44, 0x22, 0x41, 0x4F, 0x00, 0xB4, 0x45,
+    0xA9, 0x00, 0x22, 0x42, 0xB4, 0x41, 0x22, 0x01, 0x4F, 0x8B, 0x84, 0x00, 0xD3, 0x81, 0x03, 0xA2,
+    0xB7, 0x87, 0xB7, 0x41, 0x6E, 0x01, 0xA3, 0xB5, 0x83, 0x01, 0xF6, 0xAF, 0x83, 0x51, 0x05, 0x4E,
+    0x01, 0x84, 0x84, 0x43, 0x37, 0x47, 0x38, 0x43, 0x0F, 0x43, 0x06, 0x44, 0x44, 0x86, 0x00, 0x88,
+    0x81, 0x01, 0xDA, 0x4F, 0x46, 0x22, 0x41, 0x4F, 0x03, 0xA9, 0x8A, 0x4F, 0x22, 0x42, 0xB4, 0x43,
+    0x22, 0x86, 0x00, 0x15, 0x81, 0x05, 0xAB, 0x61, 0x87, 0xA2, 0xC0, 0x3A, 0x86, 0x00, 0x6A, 0x83,
+    0x42, 0x01, 0x01, 0x05, 0x01, 0x89, 0x00, 0x01, 0x8F, 0x00, 0x14, 0x84, 0x82, 0x48, 0x37, 0x45,
+    0x38, 0x00, 0x66, 0x42, 0x0F, 0x43, 0x06, 0x8E, 0x01, 0x22, 0xA9, 0x47, 0x22, 0x81, 0x41, 0xA9,
+    0x43, 0xB4, 0x86, 0x00, 0x4B, 0x84, 0x06, 0xB8, 0xFD, 0xC0, 0xFC, 0x86, 0x6E, 0xA2, 0x8D, 0x41,
+    0x01, 0x81, 0x00, 0x01, 0x81, 0x43, 0x01, 0x41, 0x05, 0x4E, 0x01, 0x41, 0x14, 0x84, 0x00, 0x38,
+    0x42, 0x37, 0x44, 0x60, 0x44, 0x37, 0x44, 0x38, 0x00, 0x66, 0x42, 0x0F, 0x43, 0x06, 0x83, 0x00,
+    0x13, 0x8D, 0x42, 0xB4, 0x05, 0xA9, 0x8A, 0x8B, 0xDA, 0x8B, 0x8A, 0x41, 0xA9, 0x42, 0xB4, 0x8A,
+    0x08, 0xA2, 0xC1, 0xFC, 0xB8, 0xB7, 0xC1, 0x26, 0xA3, 0x16, 0x82, 0x00, 0xF7, 0x8A, 0x59, 0x01,
+    0x86, 0x41, 0x37, 0x48, 0x60, 0x43, 0x37, 0x87, 0x00, 0x0F, 0x43, 0x06, 0x42, 0x44, 0x84, 0x00,
+    0x9E, 0x84, 0x01, 0x8A, 0x22, 0x43, 0xA9, 0x41, 0x8A, 0x05, 0x8B, 0xDA, 0xC2, 0xDA, 0x8B, 0x8A,
+    0x41, 0xA9, 0x8C, 0x00, 0xFD, 0x42, 0xB7, 0x06, 0xA2, 0xB7, 0xA3, 0xFD, 0xB5, 0x54, 0x2C, 0x86,
+    0x00, 0x36, 0xA3, 0x41, 0x34, 0x00, 0x37, 0x4B, 0x60, 0x43, 0x37, 0x43, 0x38, 0x43, 0x0F, 0x82,
+    0x00, 0x7F, 0x88, 0x00, 0x71, 0x83, 0x00, 0xA9, 0x44, 0x8A, 0x41, 0x8B, 0x42, 0xC2, 0x01, 0x39,
+    0x8B, 0x42, 0xA9, 0x8A, 0x42, 0xB5, 0x43, 0x16, 0x42, 0xB5, 0xAF, 0x44, 0x60, 0x45, 0x0E, 0x42,
+    0x60, 0x86, 0x00, 0x38, 0x43, 0x0F, 0x42, 0x06, 0x02, 0x7F, 0x44, 0x37, 0x88, 0x00, 0xA8, 0x45,
+    0x8A, 0x03, 0x8B, 0xDA, 0xC2, 0x40, 0x41, 0xD3, 0x02, 0xDA, 0x8B, 0x8A, 0x89, 0x03, 0xD6, 0x3F,
+    0xD3, 0x16, 0x41, 0xB6, 0x83, 0x41, 0xB6, 0x83, 0x00, 0x70, 0x82, 0x00, 0xAF, 0x9F, 0x42, 0x14,
+    0x43, 0x03, 0x00, 0x34, 0x82, 0x48, 0x0E, 0x42, 0x60, 0x43, 0x37, 0x89, 0x00, 0x06, 0x8A, 0x01,
+    0x4C, 0x8B, 0x82, 0x01, 0x8B, 0x8A, 0x42, 0x22, 0x42, 0x8B, 0x41, 0x22, 0x41, 0x8A, 0x8A, 0x03,
+    0x3F, 0xD3, 0x41, 0x50, 0x43, 0x41, 0x05, 0x50, 0x41, 0xBE, 0x2F, 0xD7, 0x98, 0xA4, 0x00, 0x01,
+    0x83, 0x42, 0x34, 0x00, 0x60, 0x4B, 0x0E, 0x42, 0x60, 0x85, 0x00, 0x38, 0x43, 0x0F, 0x91, 0x07,
+    0x8B, 0x22, 0xA7, 0xBE, 0x86, 0x3A, 0xBB, 0x3A, 0x41, 0x86, 0x03, 0xBE, 0x8B, 0x22, 0xA9, 0x42,
+    0x22, 0x01, 0x4F, 0x8A, 0x82, 0x02, 0x80, 0xA0, 0x07, 0x41, 0xA0, 0x00, 0x3F, 0x43, 0xA0, 0x04,
+    0xA1, 0x07, 0xEB, 0x2F, 0x2C, 0x87, 0x00, 0x36, 0x9C, 0x42, 0x14, 0x84, 0x8C, 0x00, 0x0E, 0x9D,
+    0x03, 0x8B, 0x22, 0xBE, 0x7C, 0x41, 0xFE, 0x00, 0x7A, 0x41, 0x79, 0x00, 0x98, 0x41, 0x65, 0x03,
+    0xC1, 0x50, 0x4F, 0xA9, 0x82, 0x00, 0x8B, 0x81, 0x03, 0xAF, 0xD6, 0xA1, 0x78, 0x41, 0xC9, 0x00,
+    0x07, 0x41, 0xDE, 0x05, 0x51, 0xD7, 0x78, 0xD7, 0xD8, 0xBA, 0x86, 0x01, 0x88, 0x03, 0x9C, 0x43,
+    0x14, 0x00, 0x30, 0x43, 0x34, 0x4D, 0x0E, 0x8C, 0x00, 0x0F, 0x81, 0x00, 0x7F, 0x8C, 0x03, 0x8A,
+    0x22, 0xD3, 0xB8, 0x44, 0x79, 0x41, 0x7A, 0x03, 0xED, 0x4D, 0x32, 0x4F, 0x42, 0x22, 0x87, 0x07,
+    0x78, 0x07, 0xE1, 0x40, 0xC2, 0xD3, 0x41, 0x55, 0x41, 0x78, 0x06, 0x2F, 0xD7, 0x59, 0x70, 0x96,
+    0x6A, 0xB0, 0xA1, 0x01, 0x30, 0x03, 0x44, 0x34, 0x9A, 0x42, 0x06, 0x86, 0x00, 0x9E, 0x86, 0x0D,
+    0xA9, 0x4F, 0xE6, 0x65, 0xC1, 0x26, 0x31, 0x4E, 0x7C, 0x7D, 0xFF, 0xAB, 0xE2, 0xA9, 0x85, 0x00,
+    0x18, 0x83, 0x01, 0x07, 0xE1, 0x41, 0xDA, 0x41, 0x50, 0x05, 0x8B, 0x50, 0x55, 0x78, 0xBA, 0xEB,
+    0x88, 0x01, 0x36, 0x14, 0x96, 0x43, 0x14, 0x00, 0x30, 0x46, 0x34, 0x9D, 0x00, 0x44, 0x83, 0x00,
+    0x53, 0x84, 0x01, 0x22, 0x8B, 0x42, 0xA9, 0x06, 0x4F, 0xF1, 0xB8, 0x79, 0x31, 0x4E, 0x7C, 0x42,
+    0x11, 0x00, 0xAA, 0x86, 0x00, 0xDE, 0x84, 0x02, 0x3F, 0xDA, 0x40, 0x41, 0xF1, 0x41, 0x3A, 0x03,
+    0x15, 0x50, 0x55, 0xB9, 0x88, 0x42, 0x03, 0x42, 0x14, 0x01, 0x01, 0x14, 0x8D, 0x45, 0x14, 0x49,
+    0x34, 0x8C, 0x41, 0x60, 0x42, 0x37, 0x44, 0x38, 0x85, 0x41, 0x7F, 0x8A, 0x00, 0x8A, 0x82, 0x03,
+    0xE2, 0x74, 0xC1, 0x26, 0x82, 0x00, 0xFF, 0x81, 0x00, 0x62, 0x86, 0x01, 0xDF, 0x02, 0x82, 0x0B,
+    0x07, 0xA7, 0x8B, 0xF1, 0x3A, 0x50, 0x8A, 0x86, 0x3A, 0xDA, 0xCA, 0xBA, 0x87, 0x00, 0x1F, 0x44,
+    0x03, 0x50, 0x14, 0x01, 0x30, 0x14, 0x4B, 0x34, 0x41, 0x00, 0x8B, 0x41, 0x60, 0x43, 0x37, 0x83,
+    0x43, 0x0F, 0x42, 0x06, 0x86, 0x00, 0x28, 0x86, 0x00, 0xB4, 0x81, 0x00, 0x55, 0x87, 0x00, 0x87,
+    0x84, 0x03, 0xE2, 0x8B, 0x51, 0x18, 0x82, 0x03, 0xDE, 0xA6, 0xCA, 0x86, 0x41, 0x6E, 0x05, 0x4F,
+    0xA9, 0x3A, 0xCA, 0x32, 0xD7, 0x85, 0x00, 0x89, 0x83, 0x02, 0x34, 0x03, 0x34, 0x48, 0x03, 0x03,
+    0x34, 0x14, 0x03, 0x30, 0x4C, 0x34, 0x46, 0x00, 0x8A, 0x42, 0x60, 0x82, 0x43, 0x38, 0x00, 0x67,
+    0x87, 0x00, 0x44, 0x88, 0x02, 0x39, 0x22, 0xA9, 0x42, 0x22, 0x03, 0xE2, 0xCA, 0xC0, 0xAB, 0x84,
+    0x02, 0x7D, 0x55, 0xE2, 0x41, 0x22, 0x41, 0x4F, 0x02, 0xE2, 0x8A, 0xDF, 0x83, 0x0B, 0xA0, 0xA9,
+    0x50, 0xF1, 0x41, 0xFC, 0x86, 0x55, 0x87, 0x55, 0x15, 0x78, 0x88, 0x43, 0x00, 0x55, 0x34, 0x4B,
+    0x00, 0x89, 0x42, 0x60, 0x42, 0x37, 0x44, 0x38, 0x43, 0x0F, 0x41, 0x06, 0x42, 0x7F, 0x01, 0x44,
+    0x13, 0x8E, 0x03, 0x40, 0x64, 0xB8, 0x7A, 0x83, 0x01, 0x7C, 0x50, 0x85, 0x00, 0x8B, 0x84, 0x06,
+    0xDE, 0xA7, 0xDA, 0x3A, 0xDA, 0x32, 0xC1, 0x41, 0x3A, 0x02, 0xD3, 0xAE, 0xB9, 0x84, 0x02, 0xAF,
+    0x89, 0x9F, 0x84, 0x60, 0x00, 0x00, 0x08, 0x88, 0x42, 0x60, 0x42, 0x37, 0x44, 0x38, 0x44, 0x0F,
+    0x86, 0x02, 0xD1, 0x13, 0x49, 0x8A, 0x04, 0x4F, 0x39, 0x61, 0xC1, 0x31, 0x81, 0x41, 0x7D, 0x01,
+    0x4E, 0xC2, 0x81, 0x42, 0x4F, 0x84, 0x0C, 0xD5, 0xA1, 0x8F, 0x90, 0xA9, 0x6E, 0x3A, 0xC8, 0x55,
+    0x3A, 0x55, 0xDA, 0x07, 0x81, 0x01, 0xC6, 0x4B, 0x83, 0x01, 0x28, 0x08, 0x9F, 0x45, 0x08, 0x42,
+    0x60, 0x82, 0x44, 0x60, 0x42, 0x37, 0x44, 0x38, 0x44, 0x0F, 0x42, 0x06, 0x83, 0x00, 0x37, 0x81,
+    0x00, 0xA4, 0x86, 0x00, 0xA8, 0x83, 0x04, 0xA9, 0xF1, 0xC0, 0xE8, 0x4D, 0x82, 0x02, 0x4D, 0x8A,
+    0x4F, 0x81, 0x00, 0xE2, 0x81, 0x00, 0x8A, 0x84, 0x02, 0xEA, 0x3F, 0xA6, 0x41, 0x55, 0x41, 0x86,
+    0x03, 0xC9, 0xDA, 0xAE, 0x78, 0xA5, 0x49, 0x08, 0x48, 0x60, 0x42, 0x37, 0x45, 0x38, 0x00, 0x66,
+    0x89, 0x41, 0x44, 0x88, 0x02, 0xDA, 0x22, 0x8A, 0x44, 0x22, 0x02, 0x86, 0x6E, 0x26, 0x83, 0x01,
+    0xE9, 0x4F, 0x41, 0x22, 0x42, 0x4F, 0x01, 0xE2, 0x8B, 0x81, 0x00, 0x89, 0x81, 0x03, 0xEB, 0xDE,
+    0x3F, 0xA6, 0x42, 0xA7, 0x02, 0xE1, 0xDE, 0xEB, 0x89, 0x00, 0x1D, 0x99, 0x4B, 0x08, 0x86, 0x43,
+    0x37, 0x46, 0x38, 0x44, 0x0F, 0x43, 0x06, 0x8D, 0x00, 0xE2, 0x44, 0x4F, 0x05, 0xE2, 0xC8, 0x1A,
+    0xAA, 0xEC, 0x4E, 0x81, 0x02, 0xAA, 0xE2, 0x22, 0x44, 0xE2, 0x00, 0x39, 0x84, 0x03, 0x78, 0x07,
+    0x8F, 0xA0, 0x41, 0x3F, 0x02, 0xA0, 0x8F, 0xEB, 0x41, 0x78, 0x88, 0x00, 0x08, 0xA5, 0x00, 0x37,
+    0x82, 0x44, 0x37, 0x47, 0x38, 0x00, 0x66, 0x88, 0x00, 0x06, 0x85, 0x00, 0x49, 0x85, 0x01, 0x4F,
+    0x22, 0x84, 0x01, 0xCA, 0x62, 0x81, 0x00, 0x7C, 0x81, 0x00, 0x62, 0x8D, 0x45, 0xEB, 0x43, 0x78,
+    0xA3, 0x43, 0x00, 0x87, 0x00, 0x38, 0x47, 0x37, 0x88, 0x00, 0x66, 0x88, 0x41, 0x06, 0x89, 0x05,
+    0xD3, 0x4C, 0x8A, 0x4C, 0x22, 0x4C, 0x41, 0x8A, 0x03, 0x8B, 0x50, 0x55, 0x87, 0x41, 0x62, 0x03,
+    0x3A, 0x41, 0xD9, 0x8A, 0x41, 0x22, 0x00, 0x4F, 0x8C, 0x45, 0x78, 0xA7, 0x45, 0x00, 0x81, 0x45,
+    0x38, 0x45, 0x37, 0x47, 0x38, 0x00, 0x66, 0x45, 0x0F, 0x43, 0x06, 0x00, 0x19, 0x87, 0x01, 0x32,
+    0x40, 0x42, 0xDA, 0x41, 0xC2, 0x01, 0x40, 0xD3, 0x42, 0x40, 0x04, 0xD3, 0x32, 0x50, 0x41, 0xD3,
+    0x41, 0x40, 0x00, 0xC2, 0x42, 0xDA, 0x01, 0xE1, 0xDE, 0x86, 0x43, 0x78, 0x42, 0xB9, 0x89, 0x66,
+    0x00, 0x46, 0x38, 0x49, 0x37, 0x46, 0x38, 0x42, 0x66, 0x42, 0x0F, 0x82, 0x00, 0x19, 0x85, 0x49,
+    0xE1, 0x43, 0x15, 0x42, 0xE1, 0x45, 0x15, 0x87, 0x00, 0x07, 0x44, 0x3F, 0x01, 0xE0, 0x8F, 0x41,
+    0xB9, 0x88, 0x5D, 0x34, 0x82, 0x00, 0x34, 0x83, 0x00, 0x0F, 0x41, 0x66, 0x44, 0x38, 0x81, 0x48,
+    0x60, 0x43, 0x37, 0x46, 0x38, 0x05, 0x66, 0xD2, 0xD1, 0x7B, 0x49, 0x52, 0x83, 0x00, 0xAE, 0x4A,
+    0x15, 0x44, 0xD4, 0x00, 0x15, 0x45, 0xD4, 0x84, 0x00, 0xBA, 0x41, 0x78, 0x00, 0x32, 0x43, 0xAE,
+    0x01, 0xD4, 0x07, 0x41, 0xBA, 0x87, 0x4A, 0x34, 0x03, 0x03, 0x34, 0x03, 0x30, 0x82, 0x41, 0x14,
+    0x42, 0x03, 0x00, 0x34, 0x41, 0x03, 0x81, 0x02, 0x03, 0x34, 0x03, 0x47, 0x34, 0x41, 0x06, 0x41,
+    0x0F, 0x00, 0x66, 0x43, 0x38, 0x41, 0x37, 0x81, 0x4C, 0x0E, 0x42, 0x60, 0x01, 0x0E, 0x60, 0x41,
+    0xD1, 0x83, 0x05, 0x28, 0xC5, 0x8A, 0xA9, 0x8A, 0xA6, 0x42, 0x8A, 0x01, 0xA6, 0x8A, 0x49, 0xA6,
+    0x44, 0x39, 0x06, 0x4C, 0x1B, 0xF4, 0x9E, 0x98, 0xDE, 0xA0, 0x41, 0x8E, 0x47, 0x07, 0x04, 0x8E,
+    0xC4, 0xF4, 0xAF, 0x97, 0x81, 0x00, 0x88, 0x84, 0x00, 0x30, 0x41, 0x14, 0x00, 0x01, 0x41, 0x14,
+    0x54, 0x01, 0x42, 0x14, 0x01, 0x03, 0x14, 0x42, 0x03, 0x00, 0x43, 0x43, 0x06, 0x41, 0x0F, 0x41,
+    0x66, 0x41, 0x38, 0x00, 0x37, 0x41, 0x60, 0x82, 0x00, 0xD2, 0x4B, 0xF3, 0x09, 0x0E, 0xA5, 0xA4,
+    0xD1, 0x49, 0x53, 0x28, 0x33, 0x28, 0xD6, 0x56, 0xBC, 0x05, 0x45, 0xC6, 0x9E, 0x2E, 0x9E, 0x98,
+    0x49, 0x45, 0x41, 0x71, 0x02, 0xC6, 0x89, 0x9A, 0x81, 0x03, 0x89, 0x9E, 0x2E, 0x03, 0x65, 0x01,
+    0x42, 0x53, 0x42, 0x44, 0x00, 0x43, 0x42, 0x06, 0x01, 0x0F, 0x66, 0x41, 0x38, 0x41, 0x60, 0x41,
+    0x0E, 0x81, 0x46, 0xF2, 0x41, 0xA5, 0x42, 0xF2, 0x00, 0xDB, 0x84, 0x01, 0x33, 0x28, 0x52, 0x9E,
+    0x44, 0x88, 0x01, 0x9E, 0x2E, 0x41, 0x28, 0x00, 0x9E, 0x43, 0x88, 0x46, 0x89, 0x04, 0xB0, 0x89,
+    0x9A, 0xAF, 0xB1, 0x81, 0x01, 0x2E, 0x03, 0x43, 0x01, 0x62, 0x05, 0x00, 0x20, 0x43, 0x04, 0x00,
+    0x12, 0x42, 0x53, 0x41, 0x44, 0x41, 0x06, 0x41, 0x0F, 0x41, 0x38, 0x00, 0x37, 0x41, 0x0E, 0x02,
+    0xF3, 0xF2, 0xA5, 0x47, 0xA4, 0x41, 0xDC, 0x02, 0xCC, 0x49, 0x06, 0x81, 0x00, 0xF4, 0x52, 0x33,
+    0x45, 0xF4, 0x00, 0x2E, 0x42, 0x28, 0x42, 0x2E, 0x48, 0x28, 0x42, 0x9E, 0x00, 0x9A, 0x41, 0x6A,
+    0x01, 0x84, 0x1D, 0x41, 0x01, 0x57, 0x05, 0x00, 0x3E, 0x8C, 0x44, 0x10, 0x43, 0x20, 0x42, 0x04,
+    0x41, 0x53, 0x41, 0x44, 0x41, 0x06, 0x07, 0x66, 0x38, 0x60, 0x0E, 0xF3, 0xF2, 0xA4, 0x49, 0x41,
+    0xDC, 0x42, 0xDB, 0x01, 0xCC, 0xCB, 0x41, 0x2A, 0x02, 0xDC, 0x30, 0xF4, 0x53, 0x33, 0x4B, 0xF4,
+    0x8C, 0x06, 0x89, 0x18, 0x66, 0x53, 0x34, 0x9F, 0x05, 0x65, 0x3E, 0x46, 0x85, 0x42, 0x84, 0x43,
+    0x10, 0x41, 0x20, 0x41, 0x04, 0x08, 0x53, 0x44, 0x43, 0x06, 0x66, 0x37, 0x0E, 0xF2, 0xA4, 0x42,
+    0xDB, 0x41, 0xCC, 0x41, 0x3B, 0x03, 0xC3, 0x58, 0xA5, 0x30, 0x45, 0x28, 0x50, 0x9E, 0x4D, 0x88,
+    0x46, 0x89, 0x03, 0x88, 0xC5, 0x60, 0x10, 0x41, 0x9F, 0x54, 0x3E, 0x01, 0x23, 0x5C, 0x43, 0x23,
+    0x00, 0x3E, 0x41, 0x23, 0x00, 0x3E, 0x42, 0x23, 0x00, 0x3E, 0x44, 0x23, 0x4D, 0x6D, 0x43, 0x69,
+    0x01, 0x68, 0x84, 0x41, 0x10, 0x06, 0x20, 0x04, 0x53, 0x06, 0x38, 0x0E, 0xA5, 0x41, 0xDB, 0x01,
+    0xCC, 0xCB, 0x41, 0x3B, 0x02, 0xC3, 0x57, 0x2A, 0x42, 0xEE, 0x41, 0x29, 0x43, 0xEE, 0x42, 0xF2,
+    0x5A, 0x29, 0x41, 0x5F, 0x05, 0xD5, 0x19, 0x06, 0xF3, 0xD2, 0x1C, 0x41, 0x88, 0x00, 0x3E, 0x45,
+    0x9B, 0x61, 0x5C, 0x44, 0x82, 0x47, 0x09, 0x47, 0x1D, 0x42, 0x09, 0x41, 0x6D, 0x0D, 0x68, 0x84,
+    0x20, 0x53, 0x66, 0xF3, 0xDB, 0xCC, 0xCB, 0x3B, 0x2A, 0x57, 0x8E, 0xA6, 0x42, 0xE2, 0x00, 0xB3,
+    0x41, 0x90, 0x5A, 0x91, 0x42, 0x90, 0x09, 0xDD, 0xE2, 0xDD, 0xB3, 0xB9, 0xCB, 0x0E, 0x1C, 0x88,
+    0x3E, 0x43, 0x9B, 0x65, 0x5C, 0x44, 0x09, 0x45, 0x1D, 0x00, 0x75, 0x41, 0x1D, 0x41, 0x75, 0x43,
+    0x1E, 0x45, 0x1F, 0x44, 0x00, 0x05, 0x1D, 0x6D, 0x68, 0x10, 0x20, 0x04, 0x41, 0x12, 0x04, 0x53,
+    0x67, 0x66, 0x67, 0x12, 0x41, 0x04, 0x01, 0x20, 0x04, 0x4B, 0x20, 0x00, 0xC5, 0x41, 0x20, 0x4A,
+    0x04, 0x41, 0x12, 0x00, 0x53, 0x41, 0x27, 0x04, 0xC5, 0x69, 0x09, 0x2E, 0x3E, 0x43, 0x9B, 0x00,
+    0x5C, 0x5B, 0x5D, 0x03, 0x5C, 0x5D, 0x5C, 0x5D, 0x86, 0x4B, 0x75, 0x44, 0x1E, 0x46, 0x1F, 0x48,
+    0x03, 0x41, 0x01, 0x43, 0x05, 0x47, 0x3E, 0x4E, 0x9B, 0x41, 0xB2, 0x00, 0x9B, 0x4B, 0xB2, 0x42,
+    0x81, 0x41, 0xB2, 0x41, 0x9B, 0x00, 0xB2, 0x6A, 0x5D, 0x87, 0x48, 0x1E, 0x81, 0x4F, 0x03, 0x47,
+    0x36, 0x00, 0x6B, 0x47, 0x05, 0x4F, 0x23, 0x42, 0x5C, 0x00, 0x23, 0x49, 0x5C, 0x55, 0x5D, 0x43,
+    0x8D, 0x84, 0x45, 0x8D, 0x84, 0x41, 0x8D, 0x81, 0x86, 0x46, 0x1E, 0x01, 0x03, 0x1F, 0x49, 0x03,
+    0x4A, 0x36, 0x42, 0x6B, 0x44, 0x05, 0x49, 0x23, 0x52, 0x5C, 0x48, 0x5D, 0x42, 0x97, 0x00, 0x5D,
+    0x41, 0x97, 0x45, 0x3C, 0x00, 0x8D, 0x5F, 0x3C,
+};
+
+static const image_t RAPPORT_PIX_LOGO = {
+    .width = RAPPORT_PIX_LOGO_WIDTH,
+    .height = RAPPORT_PIX_LOGO_HEIGHT,
+    .format = IMAGE_FORMAT_INDEXED8,
+    .palette_size = 256,
+    .palette = RAPPORT_PIX_LOGO_PALETTE,
+    .data = RAPPORT_PIX_LOGO_DATA,
+    .data_size = sizeof(RAPPORT_PIX_LOGO_DATA),
 };
 
 #endif // RAPPORT_PIX_LOGO_H
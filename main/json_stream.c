@@ -0,0 +1,356 @@
+#include <string.h>
+#include <stdlib.h>
+
+#include "json_stream.h"
+
+enum {
+    JS_VALUE,       // Expecting a value
+    JS_OBJ_START,   // After '{': key or '}'
+    JS_ARR_START,   // After '[': value or ']'
+    JS_KEY,         // After ',' in an object: key
+    JS_COLON,       // After a key: ':'
+    JS_STRING,      // Inside a string
+    JS_ESCAPE,      // After '\' in a string
+    JS_UNICODE,     // Inside a \uXXXX escape
+    JS_LITERAL,     // Inside a number, true, false or null
+    JS_AFTER_VALUE, // After a value: ',' or end of container
+    JS_DONE,        // Top-level value complete
+};
+
+static bool is_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static bool in_object(const json_stream_t *js)
+{
+    return js->depth > 0 && (js->stack >> (js->depth - 1)) & 1;
+}
+
+static void push(json_stream_t *js, bool object, uint8_t state)
+{
+    if (js->depth >= JSON_STREAM_DEPTH_MAX) {
+        js->error = true;
+        return;
+    }
+    if (object) {
+        js->stack |= 1u << js->depth;
+    } else {
+        js->stack &= ~(1u << js->depth);
+    }
+    js->depth++;
+    js->state = state;
+}
+
+static void end_value(json_stream_t *js)
+{
+    js->target = NULL;
+    js->state = js->depth == 0 ? JS_DONE : JS_AFTER_VALUE;
+}
+
+static void pop(json_stream_t *js)
+{
+    js->depth--;
+    end_value(js);
+}
+
+/**
+ * @brief Start a value, selecting the field it is stored in if any
+ */
+static json_field_t *value_target(json_stream_t *js, json_field_type_t type)
+{
+    if (js->depth != 1 || !in_object(js) || js->field < 0) {
+        return NULL;
+    }
+    json_field_t *f = &js->fields[js->field];
+    return f->type == type ? f : NULL;
+}
+
+static void begin_string(json_stream_t *js, bool is_key)
+{
+    js->is_key = is_key;
+    js->key_len = 0;
+    js->key_overflow = false;
+    js->value_len = 0;
+    js->target = is_key ? NULL : value_target(js, JSON_FIELD_STRING);
+    if (js->target != NULL && js->target->size > 0) {
+        ((char *)js->target->dest)[0] = '\0';
+        js->target->truncated = false;
+    }
+    js->state = JS_STRING;
+}
+
+static void string_char(json_stream_t *js, char c)
+{
+    if (js->is_key) {
+        if (js->key_len < JSON_STREAM_KEY_MAX - 1) {
+            js->key[js->key_len++] = c;
+        } else {
+            js->key_overflow = true;
+        }
+        return;
+    }
+
+    json_field_t *f = js->target;
+    if (f == NULL) return;
+
+    if (js->value_len + 1 < f->size) {
+        char *dest = f->dest;
+        dest[js->value_len++] = c;
+        dest[js->value_len] = '\0';
+    } else {
+        f->truncated = true;
+    }
+}
+
+static void string_codepoint(json_stream_t *js, uint32_t cp)
+{
+    // Lone surrogates cannot be encoded; pairs are not worth joining for
+    // the ASCII payloads exchanged with the backend
+    if (cp >= 0xD800 && cp <= 0xDFFF) {
+        string_char(js, '?');
+    } else if (cp < 0x80) {
+        string_char(js, (char)cp);
+    } else if (cp < 0x800) {
+        string_char(js, (char)(0xC0 | (cp >> 6)));
+        string_char(js, (char)(0x80 | (cp & 0x3F)));
+    } else {
+        string_char(js, (char)(0xE0 | (cp >> 12)));
+        string_char(js, (char)(0x80 | ((cp >> 6) & 0x3F)));
+        string_char(js, (char)(0x80 | (cp & 0x3F)));
+    }
+}
+
+static void end_string(json_stream_t *js)
+{
+    if (js->is_key) {
+        js->field = -1;
+        if (js->depth == 1 && !js->key_overflow) {
+            for (size_t i = 0; i < js->num_fields; i++) {
+                if (strlen(js->fields[i].key) == js->key_len &&
+                    memcmp(js->fields[i].key, js->key, js->key_len) == 0) {
+                    js->field = i;
+                    break;
+                }
+            }
+        }
+        js->state = JS_COLON;
+        return;
+    }
+
+    if (js->target != NULL) {
+        js->target->found = true;
+    }
+    end_value(js);
+}
+
+static void end_literal(json_stream_t *js)
+{
+    js->literal[js->literal_len] = '\0';
+
+    if (strcmp(js->literal, "true") == 0 || strcmp(js->literal, "false") == 0 ||
+        strcmp(js->literal, "null") == 0) {
+        end_value(js);
+        return;
+    }
+
+    char *end;
+    double value = strtod(js->literal, &end);
+    if (js->literal_len == 0 || *end != '\0') {
+        js->error = true;
+        return;
+    }
+
+    json_field_t *f = value_target(js, JSON_FIELD_NUMBER);
+    if (f != NULL) {
+        *(double *)f->dest = value;
+        f->found = true;
+    }
+    end_value(js);
+}
+
+static int hex_value(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static void feed_char(json_stream_t *js, char c)
+{
+    switch (js->state) {
+        case JS_VALUE:
+            if (is_space(c)) break;
+            if (c == '{') {
+                push(js, true, JS_OBJ_START);
+            } else if (c == '[') {
+                push(js, false, JS_ARR_START);
+            } else if (c == '"') {
+                begin_string(js, false);
+            } else if (c == '-' || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z')) {
+                js->literal_len = 0;
+                js->literal[js->literal_len++] = c;
+                js->state = JS_LITERAL;
+            } else {
+                js->error = true;
+            }
+            break;
+
+        case JS_OBJ_START:
+            if (is_space(c)) break;
+            if (c == '}') {
+                pop(js);
+            } else if (c == '"') {
+                begin_string(js, true);
+            } else {
+                js->error = true;
+            }
+            break;
+
+        case JS_ARR_START:
+            if (is_space(c)) break;
+            if (c == ']') {
+                pop(js);
+            } else {
+                js->state = JS_VALUE;
+                feed_char(js, c);
+            }
+            break;
+
+        case JS_KEY:
+            if (is_space(c)) break;
+            if (c == '"') {
+                begin_string(js, true);
+            } else {
+                js->error = true;
+            }
+            break;
+
+        case JS_COLON:
+            if (is_space(c)) break;
+            if (c == ':') {
+                js->state = JS_VALUE;
+            } else {
+                js->error = true;
+            }
+            break;
+
+        case JS_STRING:
+            if (c == '"') {
+                end_string(js);
+            } else if (c == '\\') {
+                js->state = JS_ESCAPE;
+            } else if ((unsigned char)c < 0x20) {
+                js->error = true;
+            } else {
+                string_char(js, c);
+            }
+            break;
+
+        case JS_ESCAPE:
+            js->state = JS_STRING;
+            switch (c) {
+                case '"':  string_char(js, '"'); break;
+                case '\\': string_char(js, '\\'); break;
+                case '/':  string_char(js, '/'); break;
+                case 'b':  string_char(js, '\b'); break;
+                case 'f':  string_char(js, '\f'); break;
+                case 'n':  string_char(js, '\n'); break;
+                case 'r':  string_char(js, '\r'); break;
+                case 't':  string_char(js, '\t'); break;
+                case 'u':
+                    js->codepoint = 0;
+                    js->hex_count = 0;
+                    js->state = JS_UNICODE;
+                    break;
+                default:
+                    js->error = true;
+                    break;
+            }
+            break;
+
+        case JS_UNICODE: {
+            int v = hex_value(c);
+            if (v < 0) {
+                js->error = true;
+                break;
+            }
+            js->codepoint = (js->codepoint << 4) | v;
+            if (++js->hex_count == 4) {
+                string_codepoint(js, js->codepoint);
+                js->state = JS_STRING;
+            }
+            break;
+        }
+
+        case JS_LITERAL:
+            if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                c == '-' || c == '+' || c == '.') {
+                if (js->literal_len < sizeof(js->literal) - 1) {
+                    js->literal[js->literal_len++] = c;
+                } else {
+                    js->error = true;
+                }
+            } else {
+                end_literal(js);
+                if (!js->error) {
+                    feed_char(js, c);
+                }
+            }
+            break;
+
+        case JS_AFTER_VALUE:
+            if (is_space(c)) break;
+            if (c == ',') {
+                js->state = in_object(js) ? JS_KEY : JS_VALUE;
+            } else if (c == '}' && in_object(js)) {
+                pop(js);
+            } else if (c == ']' && !in_object(js)) {
+                pop(js);
+            } else {
+                js->error = true;
+            }
+            break;
+
+        case JS_DONE:
+            if (!is_space(c)) {
+                js->error = true;
+            }
+            break;
+    }
+}
+
+void json_stream_init(json_stream_t *js, json_field_t *fields, size_t num_fields)
+{
+    memset(js, 0, sizeof(*js));
+    js->fields = fields;
+    js->num_fields = num_fields;
+    js->state = JS_VALUE;
+    js->field = -1;
+
+    for (size_t i = 0; i < num_fields; i++) {
+        fields[i].found = false;
+        fields[i].truncated = false;
+        if (fields[i].type == JSON_FIELD_STRING && fields[i].size > 0) {
+            ((char *)fields[i].dest)[0] = '\0';
+        }
+    }
+}
+
+bool json_stream_feed(json_stream_t *js, const char *data, size_t len)
+{
+    for (size_t i = 0; i < len && !js->error; i++) {
+        feed_char(js, data[i]);
+    }
+    return !js->error;
+}
+
+bool json_stream_finish(json_stream_t *js)
+{
+    // A bare top-level number is only terminated by the end of input
+    if (js->state == JS_LITERAL && js->depth == 0) {
+        end_literal(js);
+    }
+    return !js->error && js->state == JS_DONE;
+}
@@ -0,0 +1,94 @@
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Longest key that can be matched against a field. Longer keys are skipped.
+#define JSON_STREAM_KEY_MAX 32
+
+// Deepest nesting of objects/arrays accepted
+#define JSON_STREAM_DEPTH_MAX 32
+
+/**
+ * @brief Type of a field to extract
+ */
+typedef enum {
+    JSON_FIELD_STRING,  // dest is char[size], always NUL-terminated
+    JSON_FIELD_NUMBER,  // dest is double
+} json_field_type_t;
+
+/**
+ * @brief Field of the top-level object to extract
+ *
+ * Only members of the outermost object are matched. Values of other types
+ * than the one requested are ignored.
+ */
+typedef struct {
+    const char *key;
+    json_field_type_t type;
+    void *dest;
+    size_t size;        // Size of the string buffer, unused for numbers
+    bool found;         // Set when the value was stored
+    bool truncated;     // Set when a string did not fit in dest
+} json_field_t;
+
+/**
+ * @brief Incremental JSON parser state
+ *
+ * Input can be fed in chunks of any size, split anywhere. No memory is
+ * allocated and the document size is unbounded; only the extracted values
+ * are stored.
+ */
+typedef struct {
+    json_field_t *fields;
+    size_t num_fields;
+
+    uint8_t state;
+    bool error;
+    bool is_key;
+    uint8_t depth;
+    uint32_t stack;     // Bit n set if nesting level n+1 is an object
+
+    char key[JSON_STREAM_KEY_MAX];
+    uint8_t key_len;
+    bool key_overflow;
+    int field;          // Field matching the last top-level key, or -1
+    json_field_t *target;   // Field the current value is written to
+    size_t value_len;
+
+    char literal[32];
+    uint8_t literal_len;
+    uint32_t codepoint;
+    uint8_t hex_count;
+} json_stream_t;
+
+/**
+ * @brief Prepare a parser to extract the given fields
+ *
+ * Clears the found/truncated flags and empties string destinations.
+ *
+ * @param js Parser state
+ * @param fields Fields to extract, must outlive the parser
+ * @param num_fields Number of fields
+ */
+void json_stream_init(json_stream_t *js, json_field_t *fields, size_t num_fields);
+
+/**
+ * @brief Feed the next chunk of the document
+ * @param js Parser state
+ * @param data Chunk data
+ * @param len Chunk length
+ * @return false once the input is known to be malformed
+ */
+bool json_stream_feed(json_stream_t *js, const char *data, size_t len);
+
+/**
+ * @brief Check that a complete, well-formed document was fed
+ * @param js Parser state
+ * @return true if the document is complete
+ */
+bool json_stream_finish(json_stream_t *js);
+
+#endif // JSON_STREAM_H
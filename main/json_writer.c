@@ -0,0 +1,128 @@
+#include <string.h>
+
+#include "json_writer.h"
+
+static void put(json_writer_t *w, const char *s, size_t n)
+{
+    buf_writer_put(&w->out, s, n);
+}
+
+static void put_char(json_writer_t *w, char c)
+{
+    put(w, &c, 1);
+}
+
+static void put_escaped(json_writer_t *w, const char *s)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    put_char(w, '"');
+    while (*s) {
+        // Copy plain characters in one go
+        size_t n = strcspn(s, "\"\\\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+                              "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f");
+        put(w, s, n);
+        s += n;
+        if (*s == '\0') break;
+
+        unsigned char c = *s++;
+        if (c == '"' || c == '\\') {
+            char esc[2] = {'\\', c};
+            put(w, esc, 2);
+        } else {
+            char esc[6] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF]};
+            put(w, esc, 6);
+        }
+    }
+    put_char(w, '"');
+}
+
+// Separator and key before a value
+static void begin_value(json_writer_t *w, const char *key)
+{
+    if (w->need_comma) {
+        put_char(w, ',');
+    }
+    if (key != NULL) {
+        put_escaped(w, key);
+        put_char(w, ':');
+    }
+    w->need_comma = true;
+}
+
+void json_writer_init(json_writer_t *w, char *buf, size_t size)
+{
+    buf_writer_init(&w->out, buf, size);
+    w->need_comma = false;
+}
+
+void json_writer_begin_object(json_writer_t *w, const char *key)
+{
+    begin_value(w, key);
+    put_char(w, '{');
+    w->need_comma = false;
+}
+
+void json_writer_end_object(json_writer_t *w)
+{
+    put_char(w, '}');
+    w->need_comma = true;
+}
+
+void json_writer_begin_array(json_writer_t *w, const char *key)
+{
+    begin_value(w, key);
+    put_char(w, '[');
+    w->need_comma = false;
+}
+
+void json_writer_end_array(json_writer_t *w)
+{
+    put_char(w, ']');
+    w->need_comma = true;
+}
+
+void json_writer_string(json_writer_t *w, const char *key, const char *value)
+{
+    begin_value(w, key);
+    put_escaped(w, value);
+}
+
+void json_writer_int(json_writer_t *w, const char *key, int64_t value)
+{
+    char digits[20];
+    int n = 0;
+    uint64_t v = value < 0 ? -(uint64_t)value : (uint64_t)value;
+
+    do {
+        digits[sizeof(digits) - 1 - n++] = '0' + v % 10;
+        v /= 10;
+    } while (v != 0);
+
+    begin_value(w, key);
+    if (value < 0) {
+        put_char(w, '-');
+    }
+    put(w, &digits[sizeof(digits) - n], n);
+}
+
+void json_writer_bool(json_writer_t *w, const char *key, bool value)
+{
+    begin_value(w, key);
+    if (value) {
+        put(w, "true", 4);
+    } else {
+        put(w, "false", 5);
+    }
+}
+
+void json_writer_null(json_writer_t *w, const char *key)
+{
+    begin_value(w, key);
+    put(w, "null", 4);
+}
+
+const char *json_writer_finish(json_writer_t *w, size_t *len)
+{
+    return buf_writer_finish(&w->out, len);
+}
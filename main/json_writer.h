@@ -0,0 +1,80 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "buf_writer.h"
+
+/**
+ * @brief JSON writer into a caller-provided buffer
+ *
+ * Never allocates. Output that does not fit sets overflow and is dropped;
+ * json_writer_finish() then reports the failure.
+ *
+ * Every value function takes the member key: pass NULL for array elements
+ * and for the top-level value.
+ */
+typedef struct {
+    buf_writer_t out;
+    bool need_comma;   // A value was written at the current level
+} json_writer_t;
+
+/**
+ * @brief Start writing into buf
+ * @param w Writer
+ * @param buf Output buffer
+ * @param size Size of buf, including room for the terminator
+ */
+void json_writer_init(json_writer_t *w, char *buf, size_t size);
+
+/**
+ * @brief Open an object; members follow until json_writer_end_object()
+ */
+void json_writer_begin_object(json_writer_t *w, const char *key);
+
+/**
+ * @brief Close the innermost object
+ */
+void json_writer_end_object(json_writer_t *w);
+
+/**
+ * @brief Open an array; elements follow until json_writer_end_array()
+ */
+void json_writer_begin_array(json_writer_t *w, const char *key);
+
+/**
+ * @brief Close the innermost array
+ */
+void json_writer_end_array(json_writer_t *w);
+
+/**
+ * @brief Write a string value, escaping it as needed
+ */
+void json_writer_string(json_writer_t *w, const char *key, const char *value);
+
+/**
+ * @brief Write an integer value
+ */
+void json_writer_int(json_writer_t *w, const char *key, int64_t value);
+
+/**
+ * @brief Write true or false
+ */
+void json_writer_bool(json_writer_t *w, const char *key, bool value);
+
+/**
+ * @brief Write null
+ */
+void json_writer_null(json_writer_t *w, const char *key);
+
+/**
+ * @brief Terminate the output
+ * @param w Writer
+ * @param len Output length without the terminator, may be NULL
+ * @return The NUL-terminated JSON text, or NULL if it did not fit
+ */
+const char *json_writer_finish(json_writer_t *w, size_t *len);
+
+#endif // JSON_WRITER_H
@@ -0,0 +1,180 @@
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/spi_master.h"
+#include "driver/gpio.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "lcd_bus.h"
+
+static const char *TAG = "lcd_bus";
+
+// Transactions kept in flight by the queued SPI pipeline
+#define LCD_QUEUE_DEPTH 8
+
+static spi_device_handle_t spi_handle;
+static spi_transaction_t s_trans[LCD_QUEUE_DEPTH];
+static uint32_t s_queued = 0;     // Sequence number of the last queued transaction
+static uint32_t s_completed = 0;  // Sequence number of the last collected transaction
+static uint16_t *s_line_buf[2] = {NULL, NULL};
+static uint32_t s_line_seq[2] = {0, 0};
+static int s_line_idx = 0;
+#if CONFIG_ESP_PIX_DISPLAY_BENCHMARK
+static int64_t s_wait_us = 0;
+static uint64_t s_bytes_sent = 0;
+#endif
+
+// Called by the SPI driver right before each transaction: drives the DC
+// line from the per-transaction user field (0 = command, 1 = data)
+static void IRAM_ATTR spi_pre_transfer_cb(spi_transaction_t *t)
+{
+    gpio_set_level(CONFIG_ESP_PIX_TFT_DC_GPIO, (int)(intptr_t)t->user);
+}
+
+// Collect one finished transaction, blocking (not spinning) until it is done
+static void lcd_collect_one(void)
+{
+    spi_transaction_t *rt;
+#if CONFIG_ESP_PIX_DISPLAY_BENCHMARK
+    int64_t start = esp_timer_get_time();
+    spi_device_get_trans_result(spi_handle, &rt, portMAX_DELAY);
+    s_wait_us += esp_timer_get_time() - start;
+#else
+    spi_device_get_trans_result(spi_handle, &rt, portMAX_DELAY);
+#endif
+    s_completed++;
+}
+
+// Queue a transaction and return its sequence number
+static uint32_t lcd_queue(const void *data, size_t len, bool is_data)
+{
+    if (s_queued - s_completed == LCD_QUEUE_DEPTH) {
+        lcd_collect_one();
+    }
+
+    spi_transaction_t *t = &s_trans[s_queued % LCD_QUEUE_DEPTH];
+    memset(t, 0, sizeof(*t));
+    t->length = len * 8;
+    t->user = (void *)(intptr_t)is_data;
+    if (len <= sizeof(t->tx_data)) {
+        t->flags = SPI_TRANS_USE_TXDATA;
+        memcpy(t->tx_data, data, len);
+    } else {
+        t->tx_buffer = data;
+    }
+
+    spi_device_queue_trans(spi_handle, t, portMAX_DELAY);
+#if CONFIG_ESP_PIX_DISPLAY_BENCHMARK
+    s_bytes_sent += len;
+#endif
+    return ++s_queued;
+}
+
+esp_err_t lcd_bus_init(size_t max_transfer)
+{
+    // Configure GPIO for DC and RST
+    gpio_config_t io_conf = {
+        .pin_bit_mask = (1ULL << CONFIG_ESP_PIX_TFT_DC_GPIO) | (1ULL << CONFIG_ESP_PIX_TFT_RST_GPIO),
+        .mode = GPIO_MODE_OUTPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_DISABLE,
+    };
+    gpio_config(&io_conf);
+
+    // Configure SPI bus
+    spi_bus_config_t buscfg = {
+        .mosi_io_num = CONFIG_ESP_PIX_TFT_MOSI_GPIO,
+        .miso_io_num = -1,
+        .sclk_io_num = CONFIG_ESP_PIX_TFT_SCK_GPIO,
+        .quadwp_io_num = -1,
+        .quadhd_io_num = -1,
+        .max_transfer_sz = max_transfer,
+    };
+    ESP_ERROR_CHECK(spi_bus_initialize(SPI2_HOST, &buscfg, SPI_DMA_CH_AUTO));
+
+    // Configure SPI device
+    spi_device_interface_config_t devcfg = {
+        .clock_speed_hz = 10 * 1000 * 1000,
+        .mode = 0,
+        .spics_io_num = CONFIG_ESP_PIX_TFT_CS_GPIO,
+        .queue_size = LCD_QUEUE_DEPTH,
+        .pre_cb = spi_pre_transfer_cb,
+    };
+    ESP_ERROR_CHECK(spi_bus_add_device(SPI2_HOST, &devcfg, &spi_handle));
+
+    // Double-buffered DMA line buffers for fills and flushes
+    for (int i = 0; i < 2; i++) {
+        s_line_buf[i] = heap_caps_malloc(LCD_BUS_LINE_BUF_PIXELS * sizeof(uint16_t), MALLOC_CAP_DMA);
+        if (s_line_buf[i] == NULL) {
+            ESP_LOGE(TAG, "Failed to allocate line buffers");
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    // Hardware reset
+    gpio_set_level(CONFIG_ESP_PIX_TFT_RST_GPIO, 1);
+    vTaskDelay(pdMS_TO_TICKS(10));
+    gpio_set_level(CONFIG_ESP_PIX_TFT_RST_GPIO, 0);
+    vTaskDelay(pdMS_TO_TICKS(10));
+    gpio_set_level(CONFIG_ESP_PIX_TFT_RST_GPIO, 1);
+    vTaskDelay(pdMS_TO_TICKS(120));
+
+    return ESP_OK;
+}
+
+void lcd_bus_write_cmd(uint8_t cmd)
+{
+    lcd_queue(&cmd, 1, false);
+}
+
+uint32_t lcd_bus_write_data(const void *data, size_t len)
+{
+    if (len == 0) return s_queued;
+    return lcd_queue(data, len, true);
+}
+
+void lcd_bus_wait(uint32_t seq)
+{
+    while ((int32_t)(seq - s_completed) > 0) {
+        lcd_collect_one();
+    }
+}
+
+void lcd_bus_wait_idle(void)
+{
+    lcd_bus_wait(s_queued);
+}
+
+uint16_t *lcd_bus_next_line_buf(void)
+{
+    s_line_idx ^= 1;
+    lcd_bus_wait(s_line_seq[s_line_idx]);
+    return s_line_buf[s_line_idx];
+}
+
+void lcd_bus_send_line_buf(const uint16_t *buf, size_t pixels)
+{
+    s_line_seq[s_line_idx] = lcd_bus_write_data(buf, pixels * 2);
+}
+
+void lcd_bus_delay_ms(uint32_t ms)
+{
+    vTaskDelay(pdMS_TO_TICKS(ms));
+}
+
+#if CONFIG_ESP_PIX_DISPLAY_BENCHMARK
+void lcd_bus_reset_stats(void)
+{
+    s_wait_us = 0;
+    s_bytes_sent = 0;
+}
+
+void lcd_bus_get_stats(uint64_t *bytes_sent, int64_t *wait_us)
+{
+    *bytes_sent = s_bytes_sent;
+    *wait_us = s_wait_us;
+}
+#endif
@@ -0,0 +1,92 @@
+#ifndef LCD_BUS_H
+#define LCD_BUS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+// Pixels in each of the two line buffers: 20 rows of the 128-pixel panel
+#define LCD_BUS_LINE_BUF_PIXELS (128 * 20)
+
+/**
+ * @brief Set up the panel bus and pulse the panel reset line
+ *
+ * Transfers are queued and run in the background. Every queued transfer
+ * gets a sequence number that increases by one; waiting on a number waits
+ * for that transfer and all earlier ones.
+ *
+ * @param max_transfer Largest single data transfer in bytes
+ * @return ESP_OK on success
+ */
+esp_err_t lcd_bus_init(size_t max_transfer);
+
+/**
+ * @brief Queue a command byte
+ * @param cmd Panel command
+ */
+void lcd_bus_write_cmd(uint8_t cmd);
+
+/**
+ * @brief Queue a data transfer
+ *
+ * Payloads up to 4 bytes are copied; larger buffers must stay untouched
+ * until lcd_bus_wait() on the returned sequence number.
+ *
+ * @param data Data to send
+ * @param len Length in bytes; 0 queues nothing
+ * @return Sequence number of the transfer, or of the last one queued
+ */
+uint32_t lcd_bus_write_data(const void *data, size_t len);
+
+/**
+ * @brief Block until a transfer has finished
+ * @param seq Sequence number returned by lcd_bus_write_data()
+ */
+void lcd_bus_wait(uint32_t seq);
+
+/**
+ * @brief Block until every queued transfer has finished
+ */
+void lcd_bus_wait_idle(void);
+
+/**
+ * @brief Take the next of the two DMA line buffers
+ *
+ * Waits until the panel is done reading it, so one buffer can be filled
+ * while the other is on the bus.
+ *
+ * @return Buffer of LCD_BUS_LINE_BUF_PIXELS pixels
+ */
+uint16_t *lcd_bus_next_line_buf(void);
+
+/**
+ * @brief Queue the buffer from lcd_bus_next_line_buf() as pixel data
+ * @param buf Line buffer
+ * @param pixels Number of pixels to send
+ */
+void lcd_bus_send_line_buf(const uint16_t *buf, size_t pixels);
+
+/**
+ * @brief Wait for the panel, e.g. after a reset or sleep-out command
+ * @param ms Milliseconds to wait
+ */
+void lcd_bus_delay_ms(uint32_t ms);
+
+/**
+ * @brief Start counting bytes sent and time spent waiting on the bus
+ *
+ * Only available with CONFIG_ESP_PIX_DISPLAY_BENCHMARK enabled.
+ */
+void lcd_bus_reset_stats(void);
+
+/**
+ * @brief Read the counters started by lcd_bus_reset_stats()
+ *
+ * Only available with CONFIG_ESP_PIX_DISPLAY_BENCHMARK enabled.
+ *
+ * @param bytes_sent Bytes queued
+ * @param wait_us Time blocked waiting for transfers to finish
+ */
+void lcd_bus_get_stats(uint64_t *bytes_sent, int64_t *wait_us);
+
+#endif // LCD_BUS_H
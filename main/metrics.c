@@ -0,0 +1,258 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <inttypes.h>
+
+#include "metrics.h"
+
+#define METRICS_BUCKETS_MAX 10
+
+// Large enough for the biggest series: a labelled histogram with its
+// HELP/TYPE lines and every count at its widest
+#define METRICS_SERIES_BUF 1536
+
+typedef struct {
+    const char *name;
+    const char *labels;   // Without braces, NULL if none
+    const char *help;
+} metric_desc_t;
+
+typedef struct {
+    metric_desc_t desc;
+    const uint32_t *bounds;   // Upper bucket bounds in us, ascending
+    int num_bounds;
+} hist_desc_t;
+
+typedef struct {
+    atomic_uint_least32_t count;
+    atomic_uint_least32_t buckets[METRICS_BUCKETS_MAX];   // Not cumulative
+    // Sum in us as two words; the high word is bumped when the low one wraps
+    atomic_uint_least32_t sum_lo;
+    atomic_uint_least32_t sum_hi;
+} hist_t;
+
+// Backend round trips over a Wi-Fi link
+static const uint32_t s_network_bounds[] = {
+    50000, 100000, 250000, 500000, 1000000, 2500000, 5000000, 10000000,
+};
+
+// Local work: rendering, QR encoding
+static const uint32_t s_local_bounds[] = {
+    500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000,
+};
+
+// Mechanical actions
+static const uint32_t s_mech_bounds[] = {
+    250000, 500000, 1000000, 2000000, 4000000, 8000000,
+};
+
+#define BOUNDS(b) (b), (int)(sizeof(b) / sizeof((b)[0]))
+
+// Entries sharing a name must be adjacent: HELP/TYPE is written once
+static const metric_desc_t s_counter_desc[METRIC_COUNTER_COUNT] = {
+    [METRIC_CHARGES_CREATED] = { "espix_charges_created_total", "source=\"backend\"",
+                                 "Charges ready to be shown, by where they were created" },
+    [METRIC_CHARGES_BUILT] = { "espix_charges_created_total", "source=\"device\"",
+                               "Charges ready to be shown, by where they were created" },
+    [METRIC_CHARGES_PAID] = { "espix_charges_paid_total", NULL,
+                              "Payments approved" },
+    [METRIC_CHARGES_DISCARDED] = { "espix_charges_discarded_total", NULL,
+                                   "Prepared charges dropped without being shown" },
+    [METRIC_CHARGE_ERRORS] = { "espix_backend_errors_total", "op=\"create_charge\"",
+                               "Failed backend requests" },
+    [METRIC_STATUS_ERRORS] = { "espix_backend_errors_total", "op=\"status\"",
+                               "Failed backend requests" },
+    [METRIC_CANCEL_ERRORS] = { "espix_backend_errors_total", "op=\"cancel\"",
+                               "Failed backend requests" },
+    [METRIC_QR_ERRORS] = { "espix_qr_errors_total", NULL,
+                           "Payloads that did not fit in a QR code" },
+    [METRIC_WIFI_DISCONNECTS] = { "espix_wifi_disconnects_total", NULL,
+                                  "Wi-Fi connection drops" },
+    [METRIC_WIFI_RECONNECTS] = { "espix_wifi_reconnects_total", NULL,
+                                 "Wi-Fi connections regained after a drop" },
+    [METRIC_LATE_PAYMENTS] = { "espix_late_payments_total", NULL,
+                               "Abandoned charges found paid afterwards" },
+};
+
+static const hist_desc_t s_hist_desc[METRIC_HIST_COUNT] = {
+    [METRIC_HIST_CHARGE_REQUEST] = {
+        { "espix_backend_request_seconds", "op=\"create_charge\"", "Backend request duration" },
+        BOUNDS(s_network_bounds) },
+    [METRIC_HIST_STATUS_REQUEST] = {
+        { "espix_backend_request_seconds", "op=\"status\"", "Backend request duration" },
+        BOUNDS(s_network_bounds) },
+    [METRIC_HIST_CANCEL_REQUEST] = {
+        { "espix_backend_request_seconds", "op=\"cancel\"", "Backend request duration" },
+        BOUNDS(s_network_bounds) },
+    [METRIC_HIST_DISPLAY_FLUSH] = {
+        { "espix_display_flush_seconds", NULL, "Time to queue dirty regions to the panel" },
+        BOUNDS(s_local_bounds) },
+    [METRIC_HIST_QR_GENERATE] = {
+        { "espix_qr_generate_seconds", NULL, "QR code generation time" },
+        BOUNDS(s_local_bounds) },
+    [METRIC_HIST_DISPENSE] = {
+        { "espix_dispense_seconds", NULL, "Servo dispense cycle duration" },
+        BOUNDS(s_mech_bounds) },
+};
+
+static atomic_uint_least32_t s_counters[METRIC_COUNTER_COUNT];
+static hist_t s_hists[METRIC_HIST_COUNT];
+
+void metrics_inc(metric_counter_t counter)
+{
+    if (counter < METRIC_COUNTER_COUNT) {
+        atomic_fetch_add_explicit(&s_counters[counter], 1, memory_order_relaxed);
+    }
+}
+
+uint32_t metrics_get(metric_counter_t counter)
+{
+    if (counter >= METRIC_COUNTER_COUNT) return 0;
+    return atomic_load_explicit(&s_counters[counter], memory_order_relaxed);
+}
+
+void metrics_observe(metric_hist_t hist, uint32_t us)
+{
+    if (hist >= METRIC_HIST_COUNT) return;
+
+    const hist_desc_t *d = &s_hist_desc[hist];
+    hist_t *h = &s_hists[hist];
+
+    // Values above the last bound only show up in count (the +Inf bucket)
+    for (int i = 0; i < d->num_bounds; i++) {
+        if (us <= d->bounds[i]) {
+            atomic_fetch_add_explicit(&h->buckets[i], 1, memory_order_relaxed);
+            break;
+        }
+    }
+
+    uint32_t old = atomic_fetch_add_explicit(&h->sum_lo, us, memory_order_relaxed);
+    if ((uint32_t)(old + us) < old) {
+        atomic_fetch_add_explicit(&h->sum_hi, 1, memory_order_relaxed);
+    }
+    atomic_fetch_add_explicit(&h->count, 1, memory_order_relaxed);
+}
+
+static uint64_t hist_sum(hist_t *h)
+{
+    uint32_t hi, lo;
+    do {
+        hi = atomic_load_explicit(&h->sum_hi, memory_order_relaxed);
+        lo = atomic_load_explicit(&h->sum_lo, memory_order_relaxed);
+    } while (hi != atomic_load_explicit(&h->sum_hi, memory_order_relaxed));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+// Format microseconds as seconds without floating point, e.g. 2500 -> 0.0025
+static void format_seconds(char *buf, size_t size, uint64_t us)
+{
+    int n = snprintf(buf, size, "%" PRIu64 ".%06" PRIu64, us / 1000000, us % 1000000);
+    // Drop trailing zeros, keeping at least one decimal
+    while (n > 2 && buf[n - 1] == '0' && buf[n - 2] != '.') {
+        buf[--n] = '\0';
+    }
+}
+
+// Append to a family buffer; returns the new length, or size once full
+static size_t __attribute__((format(printf, 4, 5))) append(char *buf, size_t size, size_t len, const char *fmt, ...)
+{
+    if (len >= size) return size;
+
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf + len, size - len, fmt, ap);
+    va_end(ap);
+
+    return (n < 0 || (size_t)n >= size - len) ? size : len + n;
+}
+
+static size_t write_header(char *buf, size_t size, size_t len, const metric_desc_t *d,
+                           const metric_desc_t *prev, const char *type)
+{
+    if (prev != NULL && strcmp(prev->name, d->name) == 0) {
+        return len;
+    }
+    len = append(buf, size, len, "# HELP %s %s\n", d->name, d->help);
+    return append(buf, size, len, "# TYPE %s %s\n", d->name, type);
+}
+
+static size_t write_hist(char *buf, size_t size, size_t len, metric_hist_t id)
+{
+    const hist_desc_t *d = &s_hist_desc[id];
+    hist_t *h = &s_hists[id];
+    const char *labels = d->desc.labels != NULL ? d->desc.labels : "";
+    const char *sep = d->desc.labels != NULL ? "," : "";
+    char le[24];
+
+    uint32_t cumulative = 0;
+    for (int i = 0; i < d->num_bounds; i++) {
+        cumulative += atomic_load_explicit(&h->buckets[i], memory_order_relaxed);
+        format_seconds(le, sizeof(le), d->bounds[i]);
+        len = append(buf, size, len, "%s_bucket{%s%sle=\"%s\"} %" PRIu32 "\n",
+                     d->desc.name, labels, sep, le, cumulative);
+    }
+
+    // Updates are not atomic as a whole: keep +Inf from going below the buckets
+    uint32_t count = atomic_load_explicit(&h->count, memory_order_relaxed);
+    if (count < cumulative) {
+        count = cumulative;
+    }
+    format_seconds(le, sizeof(le), hist_sum(h));
+
+    len = append(buf, size, len, "%s_bucket{%s%sle=\"+Inf\"} %" PRIu32 "\n",
+                 d->desc.name, labels, sep, count);
+    if (d->desc.labels != NULL) {
+        len = append(buf, size, len, "%s_sum{%s} %s\n", d->desc.name, labels, le);
+        len = append(buf, size, len, "%s_count{%s} %" PRIu32 "\n", d->desc.name, labels, count);
+    } else {
+        len = append(buf, size, len, "%s_sum %s\n", d->desc.name, le);
+        len = append(buf, size, len, "%s_count %" PRIu32 "\n", d->desc.name, count);
+    }
+    return len;
+}
+
+// Send a finished series, unless it was cut short
+static esp_err_t flush(metrics_write_cb_t write, void *ctx, const char *buf, size_t size, size_t len)
+{
+    if (len >= size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    return write(ctx, buf, len);
+}
+
+esp_err_t metrics_export(metrics_write_cb_t write, void *ctx)
+{
+    char buf[METRICS_SERIES_BUF];
+    const metric_desc_t *prev = NULL;
+    esp_err_t err;
+
+    for (int i = 0; i < METRIC_COUNTER_COUNT; i++) {
+        const metric_desc_t *d = &s_counter_desc[i];
+
+        size_t len = write_header(buf, sizeof(buf), 0, d, prev, "counter");
+        if (d->labels != NULL) {
+            len = append(buf, sizeof(buf), len, "%s{%s} %" PRIu32 "\n", d->name, d->labels,
+                         metrics_get(i));
+        } else {
+            len = append(buf, sizeof(buf), len, "%s %" PRIu32 "\n", d->name, metrics_get(i));
+        }
+        if ((err = flush(write, ctx, buf, sizeof(buf), len)) != ESP_OK) {
+            return err;
+        }
+        prev = d;
+    }
+
+    for (int i = 0; i < METRIC_HIST_COUNT; i++) {
+        const metric_desc_t *d = &s_hist_desc[i].desc;
+
+        size_t len = write_header(buf, sizeof(buf), 0, d, prev, "histogram");
+        len = write_hist(buf, sizeof(buf), len, i);
+        if ((err = flush(write, ctx, buf, sizeof(buf), len)) != ESP_OK) {
+            return err;
+        }
+        prev = d;
+    }
+
+    return ESP_OK;
+}
@@ -0,0 +1,86 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+/**
+ * @brief Event counters
+ */
+typedef enum {
+    METRIC_CHARGES_CREATED,     // Charges created on the backend
+    METRIC_CHARGES_BUILT,       // BR Codes built on the device
+    METRIC_CHARGES_PAID,
+    METRIC_CHARGES_DISCARDED,   // Prepared charges dropped without being shown
+    METRIC_CHARGE_ERRORS,       // Charge creation failed (network or backend)
+    METRIC_STATUS_ERRORS,       // Status check failed (network or backend)
+    METRIC_CANCEL_ERRORS,       // Charge cancel failed (network or backend)
+    METRIC_QR_ERRORS,           // Payload did not fit in a QR code
+    METRIC_WIFI_DISCONNECTS,
+    METRIC_WIFI_RECONNECTS,     // Connection regained after a drop
+    METRIC_LATE_PAYMENTS,       // Abandoned charges found paid afterwards
+    METRIC_COUNTER_COUNT
+} metric_counter_t;
+
+/**
+ * @brief Duration histograms
+ */
+typedef enum {
+    METRIC_HIST_CHARGE_REQUEST,   // http_create_charge() round trip
+    METRIC_HIST_STATUS_REQUEST,   // Status check round trip, long-polls excluded
+    METRIC_HIST_CANCEL_REQUEST,   // http_cancel_charge() round trip
+    METRIC_HIST_DISPLAY_FLUSH,    // display_flush() with something to send
+    METRIC_HIST_QR_GENERATE,      // qrcode_generate()
+    METRIC_HIST_DISPENSE,         // Servo cycle, from approval to product out
+    METRIC_HIST_COUNT
+} metric_hist_t;
+
+/**
+ * @brief Increment a counter
+ *
+ * Lock-free; can be called from any task or from timer callbacks.
+ *
+ * @param counter Counter to increment
+ */
+void metrics_inc(metric_counter_t counter);
+
+/**
+ * @brief Read a counter
+ * @param counter Counter to read
+ * @return Current value
+ */
+uint32_t metrics_get(metric_counter_t counter);
+
+/**
+ * @brief Record a duration in a histogram
+ *
+ * Lock-free; can be called from any task or from timer callbacks.
+ *
+ * @param hist Histogram
+ * @param us Duration in microseconds
+ */
+void metrics_observe(metric_hist_t hist, uint32_t us);
+
+/**
+ * @brief Output callback for metrics_export()
+ * @param ctx Context passed to metrics_export()
+ * @param text Text to append, not NUL-terminated
+ * @param len Length of text
+ * @return ESP_OK to continue, anything else aborts the export
+ */
+typedef esp_err_t (*metrics_write_cb_t)(void *ctx, const char *text, size_t len);
+
+/**
+ * @brief Write all metrics in Prometheus text exposition format
+ *
+ * Each series is passed to write in one call, so the output can be sent as
+ * it is produced. Durations are exported in seconds.
+ *
+ * @param write Output callback
+ * @param ctx Passed to write
+ * @return ESP_OK, or the first error returned by write
+ */
+esp_err_t metrics_export(metrics_write_cb_t write, void *ctx);
+
+#endif // METRICS_H
@@ -0,0 +1,422 @@
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "net_worker.h"
+#include "wifi_manager.h"
+
+static const char *TAG = "net_worker";
+
+#define NET_TASK_STACK      8192
+#define NET_TASK_PRIO       5
+#define NET_QUEUE_LEN       8
+
+typedef struct {
+    bool used;
+    bool running;
+    net_req_type_t type;
+    net_prio_t prio;
+    uint32_t seq;               // Submission order
+    int64_t deadline;           // esp_timer time in ms, 0 for none
+    char payment_id[64];        // Status checks and cancels
+    float amount;               // NET_REQ_CREATE_CHARGE
+    const char *description;
+    payment_response_t *out;
+    net_done_cb_t cb;
+    void *ctx;
+} net_req_t;
+
+static TaskHandle_t s_task = NULL;
+static SemaphoreHandle_t s_lock = NULL;
+static net_req_t s_queue[NET_QUEUE_LEN];
+static uint32_t s_seq = 0;
+
+// Status checks sent together by the worker task. Static to keep them off
+// its stack, which the TLS handshake needs.
+static int s_batch_idx[HTTP_STATUS_BATCH_MAX];
+static net_req_t s_batch[HTTP_STATUS_BATCH_MAX];
+static bool s_batch_unsupported = false;
+
+static int64_t now_ms(void)
+{
+    return esp_timer_get_time() / 1000;
+}
+
+static void complete(const net_req_t *req, esp_err_t err, payment_status_t status)
+{
+    if (req->cb == NULL) {
+        return;
+    }
+
+    net_result_t result = {
+        .type = req->type,
+        .err = err,
+        .status = status,
+        .payment_id = req->type != NET_REQ_CREATE_CHARGE ? req->payment_id : NULL,
+    };
+    req->cb(&result, req->ctx);
+}
+
+// a is more urgent than b: higher priority, then submitted earlier
+static bool more_urgent(const net_req_t *a, const net_req_t *b)
+{
+    if (a->prio != b->prio) {
+        return a->prio < b->prio;
+    }
+    return (int32_t)(a->seq - b->seq) < 0;
+}
+
+static esp_err_t submit(net_req_t *req, uint32_t deadline_ms)
+{
+    if (s_lock == NULL) {
+        ESP_LOGE(TAG, "net_worker_init() not called");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    net_req_t evicted = { .used = false };
+    int slot = -1;
+    int victim = -1;
+
+    req->used = true;
+    req->running = false;
+    req->deadline = deadline_ms > 0 ? now_ms() + deadline_ms : 0;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    req->seq = ++s_seq;
+    for (int i = 0; i < NET_QUEUE_LEN; i++) {
+        if (!s_queue[i].used) {
+            if (slot < 0) {
+                slot = i;
+            }
+        } else if (!s_queue[i].running &&
+                   (victim < 0 || more_urgent(&s_queue[victim], &s_queue[i]))) {
+            victim = i;
+        }
+    }
+
+    // A full queue makes room by dropping its least urgent request
+    if (slot < 0) {
+        if (victim < 0 || !more_urgent(req, &s_queue[victim])) {
+            xSemaphoreGive(s_lock);
+            return ESP_ERR_NO_MEM;
+        }
+        evicted = s_queue[victim];
+        slot = victim;
+    }
+    s_queue[slot] = *req;
+    xSemaphoreGive(s_lock);
+
+    if (evicted.used) {
+        ESP_LOGW(TAG, "Queue full, dropped request type %d", evicted.type);
+        complete(&evicted, ESP_ERR_NO_MEM, PAYMENT_STATUS_ERROR);
+    }
+
+    xTaskNotifyGive(s_task);
+    return ESP_OK;
+}
+
+/**
+ * @brief Mark the most urgent queued request as running
+ * @param req Where to copy it
+ * @return Its queue index, -1 if the queue is empty
+ */
+static int take_next(net_req_t *req)
+{
+    int best = -1;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (int i = 0; i < NET_QUEUE_LEN; i++) {
+        if (s_queue[i].used && !s_queue[i].running &&
+            (best < 0 || more_urgent(&s_queue[i], &s_queue[best]))) {
+            best = i;
+        }
+    }
+    if (best >= 0) {
+        s_queue[best].running = true;
+        *req = s_queue[best];
+    }
+    xSemaphoreGive(s_lock);
+
+    return best;
+}
+
+/**
+ * @brief Remove a finished request and report its result
+ *
+ * A status check or cancel that reached the backend also answers the
+ * requests of the same type queued for the same payment ID.
+ */
+static void finish(int idx, const net_req_t *req, bool ran, esp_err_t err, payment_status_t status)
+{
+    net_req_t done[NET_QUEUE_LEN];
+    int count = 0;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    done[count++] = *req;
+    s_queue[idx].used = false;
+
+    if (ran && req->type != NET_REQ_CREATE_CHARGE) {
+        for (int i = 0; i < NET_QUEUE_LEN; i++) {
+            net_req_t *q = &s_queue[i];
+            if (q->used && !q->running && q->type == req->type &&
+                strcmp(q->payment_id, req->payment_id) == 0) {
+                done[count++] = *q;
+                q->used = false;
+            }
+        }
+    }
+    xSemaphoreGive(s_lock);
+
+    for (int i = 0; i < count; i++) {
+        complete(&done[i], err, status);
+    }
+}
+
+/**
+ * @brief Mark the other queued status checks as running, one per payment ID
+ *
+ * Checks whose deadline has passed are left for the worker to time out.
+ *
+ * @param count Entries already in s_batch
+ * @param now Current time in ms
+ * @return New number of entries in s_batch
+ */
+static int take_status_batch(int count, int64_t now)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (int i = 0; i < NET_QUEUE_LEN && count < HTTP_STATUS_BATCH_MAX; i++) {
+        net_req_t *q = &s_queue[i];
+        if (!q->used || q->running || q->type != NET_REQ_CHECK_STATUS ||
+            (q->deadline != 0 && now >= q->deadline)) {
+            continue;
+        }
+
+        // Checks of an ID already in the batch are answered by finish()
+        bool duplicate = false;
+        for (int j = 0; j < count && !duplicate; j++) {
+            duplicate = strcmp(s_batch[j].payment_id, q->payment_id) == 0;
+        }
+        if (!duplicate) {
+            q->running = true;
+            s_batch_idx[count] = i;
+            s_batch[count++] = *q;
+        }
+    }
+    xSemaphoreGive(s_lock);
+
+    return count;
+}
+
+/**
+ * @brief Run a status check together with the other queued ones
+ *
+ * One round trip answers every payment ID in the queue. If there is
+ * nothing to batch with, or the backend has no batch endpoint, req is
+ * left for the caller to run on its own.
+ *
+ * @return true if req was answered
+ */
+static bool check_status_batch(int idx, const net_req_t *req, int64_t now, int timeout_ms)
+{
+    s_batch_idx[0] = idx;
+    s_batch[0] = *req;
+    int count = take_status_batch(1, now);
+    if (count == 1) {
+        return false;
+    }
+
+    const char *ids[HTTP_STATUS_BATCH_MAX];
+    payment_status_t statuses[HTTP_STATUS_BATCH_MAX];
+    for (int i = 0; i < count; i++) {
+        ids[i] = s_batch[i].payment_id;
+        // The earliest deadline caps the whole request
+        if (s_batch[i].deadline != 0 &&
+            (timeout_ms == 0 || s_batch[i].deadline - now < timeout_ms)) {
+            timeout_ms = s_batch[i].deadline - now;
+        }
+    }
+
+    esp_err_t err = http_check_payment_statuses(ids, count, statuses, timeout_ms);
+    if (err == ESP_ERR_NOT_SUPPORTED) {
+        ESP_LOGW(TAG, "Backend has no batch status endpoint, checking one at a time");
+        s_batch_unsupported = true;
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        for (int i = 1; i < count; i++) {
+            s_queue[s_batch_idx[i]].running = false;
+        }
+        xSemaphoreGive(s_lock);
+        return false;
+    }
+
+    for (int i = 0; i < count; i++) {
+        finish(s_batch_idx[i], &s_batch[i], true, err, statuses[i]);
+    }
+    return true;
+}
+
+static void worker_task(void *arg)
+{
+    while (1) {
+        net_req_t req;
+        int idx = take_next(&req);
+        if (idx < 0) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        esp_err_t err = ESP_OK;
+        payment_status_t status = PAYMENT_STATUS_UNKNOWN;
+        int timeout_ms = 0;
+        int64_t now = now_ms();
+
+        if (req.deadline != 0 && now >= req.deadline) {
+            finish(idx, &req, false, ESP_ERR_TIMEOUT, PAYMENT_STATUS_ERROR);
+            continue;
+        }
+        if (!wifi_manager_is_connected()) {
+            finish(idx, &req, false, ESP_ERR_INVALID_STATE, PAYMENT_STATUS_ERROR);
+            continue;
+        }
+        if (req.deadline != 0) {
+            timeout_ms = req.deadline - now;
+        }
+        if (req.type == NET_REQ_CHECK_STATUS && !s_batch_unsupported &&
+            check_status_batch(idx, &req, now, timeout_ms)) {
+            continue;
+        }
+
+        switch (req.type) {
+            case NET_REQ_CREATE_CHARGE:
+                err = http_create_charge(req.amount, req.description, req.out, timeout_ms);
+                if (err == ESP_OK && !req.out->success) {
+                    err = ESP_FAIL;
+                }
+                break;
+            case NET_REQ_CHECK_STATUS:
+                status = http_check_payment_status(req.payment_id, timeout_ms);
+                err = status == PAYMENT_STATUS_ERROR ? ESP_FAIL : ESP_OK;
+                break;
+            case NET_REQ_CANCEL_CHARGE:
+                status = http_cancel_charge(req.payment_id, timeout_ms);
+                err = status == PAYMENT_STATUS_ERROR ? ESP_FAIL : ESP_OK;
+                break;
+        }
+        finish(idx, &req, true, err, status);
+    }
+}
+
+esp_err_t net_worker_init(void)
+{
+    if (s_task != NULL) {
+        return ESP_OK;
+    }
+
+    s_lock = xSemaphoreCreateMutex();
+    if (s_lock == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (xTaskCreate(worker_task, "net_worker", NET_TASK_STACK, NULL,
+                    NET_TASK_PRIO, &s_task) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t net_create_charge(float amount, const char *description, payment_response_t *out,
+                            net_prio_t prio, uint32_t deadline_ms, net_done_cb_t cb, void *ctx)
+{
+    if (description == NULL || out == NULL || prio >= NET_PRIO_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    net_req_t req = {
+        .type = NET_REQ_CREATE_CHARGE,
+        .prio = prio,
+        .amount = amount,
+        .description = description,
+        .out = out,
+        .cb = cb,
+        .ctx = ctx,
+    };
+    return submit(&req, deadline_ms);
+}
+
+static esp_err_t submit_for_id(net_req_type_t type, const char *payment_id, net_prio_t prio,
+                               uint32_t deadline_ms, net_done_cb_t cb, void *ctx)
+{
+    if (payment_id == NULL || payment_id[0] == '\0' || prio >= NET_PRIO_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    net_req_t req = {
+        .type = type,
+        .prio = prio,
+        .cb = cb,
+        .ctx = ctx,
+    };
+    strlcpy(req.payment_id, payment_id, sizeof(req.payment_id));
+    return submit(&req, deadline_ms);
+}
+
+esp_err_t net_check_status(const char *payment_id, net_prio_t prio, uint32_t deadline_ms,
+                           net_done_cb_t cb, void *ctx)
+{
+    return submit_for_id(NET_REQ_CHECK_STATUS, payment_id, prio, deadline_ms, cb, ctx);
+}
+
+esp_err_t net_cancel_charge(const char *payment_id, net_prio_t prio, uint32_t deadline_ms,
+                            net_done_cb_t cb, void *ctx)
+{
+    return submit_for_id(NET_REQ_CANCEL_CHARGE, payment_id, prio, deadline_ms, cb, ctx);
+}
+
+int net_worker_pending(void)
+{
+    int count = 0;
+
+    if (s_lock == NULL) {
+        return 0;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (int i = 0; i < NET_QUEUE_LEN; i++) {
+        if (s_queue[i].used) {
+            count++;
+        }
+    }
+    xSemaphoreGive(s_lock);
+
+    return count;
+}
+
+typedef struct {
+    SemaphoreHandle_t done;
+    esp_err_t err;
+} net_wait_t;
+
+static void wait_cb(const net_result_t *result, void *ctx)
+{
+    net_wait_t *w = ctx;
+    w->err = result->err;
+    xSemaphoreGive(w->done);
+}
+
+esp_err_t net_create_charge_wait(float amount, const char *description, payment_response_t *out,
+                                 net_prio_t prio, uint32_t deadline_ms)
+{
+    StaticSemaphore_t sem;
+    net_wait_t w = { .done = xSemaphoreCreateBinaryStatic(&sem), .err = ESP_FAIL };
+
+    esp_err_t err = net_create_charge(amount, description, out, prio, deadline_ms, wait_cb, &w);
+    if (err == ESP_OK) {
+        // The request writes to out, so wait for it to leave the queue
+        xSemaphoreTake(w.done, portMAX_DELAY);
+        err = w.err;
+    }
+    vSemaphoreDelete(w.done);
+    return err;
+}
@@ -0,0 +1,133 @@
+#ifndef NET_WORKER_H
+#define NET_WORKER_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "http_client.h"
+
+/**
+ * @brief Request priority, most urgent first
+ */
+typedef enum {
+    NET_PRIO_INTERACTIVE,       // A customer is waiting for the result
+    NET_PRIO_NORMAL,
+    NET_PRIO_BACKGROUND,        // Pool refills, reconciliation, reporting
+    NET_PRIO_COUNT
+} net_prio_t;
+
+/**
+ * @brief Request types
+ */
+typedef enum {
+    NET_REQ_CREATE_CHARGE,
+    NET_REQ_CHECK_STATUS,
+    NET_REQ_CANCEL_CHARGE,
+} net_req_type_t;
+
+/**
+ * @brief Outcome of a request, passed to its callback
+ */
+typedef struct {
+    net_req_type_t type;
+    esp_err_t err;              // ESP_OK, ESP_ERR_TIMEOUT if the deadline passed while
+                                // queued, ESP_ERR_INVALID_STATE without WiFi,
+                                // ESP_ERR_NO_MEM if evicted, or the request's error
+    payment_status_t status;    // Not for NET_REQ_CREATE_CHARGE
+    const char *payment_id;     // Not for NET_REQ_CREATE_CHARGE
+} net_result_t;
+
+/**
+ * @brief Completion callback
+ *
+ * Runs on the worker task, or on the task queuing a more urgent request
+ * when the queue is full and this one is dropped. Must not block.
+ *
+ * @param result Outcome, valid during the call only
+ * @param ctx Context given when the request was queued
+ */
+typedef void (*net_done_cb_t)(const net_result_t *result, void *ctx);
+
+/**
+ * @brief Start the network worker task
+ *
+ * The worker owns the interactive backend connection and runs one request
+ * at a time from a bounded queue, most urgent first and in submission
+ * order within a priority. The payment watcher's long-polls keep their own
+ * connection and task.
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t net_worker_init(void);
+
+/**
+ * @brief Queue a charge creation
+ *
+ * @param amount Amount in BRL
+ * @param description Description; must stay valid until the callback
+ * @param out Where the response is written before the callback runs
+ * @param prio Priority
+ * @param deadline_ms Time from now until the result is no longer wanted,
+ *                    0 for none. Also caps the request timeout.
+ * @param cb Completion callback
+ * @param ctx Passed to cb
+ * @return ESP_OK if queued, ESP_ERR_NO_MEM if the queue is full of
+ *         requests at least as urgent
+ */
+esp_err_t net_create_charge(float amount, const char *description, payment_response_t *out,
+                            net_prio_t prio, uint32_t deadline_ms, net_done_cb_t cb, void *ctx);
+
+/**
+ * @brief Queue a one-shot status check
+ *
+ * Checks of the same payment ID are coalesced: one request answers every
+ * check queued for that ID, including those queued while it was running.
+ * Checks of different IDs waiting in the queue together go out as one
+ * http_check_payment_statuses() request when the backend supports it.
+ *
+ * @param payment_id Payment ID, copied
+ * @param prio Priority
+ * @param deadline_ms Time from now until the result is no longer wanted,
+ *                    0 for none. Also caps the request timeout.
+ * @param cb Completion callback
+ * @param ctx Passed to cb
+ * @return ESP_OK if queued, ESP_ERR_NO_MEM if the queue is full of
+ *         requests at least as urgent
+ */
+esp_err_t net_check_status(const char *payment_id, net_prio_t prio, uint32_t deadline_ms,
+                           net_done_cb_t cb, void *ctx);
+
+/**
+ * @brief Queue a charge cancel
+ *
+ * Coalesced like status checks; the status is the one returned by
+ * http_cancel_charge().
+ *
+ * @param payment_id Payment ID, copied
+ * @param prio Priority
+ * @param deadline_ms Time from now until the result is no longer wanted,
+ *                    0 for none. Also caps the request timeout.
+ * @param cb Completion callback
+ * @param ctx Passed to cb
+ * @return ESP_OK if queued, ESP_ERR_NO_MEM if the queue is full of
+ *         requests at least as urgent
+ */
+esp_err_t net_cancel_charge(const char *payment_id, net_prio_t prio, uint32_t deadline_ms,
+                            net_done_cb_t cb, void *ctx);
+
+/**
+ * @brief Number of requests queued or running
+ */
+int net_worker_pending(void);
+
+/**
+ * @brief Create a charge and wait for the result
+ *
+ * Queues the request like net_create_charge() and blocks the calling task
+ * until it completes. Must not be called from the worker task.
+ *
+ * @return Result of the request
+ */
+esp_err_t net_create_charge_wait(float amount, const char *description, payment_response_t *out,
+                                 net_prio_t prio, uint32_t deadline_ms);
+
+#endif // NET_WORKER_H
@@ -0,0 +1,189 @@
+#include <string.h>
+#include <inttypes.h>
+#include <sys/param.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "payment_watch.h"
+#include "wifi_manager.h"
+#include "trace.h"
+
+static const char *TAG = "payment_watch";
+
+#define WATCH_TASK_STACK    8192
+#define WATCH_TASK_PRIO     5
+
+// How long to stay on plain polling before trying long-poll again
+#define LONGPOLL_RETRY_MS   60000
+
+static TaskHandle_t s_task = NULL;
+static SemaphoreHandle_t s_lock = NULL;
+static payment_watch_cb_t s_callback = NULL;
+
+// Payment being watched. generation changes on every start/stop so results
+// of requests made for an older payment can be recognised and dropped.
+static char s_payment_id[64];
+static uint32_t s_generation = 0;
+
+static int64_t now_ms(void)
+{
+    return esp_timer_get_time() / 1000;
+}
+
+static bool current_payment(char *id, size_t id_len, uint32_t *generation)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    // An abort issued after this point is for the payment read here
+    http_clear_abort_wait();
+    strlcpy(id, s_payment_id, id_len);
+    *generation = s_generation;
+    xSemaphoreGive(s_lock);
+    return id[0] != '\0';
+}
+
+static bool is_current(uint32_t generation)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    bool current = generation == s_generation;
+    xSemaphoreGive(s_lock);
+    return current;
+}
+
+/**
+ * @brief Report a status change unless the payment was replaced meanwhile
+ *
+ * Final states also end the watch.
+ */
+static void publish(const char *id, uint32_t generation, payment_status_t status)
+{
+    bool final = status == PAYMENT_STATUS_APPROVED || status == PAYMENT_STATUS_REJECTED ||
+                 status == PAYMENT_STATUS_CANCELLED;
+    bool current;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    current = generation == s_generation;
+    if (current && final) {
+        s_payment_id[0] = '\0';
+    }
+    xSemaphoreGive(s_lock);
+
+    if (current) {
+        s_callback(id, status);
+    }
+}
+
+static void watch_task(void *arg)
+{
+    char id[64];
+    uint32_t generation;
+    uint32_t last_generation = 0;
+    payment_status_t last_status = PAYMENT_STATUS_UNKNOWN;
+    uint32_t poll_ms = CONFIG_ESP_PIX_PAYMENT_POLL_MIN_MS;
+    int64_t longpoll_retry_at = 0;
+
+    while (1) {
+        if (!current_payment(id, sizeof(id), &generation)) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        if (generation != last_generation) {
+            last_generation = generation;
+            last_status = PAYMENT_STATUS_UNKNOWN;
+            poll_ms = CONFIG_ESP_PIX_PAYMENT_POLL_MIN_MS;
+        }
+
+        if (!wifi_manager_is_connected()) {
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(poll_ms));
+            continue;
+        }
+
+        bool longpoll = CONFIG_ESP_PIX_PAYMENT_LONGPOLL_S > 0 && now_ms() >= longpoll_retry_at;
+        int wait_s = longpoll ? CONFIG_ESP_PIX_PAYMENT_LONGPOLL_S : 0;
+
+        // Retries after a failed first request still count as the first poll
+        trace_span_t span = last_status == PAYMENT_STATUS_UNKNOWN ? TRACE_FIRST_POLL
+                                                                  : TRACE_STATUS_POLL;
+        uint32_t trace = trace_begin(span);
+        int64_t start = now_ms();
+        payment_status_t status = http_wait_payment_status(id, wait_s);
+        int64_t elapsed = now_ms() - start;
+        trace_end(span, trace);
+
+        if (!is_current(generation)) {
+            // Aborted or answered for a payment no longer watched
+            continue;
+        }
+
+        if (status == PAYMENT_STATUS_ERROR || status == PAYMENT_STATUS_UNKNOWN) {
+            // Back off while the backend is unreachable or misbehaving
+            poll_ms = MIN(poll_ms * 2, CONFIG_ESP_PIX_PAYMENT_POLL_MAX_MS);
+            if (longpoll) {
+                ESP_LOGW(TAG, "Long-poll failed, polling every %" PRIu32 " ms", poll_ms);
+                longpoll_retry_at = now_ms() + LONGPOLL_RETRY_MS;
+            }
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(poll_ms));
+            continue;
+        }
+
+        poll_ms = CONFIG_ESP_PIX_PAYMENT_POLL_MIN_MS;
+
+        if (status != last_status) {
+            last_status = status;
+            publish(id, generation, status);
+        }
+
+        if (longpoll && status == PAYMENT_STATUS_PENDING &&
+            elapsed < CONFIG_ESP_PIX_PAYMENT_LONGPOLL_S * 1000 / 2) {
+            // The backend answered without holding the request
+            ESP_LOGW(TAG, "Backend does not long-poll, polling every %" PRIu32 " ms", poll_ms);
+            longpoll_retry_at = now_ms() + LONGPOLL_RETRY_MS;
+        }
+
+        if (!longpoll || now_ms() < longpoll_retry_at) {
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(poll_ms));
+        }
+    }
+}
+
+esp_err_t payment_watch_init(payment_watch_cb_t callback)
+{
+    if (s_task != NULL) {
+        return ESP_OK;
+    }
+
+    s_callback = callback;
+    s_lock = xSemaphoreCreateMutex();
+    if (s_lock == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (xTaskCreate(watch_task, "payment_watch", WATCH_TASK_STACK, NULL,
+                    WATCH_TASK_PRIO, &s_task) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void payment_watch_start(const char *payment_id)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    strlcpy(s_payment_id, payment_id, sizeof(s_payment_id));
+    s_generation++;
+    http_abort_wait();
+    xSemaphoreGive(s_lock);
+
+    xTaskNotifyGive(s_task);
+}
+
+void payment_watch_stop(void)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    s_payment_id[0] = '\0';
+    s_generation++;
+    http_abort_wait();
+    xSemaphoreGive(s_lock);
+}
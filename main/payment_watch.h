@@ -0,0 +1,50 @@
+#ifndef PAYMENT_WATCH_H
+#define PAYMENT_WATCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "http_client.h"
+
+/**
+ * @brief Callback for status changes of the watched payment
+ *
+ * Runs on the watcher task; must not block.
+ *
+ * @param payment_id Payment the status belongs to
+ * @param status New status
+ */
+typedef void (*payment_watch_cb_t)(const char *payment_id, payment_status_t status);
+
+/**
+ * @brief Start the payment watcher task
+ *
+ * The watcher follows one payment at a time. It long-polls the backend so an
+ * approval is seen as soon as the backend knows about it, and falls back to
+ * adaptive polling when the backend does not hold requests or the link is
+ * failing.
+ *
+ * @param callback Called on every status change
+ * @return ESP_OK on success
+ */
+esp_err_t payment_watch_init(payment_watch_cb_t callback);
+
+/**
+ * @brief Start watching a payment, replacing any previous one
+ *
+ * A long-poll still in flight for the previous payment is aborted, so the
+ * new one is polled within a fraction of a second.
+ *
+ * @param payment_id Payment ID to watch
+ */
+void payment_watch_start(const char *payment_id);
+
+/**
+ * @brief Stop watching
+ *
+ * Aborts a long-poll in flight. A status change already being reported
+ * may still reach the callback.
+ */
+void payment_watch_stop(void);
+
+#endif // PAYMENT_WATCH_H
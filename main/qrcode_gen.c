@@ -1,177 +1,471 @@
 /**
- * QR Code generator - Simplified implementation based on ricmoo/QRCode
+ * QR Code generator - byte mode encoder following ISO/IEC 18004, in the
+ * spirit of ricmoo/QRCode and nayuki/QR-Code-generator
  * Adapted for ESP-IDF
+ *
+ * Reed-Solomon uses GF(256) log/antilog tables and precomputed generator
+ * polynomials. The matrix is kept as packed rows of 32-bit words, written
+ * directly into the caller's qrcode_t, so masking and penalty scoring work
+ * on whole words. Function patterns are built once per version.
  */
 
 #include <string.h>
 #include <stdlib.h>
 #include "qrcode_gen.h"
 
-// QR Code version 8 parameters
-#define VERSION 8
-#define MODULES_PER_SIDE (17 + VERSION * 4)  // 49 for version 8
+#define MAX_ABS(a, b) (abs(a) > abs(b) ? abs(a) : abs(b))
 
-// Working buffer for QR code generation
-static uint8_t qr_modules[MODULES_PER_SIDE][MODULES_PER_SIDE];
+// Codewords in the largest supported version (raw data modules / 8)
+#define MAX_CODEWORDS 655
 
-static void set_module(int x, int y, bool value) {
-    if (x >= 0 && x < MODULES_PER_SIDE && y >= 0 && y < MODULES_PER_SIDE) {
-        qr_modules[y][x] = value ? 1 : 0;
+#define ROW_WORDS QRCODE_ROW_WORDS
+typedef uint32_t qr_row_t[ROW_WORDS];
+
+// Matrix being drawn: the caller's qrcode_t rows during generation, or the
+// template while it is being built
+static qr_row_t *s_modules;
+static int s_size;
+
+// Function patterns for s_template_version, built once per version and
+// reused by every generation: module colors (format area left blank) and
+// the mask of modules that carry no data
+static qr_row_t s_template[QRCODE_MAX_SIZE];
+static qr_row_t s_function[QRCODE_MAX_SIZE];
+static int s_template_version = 0;
+
+// Transposed copy of the matrix for column scoring
+static qr_row_t s_columns[QRCODE_MAX_SIZE];
+
+static uint8_t s_data[MAX_CODEWORDS];
+static uint8_t s_codewords[MAX_CODEWORDS];
+static uint8_t s_ecc[MAX_CODEWORDS];
+
+// Error correction codewords per block, indexed [ecc][version]
+static const int8_t ECC_CODEWORDS_PER_BLOCK[4][QRCODE_MAX_VERSION + 1] = {
+    {-1,  7, 10, 15, 20, 26, 18, 20, 24, 30, 18, 20, 24, 26, 30, 22},  // L
+    {-1, 10, 16, 26, 18, 24, 16, 18, 22, 22, 26, 30, 22, 22, 24, 24},  // M
+    {-1, 13, 22, 18, 26, 18, 24, 18, 22, 20, 24, 28, 26, 24, 20, 30},  // Q
+    {-1, 17, 28, 22, 16, 22, 28, 26, 26, 24, 28, 24, 28, 22, 24, 24},  // H
+};
+
+// Number of error correction blocks, indexed [ecc][version]
+static const int8_t NUM_ERROR_CORRECTION_BLOCKS[4][QRCODE_MAX_VERSION + 1] = {
+    {-1, 1, 1, 1, 1, 1, 2, 2, 2, 2,  4,  4,  4,  4,  4,  6},  // L
+    {-1, 1, 1, 1, 2, 2, 4, 4, 4, 5,  5,  5,  8,  9,  9, 10},  // M
+    {-1, 1, 1, 2, 2, 4, 4, 6, 6, 8,  8,  8, 10, 12, 16, 12},  // Q
+    {-1, 1, 1, 2, 4, 4, 4, 5, 6, 8,  8, 11, 11, 16, 16, 18},  // H
+};
+
+// ECC level indicator used in the format information (L=01 M=00 Q=11 H=10)
+static const uint8_t ECC_FORMAT_BITS[4] = {1, 0, 3, 2};
+
+// GF(256) antilog table for the QR polynomial 0x11D, doubled so that
+// gf_exp[log a + log b] needs no modulo
+static const uint8_t gf_exp[510] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1D, 0x3A, 0x74, 0xE8, 0xCD, 0x87, 0x13, 0x26,
+    0x4C, 0x98, 0x2D, 0x5A, 0xB4, 0x75, 0xEA, 0xC9, 0x8F, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0,
+    0x9D, 0x27, 0x4E, 0x9C, 0x25, 0x4A, 0x94, 0x35, 0x6A, 0xD4, 0xB5, 0x77, 0xEE, 0xC1, 0x9F, 0x23,
+    0x46, 0x8C, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0x5D, 0xBA, 0x69, 0xD2, 0xB9, 0x6F, 0xDE, 0xA1,
+    0x5F, 0xBE, 0x61, 0xC2, 0x99, 0x2F, 0x5E, 0xBC, 0x65, 0xCA, 0x89, 0x0F, 0x1E, 0x3C, 0x78, 0xF0,
+    0xFD, 0xE7, 0xD3, 0xBB, 0x6B, 0xD6, 0xB1, 0x7F, 0xFE, 0xE1, 0xDF, 0xA3, 0x5B, 0xB6, 0x71, 0xE2,
+    0xD9, 0xAF, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0D, 0x1A, 0x34, 0x68, 0xD0, 0xBD, 0x67, 0xCE,
+    0x81, 0x1F, 0x3E, 0x7C, 0xF8, 0xED, 0xC7, 0x93, 0x3B, 0x76, 0xEC, 0xC5, 0x97, 0x33, 0x66, 0xCC,
+    0x85, 0x17, 0x2E, 0x5C, 0xB8, 0x6D, 0xDA, 0xA9, 0x4F, 0x9E, 0x21, 0x42, 0x84, 0x15, 0x2A, 0x54,
+    0xA8, 0x4D, 0x9A, 0x29, 0x52, 0xA4, 0x55, 0xAA, 0x49, 0x92, 0x39, 0x72, 0xE4, 0xD5, 0xB7, 0x73,
+    0xE6, 0xD1, 0xBF, 0x63, 0xC6, 0x91, 0x3F, 0x7E, 0xFC, 0xE5, 0xD7, 0xB3, 0x7B, 0xF6, 0xF1, 0xFF,
+    0xE3, 0xDB, 0xAB, 0x4B, 0x96, 0x31, 0x62, 0xC4, 0x95, 0x37, 0x6E, 0xDC, 0xA5, 0x57, 0xAE, 0x41,
+    0x82, 0x19, 0x32, 0x64, 0xC8, 0x8D, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xDD, 0xA7, 0x53, 0xA6,
+    0x51, 0xA2, 0x59, 0xB2, 0x79, 0xF2, 0xF9, 0xEF, 0xC3, 0x9B, 0x2B, 0x56, 0xAC, 0x45, 0x8A, 0x09,
+    0x12, 0x24, 0x48, 0x90, 0x3D, 0x7A, 0xF4, 0xF5, 0xF7, 0xF3, 0xFB, 0xEB, 0xCB, 0x8B, 0x0B, 0x16,
+    0x2C, 0x58, 0xB0, 0x7D, 0xFA, 0xE9, 0xCF, 0x83, 0x1B, 0x36, 0x6C, 0xD8, 0xAD, 0x47, 0x8E, 0x01,
+    0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1D, 0x3A, 0x74, 0xE8, 0xCD, 0x87, 0x13, 0x26, 0x4C,
+    0x98, 0x2D, 0x5A, 0xB4, 0x75, 0xEA, 0xC9, 0x8F, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x9D,
+    0x27, 0x4E, 0x9C, 0x25, 0x4A, 0x94, 0x35, 0x6A, 0xD4, 0xB5, 0x77, 0xEE, 0xC1, 0x9F, 0x23, 0x46,
+    0x8C, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0x5D, 0xBA, 0x69, 0xD2, 0xB9, 0x6F, 0xDE, 0xA1, 0x5F,
+    0xBE, 0x61, 0xC2, 0x99, 0x2F, 0x5E, 0xBC, 0x65, 0xCA, 0x89, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xFD,
+    0xE7, 0xD3, 0xBB, 0x6B, 0xD6, 0xB1, 0x7F, 0xFE, 0xE1, 0xDF, 0xA3, 0x5B, 0xB6, 0x71, 0xE2, 0xD9,
+    0xAF, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0D, 0x1A, 0x34, 0x68, 0xD0, 0xBD, 0x67, 0xCE, 0x81,
+    0x1F, 0x3E, 0x7C, 0xF8, 0xED, 0xC7, 0x93, 0x3B, 0x76, 0xEC, 0xC5, 0x97, 0x33, 0x66, 0xCC, 0x85,
+    0x17, 0x2E, 0x5C, 0xB8, 0x6D, 0xDA, 0xA9, 0x4F, 0x9E, 0x21, 0x42, 0x84, 0x15, 0x2A, 0x54, 0xA8,
+    0x4D, 0x9A, 0x29, 0x52, 0xA4, 0x55, 0xAA, 0x49, 0x92, 0x39, 0x72, 0xE4, 0xD5, 0xB7, 0x73, 0xE6,
+    0xD1, 0xBF, 0x63, 0xC6, 0x91, 0x3F, 0x7E, 0xFC, 0xE5, 0xD7, 0xB3, 0x7B, 0xF6, 0xF1, 0xFF, 0xE3,
+    0xDB, 0xAB, 0x4B, 0x96, 0x31, 0x62, 0xC4, 0x95, 0x37, 0x6E, 0xDC, 0xA5, 0x57, 0xAE, 0x41, 0x82,
+    0x19, 0x32, 0x64, 0xC8, 0x8D, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xDD, 0xA7, 0x53, 0xA6, 0x51,
+    0xA2, 0x59, 0xB2, 0x79, 0xF2, 0xF9, 0xEF, 0xC3, 0x9B, 0x2B, 0x56, 0xAC, 0x45, 0x8A, 0x09, 0x12,
+    0x24, 0x48, 0x90, 0x3D, 0x7A, 0xF4, 0xF5, 0xF7, 0xF3, 0xFB, 0xEB, 0xCB, 0x8B, 0x0B, 0x16, 0x2C,
+    0x58, 0xB0, 0x7D, 0xFA, 0xE9, 0xCF, 0x83, 0x1B, 0x36, 0x6C, 0xD8, 0xAD, 0x47, 0x8E,
+};
+
+// GF(256) log table (gf_log[0] is unused)
+static const uint8_t gf_log[256] = {
+    0x00, 0x00, 0x01, 0x19, 0x02, 0x32, 0x1A, 0xC6, 0x03, 0xDF, 0x33, 0xEE, 0x1B, 0x68, 0xC7, 0x4B,
+    0x04, 0x64, 0xE0, 0x0E, 0x34, 0x8D, 0xEF, 0x81, 0x1C, 0xC1, 0x69, 0xF8, 0xC8, 0x08, 0x4C, 0x71,
+    0x05, 0x8A, 0x65, 0x2F, 0xE1, 0x24, 0x0F, 0x21, 0x35, 0x93, 0x8E, 0xDA, 0xF0, 0x12, 0x82, 0x45,
+    0x1D, 0xB5, 0xC2, 0x7D, 0x6A, 0x27, 0xF9, 0xB9, 0xC9, 0x9A, 0x09, 0x78, 0x4D, 0xE4, 0x72, 0xA6,
+    0x06, 0xBF, 0x8B, 0x62, 0x66, 0xDD, 0x30, 0xFD, 0xE2, 0x98, 0x25, 0xB3, 0x10, 0x91, 0x22, 0x88,
+    0x36, 0xD0, 0x94, 0xCE, 0x8F, 0x96, 0xDB, 0xBD, 0xF1, 0xD2, 0x13, 0x5C, 0x83, 0x38, 0x46, 0x40,
+    0x1E, 0x42, 0xB6, 0xA3, 0xC3, 0x48, 0x7E, 0x6E, 0x6B, 0x3A, 0x28, 0x54, 0xFA, 0x85, 0xBA, 0x3D,
+    0xCA, 0x5E, 0x9B, 0x9F, 0x0A, 0x15, 0x79, 0x2B, 0x4E, 0xD4, 0xE5, 0xAC, 0x73, 0xF3, 0xA7, 0x57,
+    0x07, 0x70, 0xC0, 0xF7, 0x8C, 0x80, 0x63, 0x0D, 0x67, 0x4A, 0xDE, 0xED, 0x31, 0xC5, 0xFE, 0x18,
+    0xE3, 0xA5, 0x99, 0x77, 0x26, 0xB8, 0xB4, 0x7C, 0x11, 0x44, 0x92, 0xD9, 0x23, 0x20, 0x89, 0x2E,
+    0x37, 0x3F, 0xD1, 0x5B, 0x95, 0xBC, 0xCF, 0xCD, 0x90, 0x87, 0x97, 0xB2, 0xDC, 0xFC, 0xBE, 0x61,
+    0xF2, 0x56, 0xD3, 0xAB, 0x14, 0x2A, 0x5D, 0x9E, 0x84, 0x3C, 0x39, 0x53, 0x47, 0x6D, 0x41, 0xA2,
+    0x1F, 0x2D, 0x43, 0xD8, 0xB7, 0x7B, 0xA4, 0x76, 0xC4, 0x17, 0x49, 0xEC, 0x7F, 0x0C, 0x6F, 0xF6,
+    0x6C, 0xA1, 0x3B, 0x52, 0x29, 0x9D, 0x55, 0xAA, 0xFB, 0x60, 0x86, 0xB1, 0xBB, 0xCC, 0x3E, 0x5A,
+    0xCB, 0x59, 0x5F, 0xB0, 0x9C, 0xA9, 0xA0, 0x51, 0x0B, 0xF5, 0x16, 0xEB, 0x7A, 0x75, 0x2C, 0xD7,
+    0x4F, 0xAE, 0xD5, 0xE9, 0xE6, 0xE7, 0xAD, 0xE8, 0x74, 0xD6, 0xF4, 0xEA, 0xA8, 0x50, 0x58, 0xAF,
+};
+
+// Reed-Solomon generator polynomials (x - a^0)(x - a^1)...(x - a^(n-1)),
+// stored as logs of the coefficients below the leading x^n term
+static const uint8_t RS_GEN_7[7] = {87, 229, 146, 149, 238, 102, 21};
+static const uint8_t RS_GEN_10[10] = {251, 67, 46, 61, 118, 70, 64, 94, 32, 45};
+static const uint8_t RS_GEN_13[13] = {74, 152, 176, 100, 86, 100, 106, 104, 130, 218, 206, 140, 78};
+static const uint8_t RS_GEN_15[15] = {8, 183, 61, 91, 202, 37, 51, 58, 58, 237, 140, 124, 5, 99, 105};
+static const uint8_t RS_GEN_16[16] = {120, 104, 107, 109, 102, 161, 76, 3, 91, 191, 147, 169, 182, 194, 225, 120};
+static const uint8_t RS_GEN_17[17] = {43, 139, 206, 78, 43, 239, 123, 206, 214, 147, 24, 99, 150, 39, 243, 163, 136};
+static const uint8_t RS_GEN_18[18] = {215, 234, 158, 94, 184, 97, 118, 170, 79, 187, 152, 148, 252, 179, 5, 98, 96, 153};
+static const uint8_t RS_GEN_20[20] = {17, 60, 79, 50, 61, 163, 26, 187, 202, 180, 221, 225, 83, 239, 156, 164, 212, 212, 188, 190};
+static const uint8_t RS_GEN_22[22] = {210, 171, 247, 242, 93, 230, 14, 109, 221, 53, 200, 74, 8, 172, 98, 80, 219, 134, 160, 105, 165, 231};
+static const uint8_t RS_GEN_24[24] = {229, 121, 135, 48, 211, 117, 251, 126, 159, 180, 169, 152, 192, 226, 228, 218, 111, 0, 117, 232, 87, 96, 227, 21};
+static const uint8_t RS_GEN_26[26] = {173, 125, 158, 2, 103, 182, 118, 17, 145, 201, 111, 28, 165, 53, 161, 21, 245, 142, 13, 102, 48, 227, 153, 145, 218, 70};
+static const uint8_t RS_GEN_28[28] = {168, 223, 200, 104, 224, 234, 108, 180, 110, 190, 195, 147, 205, 27, 232, 201, 21, 43, 245, 87, 42, 195, 212, 119, 242, 37, 9, 123};
+static const uint8_t RS_GEN_30[30] = {41, 173, 145, 152, 216, 31, 179, 182, 50, 48, 110, 86, 239, 96, 222, 125, 42, 173, 226, 193, 224, 130, 156, 37, 251, 216, 238, 40, 192, 180};
+
+static const uint8_t *rs_generator(int degree)
+{
+    switch (degree) {
+        case 7:  return RS_GEN_7;
+        case 10: return RS_GEN_10;
+        case 13: return RS_GEN_13;
+        case 15: return RS_GEN_15;
+        case 16: return RS_GEN_16;
+        case 17: return RS_GEN_17;
+        case 18: return RS_GEN_18;
+        case 20: return RS_GEN_20;
+        case 22: return RS_GEN_22;
+        case 24: return RS_GEN_24;
+        case 26: return RS_GEN_26;
+        case 28: return RS_GEN_28;
+        case 30: return RS_GEN_30;
+        default: return NULL;
     }
 }
 
-static void fill_rect(int x, int y, int w, int h, bool value) {
-    for (int j = y; j < y + h; j++) {
-        for (int i = x; i < x + w; i++) {
-            set_module(i, j, value);
+// Compute the Reed-Solomon remainder of data into out (degree bytes)
+static void rs_remainder(const uint8_t *data, int len, int degree, uint8_t *out)
+{
+    const uint8_t *gen = rs_generator(degree);
+
+    memset(out, 0, degree);
+    for (int i = 0; i < len; i++) {
+        uint8_t factor = data[i] ^ out[0];
+        memmove(out, out + 1, degree - 1);
+        out[degree - 1] = 0;
+        if (factor != 0) {
+            int lf = gf_log[factor];
+            for (int j = 0; j < degree; j++) {
+                out[j] ^= gf_exp[gen[j] + lf];
+            }
         }
     }
 }
 
-// Draw finder pattern (the big squares in corners)
-static void draw_finder(int x, int y) {
-    // Outer black border
-    fill_rect(x, y, 7, 7, true);
-    // White inner border
-    fill_rect(x + 1, y + 1, 5, 5, false);
-    // Inner black square
-    fill_rect(x + 2, y + 2, 3, 3, true);
+// ==========================================================
+// Capacity
+
+static int num_raw_data_modules(int ver)
+{
+    int result = (16 * ver + 128) * ver + 64;
+    if (ver >= 2) {
+        int num_align = ver / 7 + 2;
+        result -= (25 * num_align - 10) * num_align - 55;
+        if (ver >= 7) result -= 36;
+    }
+    return result;
+}
+
+static int num_data_codewords(int ver, int ecc)
+{
+    return num_raw_data_modules(ver) / 8
+           - ECC_CODEWORDS_PER_BLOCK[ecc][ver] * NUM_ERROR_CORRECTION_BLOCKS[ecc][ver];
+}
+
+// Bits used by a byte-mode segment of len bytes
+static int segment_bits(int ver, int len)
+{
+    int count_bits = (ver <= 9) ? 8 : 16;
+    return 4 + count_bits + len * 8;
+}
+
+// ==========================================================
+// Packed matrix helpers
+
+static inline bool get_bit(const qr_row_t *m, int x, int y)
+{
+    return (m[y][x >> 5] >> (x & 31)) & 1;
+}
+
+static inline void put_bit(qr_row_t *m, int x, int y, bool value)
+{
+    uint32_t bit = 1u << (x & 31);
+    if (value) {
+        m[y][x >> 5] |= bit;
+    } else {
+        m[y][x >> 5] &= ~bit;
+    }
+}
+
+static void set_function(int x, int y, bool dark)
+{
+    put_bit(s_modules, x, y, dark);
+    put_bit(s_function, x, y, true);
+}
+
+// Row shifted towards bit 0 by k (0 < k < 32): bit x becomes module x + k
+static inline void row_shr(const uint32_t *in, int k, uint32_t *out)
+{
+    for (int w = 0; w < ROW_WORDS - 1; w++) {
+        out[w] = (in[w] >> k) | (in[w + 1] << (32 - k));
+    }
+    out[ROW_WORDS - 1] = in[ROW_WORDS - 1] >> k;
+}
+
+// Row shifted away from bit 0 by k (0 < k < 32): bit x becomes module x - k
+static inline void row_shl(const uint32_t *in, int k, uint32_t *out)
+{
+    for (int w = ROW_WORDS - 1; w > 0; w--) {
+        out[w] = (in[w] << k) | (in[w - 1] >> (32 - k));
+    }
+    out[0] = in[0] << k;
+}
+
+// Mask with bits 0..n-1 set
+static inline void row_ones(int n, uint32_t *out)
+{
+    for (int w = 0; w < ROW_WORDS; w++, n -= 32) {
+        out[w] = (n >= 32) ? ~0u : (n <= 0) ? 0 : ((1u << n) - 1);
+    }
+}
+
+// ==========================================================
+// Function patterns
+
+// Draw finder pattern (the big squares in corners) with its separator
+static void draw_finder(int cx, int cy)
+{
+    for (int dy = -4; dy <= 4; dy++) {
+        for (int dx = -4; dx <= 4; dx++) {
+            int dist = MAX_ABS(dx, dy);
+            int x = cx + dx;
+            int y = cy + dy;
+            if (x >= 0 && x < s_size && y >= 0 && y < s_size) {
+                set_function(x, y, dist != 2 && dist != 4);
+            }
+        }
+    }
 }
 
 // Draw alignment pattern
-static void draw_alignment(int x, int y) {
-    fill_rect(x - 2, y - 2, 5, 5, true);
-    fill_rect(x - 1, y - 1, 3, 3, false);
-    set_module(x, y, true);
+static void draw_alignment(int cx, int cy)
+{
+    for (int dy = -2; dy <= 2; dy++) {
+        for (int dx = -2; dx <= 2; dx++) {
+            set_function(cx + dx, cy + dy, MAX_ABS(dx, dy) != 1);
+        }
+    }
 }
 
-// Add timing patterns
-static void add_timing_patterns(void) {
-    for (int i = 8; i < MODULES_PER_SIDE - 8; i++) {
-        bool bit = (i % 2 == 0);
-        set_module(6, i, bit);
-        set_module(i, 6, bit);
+// Alignment pattern center coordinates, returns the count
+static int alignment_positions(int ver, uint8_t *pos)
+{
+    if (ver == 1) return 0;
+
+    int num_align = ver / 7 + 2;
+    int step = (ver * 8 + num_align * 3 + 5) / (num_align * 4 - 4) * 2;
+    pos[0] = 6;
+    for (int i = num_align - 1, p = s_size - 7; i >= 1; i--, p -= step) {
+        pos[i] = p;
     }
+    return num_align;
 }
 
-// Initialize QR code with fixed patterns
-static void init_qr_code(void) {
-    // Clear all modules
-    memset(qr_modules, 0, sizeof(qr_modules));
-    
-    // Draw finder patterns
-    draw_finder(0, 0);                              // Top-left
-    draw_finder(MODULES_PER_SIDE - 7, 0);           // Top-right
-    draw_finder(0, MODULES_PER_SIDE - 7);           // Bottom-left
-    
-    // Draw separators (white border around finders)
+// Draw the 15 format bits (ECC level and mask) in both copies
+static void draw_format_bits(int ecc, int mask)
+{
+    int data = ECC_FORMAT_BITS[ecc] << 3 | mask;
+    int rem = data;
+    for (int i = 0; i < 10; i++) {
+        rem = (rem << 1) ^ ((rem >> 9) * 0x537);
+    }
+    int bits = (data << 10 | rem) ^ 0x5412;
+
+    // First copy, around the top-left finder
+    for (int i = 0; i <= 5; i++) {
+        set_function(8, i, (bits >> i) & 1);
+    }
+    set_function(8, 7, (bits >> 6) & 1);
+    set_function(8, 8, (bits >> 7) & 1);
+    set_function(7, 8, (bits >> 8) & 1);
+    for (int i = 9; i < 15; i++) {
+        set_function(14 - i, 8, (bits >> i) & 1);
+    }
+
+    // Second copy, split between the other two finders
     for (int i = 0; i < 8; i++) {
-        // Top-left
-        set_module(7, i, false);
-        set_module(i, 7, false);
-        // Top-right
-        set_module(MODULES_PER_SIDE - 8, i, false);
-        set_module(MODULES_PER_SIDE - 1 - i, 7, false);
-        // Bottom-left
-        set_module(7, MODULES_PER_SIDE - 1 - i, false);
-        set_module(i, MODULES_PER_SIDE - 8, false);
+        set_function(s_size - 1 - i, 8, (bits >> i) & 1);
     }
-    
-    // Draw alignment pattern for version 8 (at position 24)
-    draw_alignment(24, 24);
-    draw_alignment(6, 24);
-    draw_alignment(24, 6);
-    
-    // Add timing patterns
-    add_timing_patterns();
-    
+    for (int i = 8; i < 15; i++) {
+        set_function(8, s_size - 15 + i, (bits >> i) & 1);
+    }
+
     // Dark module (always present)
-    set_module(8, MODULES_PER_SIDE - 8, true);
+    set_function(8, s_size - 8, true);
 }
 
-// Simple data encoding - byte mode
-static int encode_data(const char *text, uint8_t *out_data, int max_len) {
-    int len = strlen(text);
-    int idx = 0;
-    
-    // Mode indicator for byte mode (0100)
-    // Character count for version 8 is 16 bits
-    
-    if (len > 200) len = 200;  // Limit for version 8
-    
-    // Just copy the text bytes
-    for (int i = 0; i < len && idx < max_len; i++) {
-        out_data[idx++] = (uint8_t)text[i];
+// Draw the two copies of the version information (version 7 and up)
+static void draw_version(int ver)
+{
+    if (ver < 7) return;
+
+    int rem = ver;
+    for (int i = 0; i < 12; i++) {
+        rem = (rem << 1) ^ ((rem >> 11) * 0x1F25);
+    }
+    long bits = (long)ver << 12 | rem;
+
+    for (int i = 0; i < 18; i++) {
+        bool bit = (bits >> i) & 1;
+        int a = s_size - 11 + i % 3;
+        int b = i / 3;
+        set_function(a, b, bit);
+        set_function(b, a, bit);
     }
-    
-    return idx;
 }
 
-// Copy modules to output structure
-static void copy_to_output(qrcode_t *qrcode) {
-    qrcode->size = MODULES_PER_SIDE;
-    memset(qrcode->data, 0, sizeof(qrcode->data));
-    
-    for (int y = 0; y < MODULES_PER_SIDE; y++) {
-        for (int x = 0; x < MODULES_PER_SIDE; x++) {
-            if (qr_modules[y][x]) {
-                int bit_pos = y * MODULES_PER_SIDE + x;
-                int byte_pos = bit_pos / 8;
-                int bit_offset = bit_pos % 8;
-                qrcode->data[byte_pos] |= (1 << bit_offset);
+// Build the function pattern template and mask for a version
+static void build_template(int ver)
+{
+    s_modules = s_template;
+    memset(s_template, 0, sizeof(s_template));
+    memset(s_function, 0, sizeof(s_function));
+
+    // Timing patterns
+    for (int i = 0; i < s_size; i++) {
+        set_function(6, i, i % 2 == 0);
+        set_function(i, 6, i % 2 == 0);
+    }
+
+    // Finder patterns: top-left, top-right, bottom-left
+    draw_finder(3, 3);
+    draw_finder(s_size - 4, 3);
+    draw_finder(3, s_size - 4);
+
+    // Alignment patterns, except where they would overlap the finders
+    uint8_t pos[7];
+    int n = alignment_positions(ver, pos);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if ((i == 0 && j == 0) || (i == 0 && j == n - 1) || (i == n - 1 && j == 0)) {
+                continue;
             }
+            draw_alignment(pos[i], pos[j]);
         }
     }
+
+    // Reserve the format areas (real bits are drawn after masking)
+    draw_format_bits(0, 0);
+    draw_version(ver);
+
+    s_template_version = ver;
+}
+
+// ==========================================================
+// Data encoding
+
+static void append_bits(uint8_t *buf, int *bit_len, uint32_t value, int count)
+{
+    for (int i = count - 1; i >= 0; i--, (*bit_len)++) {
+        if ((value >> i) & 1) {
+            buf[*bit_len >> 3] |= 0x80 >> (*bit_len & 7);
+        }
+    }
+}
+
+// Build the data codewords: mode, length, payload, terminator and padding
+static void encode_data(const uint8_t *text, int len, int ver, int ecc)
+{
+    int capacity = num_data_codewords(ver, ecc);
+    int bit_len = 0;
+
+    memset(s_data, 0, capacity);
+    append_bits(s_data, &bit_len, 0x4, 4);  // Byte mode
+    append_bits(s_data, &bit_len, len, (ver <= 9) ? 8 : 16);
+    for (int i = 0; i < len; i++) {
+        append_bits(s_data, &bit_len, text[i], 8);
+    }
+
+    // Terminator (up to 4 zero bits), then zero bits up to a byte boundary
+    int terminator = capacity * 8 - bit_len;
+    if (terminator > 4) terminator = 4;
+    bit_len += terminator;
+    bit_len = (bit_len + 7) & ~7;
+
+    // Pad bytes alternate 0xEC, 0x11
+    for (int i = bit_len / 8, pad = 0xEC; i < capacity; i++, pad ^= 0xEC ^ 0x11) {
+        s_data[i] = pad;
+    }
 }
 
-// Place data modules
-static void place_data(const uint8_t *data, int data_len) {
+// Split data into blocks, append ECC and interleave into s_codewords
+static int add_ecc_and_interleave(int ver, int ecc)
+{
+    int num_blocks = NUM_ERROR_CORRECTION_BLOCKS[ecc][ver];
+    int block_ecc_len = ECC_CODEWORDS_PER_BLOCK[ecc][ver];
+    int raw_codewords = num_raw_data_modules(ver) / 8;
+    int num_short_blocks = num_blocks - raw_codewords % num_blocks;
+    int short_data_len = raw_codewords / num_blocks - block_ecc_len;
+
+    // Reed-Solomon per block; long blocks carry one extra data codeword
+    for (int b = 0, offset = 0; b < num_blocks; b++) {
+        int data_len = short_data_len + (b >= num_short_blocks ? 1 : 0);
+        rs_remainder(&s_data[offset], data_len, block_ecc_len, &s_ecc[b * block_ecc_len]);
+        offset += data_len;
+    }
+
+    int n = 0;
+    for (int i = 0; i <= short_data_len; i++) {
+        for (int b = 0; b < num_blocks; b++) {
+            if (i == short_data_len && b < num_short_blocks) continue;
+            int block_start = b * short_data_len + (b > num_short_blocks ? b - num_short_blocks : 0);
+            s_codewords[n++] = s_data[block_start + i];
+        }
+    }
+    for (int i = 0; i < block_ecc_len; i++) {
+        for (int b = 0; b < num_blocks; b++) {
+            s_codewords[n++] = s_ecc[b * block_ecc_len + i];
+        }
+    }
+    return n;
+}
+
+// Place codewords in the zigzag order, skipping function modules
+static void place_data(const uint8_t *data, int data_len)
+{
     int bit_idx = 0;
     int total_bits = data_len * 8;
-    
-    // Start from bottom-right, going up
-    for (int right = MODULES_PER_SIDE - 1; right >= 1; right -= 2) {
+
+    // Start from bottom-right, in two-module wide columns
+    for (int right = s_size - 1; right >= 1; right -= 2) {
         if (right == 6) right = 5;  // Skip timing pattern column
-        
-        for (int vert = 0; vert < MODULES_PER_SIDE; vert++) {
+
+        bool upward = ((right + 1) & 2) == 0;
+        for (int vert = 0; vert < s_size; vert++) {
+            int y = upward ? s_size - 1 - vert : vert;
             for (int j = 0; j < 2; j++) {
                 int x = right - j;
-                bool upward = ((right + 1) / 2) % 2 == 0;
-                int y = upward ? MODULES_PER_SIDE - 1 - vert : vert;
-                
-                // Skip if this is a function pattern
-                bool is_function = false;
-                
-                // Check finder patterns
-                if ((x < 9 && y < 9) || 
-                    (x >= MODULES_PER_SIDE - 8 && y < 9) ||
-                    (x < 9 && y >= MODULES_PER_SIDE - 8)) {
-                    is_function = true;
-                }
-                
-                // Check timing patterns
-                if (x == 6 || y == 6) is_function = true;
-                
-                // Check alignment patterns (for version 8)
-                if ((abs(x - 24) <= 2 && abs(y - 24) <= 2) ||
-                    (abs(x - 6) <= 2 && abs(y - 24) <= 2) ||
-                    (abs(x - 24) <= 2 && abs(y - 6) <= 2)) {
-                    is_function = true;
-                }
-                
-                // Check dark module
-                if (x == 8 && y == MODULES_PER_SIDE - 8) is_function = true;
-                
-                // Check format/version info areas
-                if (x < 9 && y == 8) is_function = true;
-                if (x == 8 && (y < 9 || y >= MODULES_PER_SIDE - 8)) is_function = true;
-                if (x >= MODULES_PER_SIDE - 8 && y == 8) is_function = true;
-                
-                if (!is_function && bit_idx < total_bits) {
-                    int byte_idx = bit_idx / 8;
-                    int bit_offset = 7 - (bit_idx % 8);
-                    bool bit = (data[byte_idx] >> bit_offset) & 1;
-                    set_module(x, y, bit);
+                if (!get_bit(s_function, x, y) && bit_idx < total_bits) {
+                    put_bit(s_modules, x, y, (data[bit_idx >> 3] >> (7 - (bit_idx & 7))) & 1);
                     bit_idx++;
                 }
             }
@@ -179,38 +473,267 @@ static void place_data(const uint8_t *data, int data_len) {
     }
 }
 
-bool qrcode_generate(qrcode_t *qrcode, const char *text) {
-    if (qrcode == NULL || text == NULL) return false;
-    
-    // Initialize with fixed patterns
-    init_qr_code();
-    
-    // Encode data
-    uint8_t data[256];
-    int data_len = encode_data(text, data, sizeof(data));
-    
-    // Place data modules
-    place_data(data, data_len);
-    
-    // Copy to output
-    copy_to_output(qrcode);
-    
+// ==========================================================
+// Masking
+
+static bool mask_bit(int mask, int x, int y)
+{
+    switch (mask) {
+        case 0:  return (x + y) % 2 == 0;
+        case 1:  return y % 2 == 0;
+        case 2:  return x % 3 == 0;
+        case 3:  return (x + y) % 3 == 0;
+        case 4:  return (x / 3 + y / 2) % 2 == 0;
+        case 5:  return x * y % 2 + x * y % 3 == 0;
+        case 6:  return (x * y % 2 + x * y % 3) % 2 == 0;
+        default: return ((x + y) % 2 + x * y % 3) % 2 == 0;
+    }
+}
+
+// All mask patterns repeat every 6 columns and every 12 rows, so each one
+// is expanded once into 12 packed rows
+static qr_row_t s_mask_rows[8][12];
+static bool s_mask_rows_ready = false;
+
+static void init_mask_rows(void)
+{
+    memset(s_mask_rows, 0, sizeof(s_mask_rows));
+    for (int m = 0; m < 8; m++) {
+        for (int y = 0; y < 12; y++) {
+            for (int x = 0; x < ROW_WORDS * 32; x++) {
+                if (mask_bit(m, x, y)) {
+                    s_mask_rows[m][y][x >> 5] |= 1u << (x & 31);
+                }
+            }
+        }
+    }
+    s_mask_rows_ready = true;
+}
+
+// XOR a mask pattern into all non-function modules (self-inverse)
+static void apply_mask(int mask)
+{
+    uint32_t width[ROW_WORDS];
+    row_ones(s_size, width);
+
+    for (int y = 0; y < s_size; y++) {
+        const uint32_t *pattern = s_mask_rows[mask][y % 12];
+        for (int w = 0; w < ROW_WORDS; w++) {
+            s_modules[y][w] ^= pattern[w] & ~s_function[y][w] & width[w];
+        }
+    }
+}
+
+// ==========================================================
+// Penalty scoring
+
+// Rules 1 and 3 on one packed line of n modules
+static long line_penalty(const uint32_t *line, int n)
+{
+    long score = 0;
+
+    // Rule 1: runs of 5+ same-colored modules. Bit x of diff is set where
+    // module x differs from module x + 1, plus the end of the line.
+    uint32_t shifted[ROW_WORDS], diff[ROW_WORDS], valid[ROW_WORDS];
+    row_shr(line, 1, shifted);
+    row_ones(n - 1, valid);
+    for (int w = 0; w < ROW_WORDS; w++) {
+        diff[w] = (line[w] ^ shifted[w]) & valid[w];
+    }
+    diff[(n - 1) >> 5] |= 1u << ((n - 1) & 31);
+
+    int prev = -1;
+    for (int w = 0; w < ROW_WORDS; w++) {
+        uint32_t bits = diff[w];
+        while (bits) {
+            int pos = w * 32 + __builtin_ctz(bits);
+            int run = pos - prev;
+            if (run >= 5) score += 3 + (run - 5);
+            prev = pos;
+            bits &= bits - 1;
+        }
+    }
+
+    // Rule 3: 1:1:3:1:1 finder-like pattern with 4 light modules on either
+    // side. The line is padded with 4 light modules at both ends (quiet
+    // zone) and all 11-module windows are tested in parallel.
+    static const uint16_t PATTERN_LIGHT_LEFT = 0x5D0;   // 0000 1011101, bit k = module k
+    static const uint16_t PATTERN_LIGHT_RIGHT = 0x05D;  // 1011101 0000
+    uint32_t padded[ROW_WORDS];
+    uint32_t match_left[ROW_WORDS], match_right[ROW_WORDS];
+    row_shl(line, 4, padded);
+    for (int w = 0; w < ROW_WORDS; w++) {
+        match_left[w] = ((PATTERN_LIGHT_LEFT & 1) ? padded[w] : ~padded[w]);
+        match_right[w] = ((PATTERN_LIGHT_RIGHT & 1) ? padded[w] : ~padded[w]);
+    }
+
+    for (int k = 1; k < 11; k++) {
+        uint32_t s[ROW_WORDS];
+        row_shr(padded, k, s);
+        for (int w = 0; w < ROW_WORDS; w++) {
+            match_left[w] &= ((PATTERN_LIGHT_LEFT >> k) & 1) ? s[w] : ~s[w];
+            match_right[w] &= ((PATTERN_LIGHT_RIGHT >> k) & 1) ? s[w] : ~s[w];
+        }
+    }
+
+    // Windows start at 0..n-3 in padded coordinates
+    row_ones(n - 2, valid);
+    for (int w = 0; w < ROW_WORDS; w++) {
+        score += 40 * __builtin_popcount((match_left[w] | match_right[w]) & valid[w]);
+    }
+
+    return score;
+}
+
+static void transpose_modules(void)
+{
+    memset(s_columns, 0, sizeof(s_columns));
+    for (int y = 0; y < s_size; y++) {
+        for (int w = 0; w < ROW_WORDS; w++) {
+            uint32_t bits = s_modules[y][w];
+            while (bits) {
+                int x = w * 32 + __builtin_ctz(bits);
+                s_columns[x][y >> 5] |= 1u << (y & 31);
+                bits &= bits - 1;
+            }
+        }
+    }
+}
+
+static long penalty_score(void)
+{
+    long score = 0;
+    int dark = 0;
+    uint32_t valid[ROW_WORDS];
+
+    transpose_modules();
+    for (int i = 0; i < s_size; i++) {
+        score += line_penalty(s_modules[i], s_size);
+        score += line_penalty(s_columns[i], s_size);
+    }
+
+    // Rule 2: 2x2 blocks of the same color
+    row_ones(s_size - 1, valid);
+    for (int y = 0; y < s_size - 1; y++) {
+        uint32_t a1[ROW_WORDS], b1[ROW_WORDS];
+        const uint32_t *a = s_modules[y];
+        const uint32_t *b = s_modules[y + 1];
+        row_shr(a, 1, a1);
+        row_shr(b, 1, b1);
+        for (int w = 0; w < ROW_WORDS; w++) {
+            uint32_t all_dark = a[w] & b[w] & a1[w] & b1[w];
+            uint32_t all_light = ~(a[w] | b[w] | a1[w] | b1[w]);
+            score += 3 * __builtin_popcount((all_dark | all_light) & valid[w]);
+        }
+    }
+
+    // Rule 4: balance of dark and light modules, 10 points per 5% step
+    for (int y = 0; y < s_size; y++) {
+        for (int w = 0; w < ROW_WORDS; w++) {
+            dark += __builtin_popcount(s_modules[y][w]);
+        }
+    }
+    int total = s_size * s_size;
+    int k = (abs(dark * 20 - total * 10) + total - 1) / total - 1;
+    score += k * 10;
+
+    return score;
+}
+
+/**
+ * @brief Encode text at the smallest version that fits min_ecc
+ * @param boost Raise the ECC level while the data still fits
+ * @param fixed_mask Mask to use, -1 to pick the one with the lowest penalty
+ */
+static bool generate(qrcode_t *qrcode, const char *text, qrcode_ecc_t min_ecc, bool boost,
+                     int fixed_mask)
+{
+    if (qrcode == NULL || text == NULL || min_ecc > QRCODE_ECC_HIGH) return false;
+
+    int len = strlen(text);
+
+    // Smallest version that fits at the minimum ECC level
+    int ver = 0;
+    for (int v = 1; v <= QRCODE_MAX_VERSION; v++) {
+        if (segment_bits(v, len) <= num_data_codewords(v, min_ecc) * 8) {
+            ver = v;
+            break;
+        }
+    }
+    if (ver == 0) return false;
+
+    // Raise the ECC level while the data still fits in this version
+    int ecc = min_ecc;
+    while (boost && ecc < QRCODE_ECC_HIGH && segment_bits(ver, len) <= num_data_codewords(ver, ecc + 1) * 8) {
+        ecc++;
+    }
+
+    if (!s_mask_rows_ready) {
+        init_mask_rows();
+    }
+
+    s_size = 17 + ver * 4;
+    encode_data((const uint8_t *)text, len, ver, ecc);
+    int codeword_len = add_ecc_and_interleave(ver, ecc);
+
+    // Start from the function pattern template and draw straight into the
+    // caller's rows
+    if (s_template_version != ver) {
+        build_template(ver);
+    }
+    memcpy(qrcode->rows, s_template, sizeof(qrcode->rows));
+    s_modules = qrcode->rows;
+    place_data(s_codewords, codeword_len);
+
+    // Pick the mask with the lowest penalty
+    int best_mask = fixed_mask >= 0 ? fixed_mask : 0;
+    long best_score = -1;
+    for (int m = 0; m < 8 && fixed_mask < 0; m++) {
+        apply_mask(m);
+        draw_format_bits(ecc, m);
+        long score = penalty_score();
+        if (best_score < 0 || score < best_score) {
+            best_score = score;
+            best_mask = m;
+        }
+        apply_mask(m);  // Undo
+    }
+    apply_mask(best_mask);
+    draw_format_bits(ecc, best_mask);
+
+    qrcode->version = ver;
+    qrcode->size = s_size;
+    qrcode->ecc = ecc;
+    qrcode->mask = best_mask;
+
     return true;
 }
 
+bool qrcode_generate_ecc(qrcode_t *qrcode, const char *text, qrcode_ecc_t min_ecc)
+{
+    return generate(qrcode, text, min_ecc, true, -1);
+}
+
+bool qrcode_generate_fixed(qrcode_t *qrcode, const char *text, qrcode_ecc_t ecc, uint8_t mask)
+{
+    if (mask > 7) return false;
+    return generate(qrcode, text, ecc, false, mask);
+}
+
+bool qrcode_generate(qrcode_t *qrcode, const char *text)
+{
+    return qrcode_generate_ecc(qrcode, text, QRCODE_ECC_LOW);
+}
+
 bool qrcode_get_module(const qrcode_t *qrcode, uint8_t x, uint8_t y) {
     if (qrcode == NULL || x >= qrcode->size || y >= qrcode->size) {
         return false;
     }
     
-    int bit_pos = y * qrcode->size + x;
-    int byte_pos = bit_pos / 8;
-    int bit_offset = bit_pos % 8;
-    
-    return (qrcode->data[byte_pos] >> bit_offset) & 1;
+    return (qrcode->rows[y][x >> 5] >> (x & 31)) & 1;
 }
 
 uint16_t qrcode_get_buffer_size(uint8_t version) {
     int size = 17 + version * 4;
-    return (size * size + 7) / 8;
+    return size * QRCODE_ROW_WORDS * sizeof(uint32_t);
 }
@@ -4,26 +4,74 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-// QR Code version 8 has size 49x49
-#define QRCODE_VERSION 8
-#define QRCODE_MAX_SIZE 49
+// Largest version generated: 77x77 modules, up to 520 bytes at ECC level L.
+// Bigger codes would drop below 1 pixel per module on the 128 px display.
+#define QRCODE_MAX_VERSION 15
+#define QRCODE_MAX_SIZE (17 + QRCODE_MAX_VERSION * 4)
+
+// 32-bit words per packed row. Leaves room for 8 light modules of padding
+// used when scoring masks.
+#define QRCODE_ROW_WORDS ((QRCODE_MAX_SIZE + 8 + 31) / 32)
+
+/**
+ * @brief Error correction level
+ */
+typedef enum {
+    QRCODE_ECC_LOW,       // ~7% of codewords can be restored
+    QRCODE_ECC_MEDIUM,    // ~15%
+    QRCODE_ECC_QUARTILE,  // ~25%
+    QRCODE_ECC_HIGH       // ~30%
+} qrcode_ecc_t;
 
 /**
  * @brief QR Code structure
+ *
+ * Modules are packed one bit each in rows of 32-bit words: module (x, y)
+ * is bit x % 32 of rows[y][x / 32]. Set bits are dark; bits past size are 0.
  */
 typedef struct {
+    uint8_t version;
     uint8_t size;
-    uint8_t data[QRCODE_MAX_SIZE * QRCODE_MAX_SIZE / 8 + 1];
+    uint8_t ecc;   // qrcode_ecc_t
+    uint8_t mask;
+    uint32_t rows[QRCODE_MAX_SIZE][QRCODE_ROW_WORDS];
 } qrcode_t;
 
 /**
  * @brief Generate QR code from text
+ *
+ * Encodes the text in byte mode using the smallest version that fits at
+ * ECC level L, then raises the ECC level as far as that version allows.
+ *
  * @param qrcode Pointer to QR code structure
  * @param text Text to encode
- * @return true on success
+ * @return true on success, false if the text does not fit
  */
 bool qrcode_generate(qrcode_t *qrcode, const char *text);
 
+/**
+ * @brief Generate QR code from text with a minimum ECC level
+ * @param qrcode Pointer to QR code structure
+ * @param text Text to encode
+ * @param min_ecc Lowest acceptable error correction level
+ * @return true on success, false if the text does not fit
+ */
+bool qrcode_generate_ecc(qrcode_t *qrcode, const char *text, qrcode_ecc_t min_ecc);
+
+/**
+ * @brief Generate QR code with a given ECC level and mask
+ *
+ * Neither is chosen by the encoder, so the output is the same whatever the
+ * penalty scoring does. Used to check every mask pattern.
+ *
+ * @param qrcode Pointer to QR code structure
+ * @param text Text to encode
+ * @param ecc Error correction level, kept even if a higher one would fit
+ * @param mask Mask pattern, 0 to 7
+ * @return true on success, false if the text does not fit or mask is invalid
+ */
+bool qrcode_generate_fixed(qrcode_t *qrcode, const char *text, qrcode_ecc_t ecc, uint8_t mask);
+
 /**
  * @brief Check if a module is black
  * @param qrcode Pointer to QR code structure
@@ -34,7 +82,7 @@ bool qrcode_generate(qrcode_t *qrcode, const char *text);
 bool qrcode_get_module(const qrcode_t *qrcode, uint8_t x, uint8_t y);
 
 /**
- * @brief Get buffer size needed for QR code
+ * @brief Get packed row buffer size used by a QR code version
  * @param version QR code version
  * @return Buffer size in bytes
  */
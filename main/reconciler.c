@@ -0,0 +1,332 @@
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "nvs.h"
+
+#include "reconciler.h"
+#include "net_worker.h"
+#include "wifi_manager.h"
+#include "metrics.h"
+
+static const char *TAG = "reconciler";
+
+#define RECONCILE_TASK_STACK    4096
+#define RECONCILE_TASK_PRIO     5
+
+#define RECONCILE_SLOTS         8
+// Requests queued per batch, half the network worker's queue
+#define RECONCILE_BATCH         4
+#define RECONCILE_PERIOD_MS     30000
+#define RECONCILE_DEADLINE_MS   20000
+// About ten minutes of status checks at one per period
+#define RECONCILE_MAX_ATTEMPTS  20
+
+#define NVS_NAMESPACE           "reconcile"
+#define NVS_KEY_ENTRIES         "entries"
+
+typedef enum {
+    STEP_CANCEL,                // Ask the backend to cancel
+    STEP_CHECK,                 // Cancel not possible, watch for a late payment
+} reconcile_step_t;
+
+// Stored in NVS as is; a layout change makes the old blob be ignored
+typedef struct {
+    char payment_id[64];        // Empty for a free slot
+    uint32_t seq;               // Order of arrival
+    uint8_t step;               // reconcile_step_t
+    uint8_t attempts;
+    uint8_t reserved[2];
+} reconcile_entry_t;
+
+static TaskHandle_t s_task = NULL;
+static SemaphoreHandle_t s_lock = NULL;
+static SemaphoreHandle_t s_done = NULL;     // Given once per finished request
+static reconcile_entry_t s_entries[RECONCILE_SLOTS];
+static uint32_t s_seq = 0;
+static bool s_dirty = false;
+
+static void load_entries(void)
+{
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle);
+
+    if (err != ESP_OK) {
+        return;
+    }
+
+    size_t size = sizeof(s_entries);
+    err = nvs_get_blob(nvs_handle, NVS_KEY_ENTRIES, s_entries, &size);
+    nvs_close(nvs_handle);
+
+    if (err != ESP_OK || size != sizeof(s_entries)) {
+        memset(s_entries, 0, sizeof(s_entries));
+        return;
+    }
+
+    int count = 0;
+    for (int i = 0; i < RECONCILE_SLOTS; i++) {
+        reconcile_entry_t *e = &s_entries[i];
+        e->payment_id[sizeof(e->payment_id) - 1] = '\0';
+        if (e->payment_id[0] != '\0') {
+            count++;
+            if ((int32_t)(e->seq - s_seq) > 0) {
+                s_seq = e->seq;
+            }
+        }
+    }
+    if (count > 0) {
+        ESP_LOGI(TAG, "%d abandoned charge(s) loaded from NVS", count);
+    }
+}
+
+/**
+ * @brief Write the table to NVS if it changed
+ *
+ * Runs on the reconciler task only, so reconciler_add() never waits for
+ * the flash.
+ */
+static void save_entries(void)
+{
+    reconcile_entry_t copy[RECONCILE_SLOTS];
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    bool dirty = s_dirty;
+    s_dirty = false;
+    memcpy(copy, s_entries, sizeof(copy));
+    xSemaphoreGive(s_lock);
+
+    if (!dirty) {
+        return;
+    }
+
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to open NVS: %s", esp_err_to_name(err));
+        return;
+    }
+
+    err = nvs_set_blob(nvs_handle, NVS_KEY_ENTRIES, copy, sizeof(copy));
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to save abandoned charges: %s", esp_err_to_name(err));
+    }
+
+    nvs_close(nvs_handle);
+}
+
+static reconcile_entry_t *find_entry(const char *payment_id)
+{
+    for (int i = 0; i < RECONCILE_SLOTS; i++) {
+        if (s_entries[i].payment_id[0] != '\0' &&
+            strcmp(s_entries[i].payment_id, payment_id) == 0) {
+            return &s_entries[i];
+        }
+    }
+    return NULL;
+}
+
+static void remove_entry(reconcile_entry_t *e)
+{
+    memset(e, 0, sizeof(*e));
+    s_dirty = true;
+}
+
+/**
+ * @brief Apply the result of a cancel or status check
+ *
+ * Runs on the network worker task.
+ */
+static void request_done(const net_result_t *result, void *ctx)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    reconcile_entry_t *e = find_entry(result->payment_id);
+
+    if (e != NULL) {
+        if (result->err == ESP_OK &&
+            (result->status == PAYMENT_STATUS_CANCELLED ||
+             result->status == PAYMENT_STATUS_REJECTED)) {
+            ESP_LOGI(TAG, "Charge %s settled", e->payment_id);
+            remove_entry(e);
+        } else if (result->err == ESP_OK && result->status == PAYMENT_STATUS_APPROVED) {
+            // Paid after the device gave up on it: nothing was dispensed
+            ESP_LOGW(TAG, "Charge %s was paid after it was abandoned", e->payment_id);
+            metrics_inc(METRIC_LATE_PAYMENTS);
+            remove_entry(e);
+        } else {
+            if (result->err == ESP_OK && result->type == NET_REQ_CANCEL_CHARGE) {
+                // Still pending or unknown: the backend cannot cancel it
+                e->step = STEP_CHECK;
+            }
+            if (++e->attempts >= RECONCILE_MAX_ATTEMPTS) {
+                ESP_LOGW(TAG, "Giving up on charge %s", e->payment_id);
+                remove_entry(e);
+            } else {
+                s_dirty = true;
+            }
+        }
+    }
+    xSemaphoreGive(s_lock);
+
+    xSemaphoreGive(s_done);
+}
+
+/**
+ * @brief Pick the oldest charges for the next batch
+ * @return Number of entries copied to batch
+ */
+static int pick_batch(reconcile_entry_t *batch)
+{
+    bool picked[RECONCILE_SLOTS] = {0};
+    int count = 0;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    while (count < RECONCILE_BATCH) {
+        int oldest = -1;
+        for (int i = 0; i < RECONCILE_SLOTS; i++) {
+            if (s_entries[i].payment_id[0] != '\0' && !picked[i] &&
+                (oldest < 0 || (int32_t)(s_entries[i].seq - s_entries[oldest].seq) < 0)) {
+                oldest = i;
+            }
+        }
+        if (oldest < 0) {
+            break;
+        }
+        picked[oldest] = true;
+        batch[count++] = s_entries[oldest];
+    }
+    xSemaphoreGive(s_lock);
+
+    return count;
+}
+
+/**
+ * @brief Send one batch and wait for all of its results
+ *
+ * The status checks of a batch wait in the network worker's queue
+ * together, so they share one request when the backend supports it.
+ */
+static void run_batch(void)
+{
+    reconcile_entry_t batch[RECONCILE_BATCH];
+    int count = pick_batch(batch);
+    int queued = 0;
+
+    for (int i = 0; i < count; i++) {
+        esp_err_t err;
+        if (batch[i].step == STEP_CANCEL) {
+            err = net_cancel_charge(batch[i].payment_id, NET_PRIO_BACKGROUND,
+                                    RECONCILE_DEADLINE_MS, request_done, NULL);
+        } else {
+            err = net_check_status(batch[i].payment_id, NET_PRIO_BACKGROUND,
+                                   RECONCILE_DEADLINE_MS, request_done, NULL);
+        }
+        if (err != ESP_OK) {
+            break;
+        }
+        queued++;
+    }
+
+    // Every queued request completes, at the latest when its deadline passes
+    for (int i = 0; i < queued; i++) {
+        xSemaphoreTake(s_done, portMAX_DELAY);
+    }
+}
+
+static void reconcile_task(void *arg)
+{
+    while (1) {
+        // Woken early by reconciler_add() so new charges are saved at once
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(RECONCILE_PERIOD_MS));
+        save_entries();
+
+        // Only use the link while nothing else needs it
+        if (!wifi_manager_is_connected() || net_worker_pending() > 0) {
+            continue;
+        }
+        run_batch();
+        save_entries();
+    }
+}
+
+esp_err_t reconciler_init(void)
+{
+    if (s_task != NULL) {
+        return ESP_OK;
+    }
+
+    s_lock = xSemaphoreCreateMutex();
+    s_done = xSemaphoreCreateCounting(RECONCILE_BATCH, 0);
+    if (s_lock == NULL || s_done == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    load_entries();
+
+    if (xTaskCreate(reconcile_task, "reconciler", RECONCILE_TASK_STACK, NULL,
+                    RECONCILE_TASK_PRIO, &s_task) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void reconciler_add(const char *payment_id)
+{
+    if (s_task == NULL || payment_id == NULL || payment_id[0] == '\0') {
+        return;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (find_entry(payment_id) != NULL) {
+        xSemaphoreGive(s_lock);
+        return;
+    }
+
+    reconcile_entry_t *slot = NULL;
+    for (int i = 0; i < RECONCILE_SLOTS; i++) {
+        reconcile_entry_t *e = &s_entries[i];
+        if (e->payment_id[0] == '\0') {
+            slot = e;
+            break;
+        }
+        if (slot == NULL || (int32_t)(e->seq - slot->seq) < 0) {
+            slot = e;
+        }
+    }
+    if (slot->payment_id[0] != '\0') {
+        ESP_LOGW(TAG, "Table full, dropping charge %s", slot->payment_id);
+    }
+
+    memset(slot, 0, sizeof(*slot));
+    strlcpy(slot->payment_id, payment_id, sizeof(slot->payment_id));
+    slot->seq = ++s_seq;
+    slot->step = STEP_CANCEL;
+    s_dirty = true;
+    xSemaphoreGive(s_lock);
+
+    xTaskNotifyGive(s_task);
+}
+
+int reconciler_count(void)
+{
+    int count = 0;
+
+    if (s_lock == NULL) {
+        return 0;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (int i = 0; i < RECONCILE_SLOTS; i++) {
+        if (s_entries[i].payment_id[0] != '\0') {
+            count++;
+        }
+    }
+    xSemaphoreGive(s_lock);
+
+    return count;
+}
@@ -0,0 +1,37 @@
+#ifndef RECONCILER_H
+#define RECONCILER_H
+
+#include "esp_err.h"
+
+/**
+ * @brief Start the reconciler task
+ *
+ * The reconciler settles charges that were shown or prepared but never
+ * paid on the device: it cancels them on the backend and, when the backend
+ * cannot cancel, checks their status for a while in case a payment still
+ * arrives. Requests go out in small batches at background priority while
+ * the network worker is idle. Pending charges are kept in NVS, so a reboot
+ * does not forget them.
+ *
+ * Call after the NVS flash is initialized.
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t reconciler_init(void);
+
+/**
+ * @brief Hand over an abandoned charge
+ *
+ * Does not block on the network or the flash. When the table is full the
+ * oldest charge is dropped.
+ *
+ * @param payment_id Payment ID, copied
+ */
+void reconciler_add(const char *payment_id);
+
+/**
+ * @brief Number of charges waiting to be settled
+ */
+int reconciler_count(void);
+
+#endif // RECONCILER_H
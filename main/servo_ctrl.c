@@ -19,9 +19,16 @@ static const char *TAG = "servo_ctrl";
 #define SERVO_MAX_PULSEWIDTH_US 2500
 #define SERVO_MAX_DEGREE        180
 
+#define SERVO_TASK_STACK        2048
+#define SERVO_TASK_PRIO         6
+
 static bool servo_initialized = false;
 static bool servo_attached = false;
 
+static TaskHandle_t servo_task_handle = NULL;
+static servo_done_cb_t servo_done_cb = NULL;
+static volatile bool servo_busy = false;
+
 static inline uint32_t angle_to_duty(int angle)
 {
     // Calculate pulse width for the angle
@@ -35,6 +42,20 @@ static inline uint32_t angle_to_duty(int angle)
     return (pulse_width * max_duty * SERVO_FREQ_HZ) / 1000000;
 }
 
+static void servo_task(void *arg)
+{
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        servo_dispense();
+
+        servo_busy = false;
+        if (servo_done_cb != NULL) {
+            servo_done_cb();
+        }
+    }
+}
+
 esp_err_t servo_init(void)
 {
     // Configure LEDC timer for servo
@@ -62,6 +83,8 @@ esp_err_t servo_init(void)
     servo_initialized = true;
     servo_attached = false;
 
+    xTaskCreate(servo_task, "servo", SERVO_TASK_STACK, NULL, SERVO_TASK_PRIO, &servo_task_handle);
+
     ESP_LOGI(TAG, "Servo initialized on GPIO %d", CONFIG_ESP_PIX_SERVO_GPIO);
 
     // Set initial position to 90 degrees
@@ -135,3 +158,19 @@ void servo_dispense(void)
 
     ESP_LOGI(TAG, "Dispense complete, servo stopped.");
 }
+
+esp_err_t servo_dispense_async(servo_done_cb_t done)
+{
+    if (servo_task_handle == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (servo_busy) {
+        ESP_LOGW(TAG, "Servo busy");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    servo_busy = true;
+    servo_done_cb = done;
+    xTaskNotifyGive(servo_task_handle);
+    return ESP_OK;
+}
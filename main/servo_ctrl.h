@@ -33,4 +33,16 @@ esp_err_t servo_detach(void);
  */
 void servo_dispense(void);
 
+/**
+ * @brief Callback for the end of a background dispense
+ */
+typedef void (*servo_done_cb_t)(void);
+
+/**
+ * @brief Run the dispense animation on the servo task
+ * @param done Called from the servo task when the motion finished, may be NULL
+ * @return ESP_OK if started, ESP_ERR_INVALID_STATE if a motion is running
+ */
+esp_err_t servo_dispense_async(servo_done_cb_t done);
+
 #endif // SERVO_CTRL_H
@@ -0,0 +1,67 @@
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+
+#include "telemetry.h"
+
+// Updated from several tasks; the lock only covers a few loads and stores
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static const char *s_state = "";
+
+static uint32_t s_latency[TELEMETRY_LATENCY_SAMPLES];
+static uint32_t s_latency_count = 0;  // Total recorded, the ring index wraps
+
+void telemetry_set_state(const char *name)
+{
+    portENTER_CRITICAL(&s_lock);
+    s_state = name;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void telemetry_backend_latency(uint32_t ms)
+{
+    portENTER_CRITICAL(&s_lock);
+    s_latency[s_latency_count % TELEMETRY_LATENCY_SAMPLES] = ms;
+    s_latency_count++;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+// Nearest-rank percentile of sorted samples
+static uint32_t percentile(const uint32_t *sorted, uint32_t n, uint32_t pct)
+{
+    uint32_t rank = (pct * n + 99) / 100;
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+void telemetry_get(telemetry_snapshot_t *snap)
+{
+    uint32_t samples[TELEMETRY_LATENCY_SAMPLES];
+
+    memset(snap, 0, sizeof(*snap));
+
+    portENTER_CRITICAL(&s_lock);
+    snap->state = s_state;
+    uint32_t n = s_latency_count < TELEMETRY_LATENCY_SAMPLES ? s_latency_count : TELEMETRY_LATENCY_SAMPLES;
+    memcpy(samples, s_latency, n * sizeof(uint32_t));
+    portEXIT_CRITICAL(&s_lock);
+
+    if (n == 0) {
+        return;
+    }
+
+    // Insertion sort: at most 64 samples, outside the lock
+    for (uint32_t i = 1; i < n; i++) {
+        uint32_t v = samples[i];
+        uint32_t j = i;
+        for (; j > 0 && samples[j - 1] > v; j--) {
+            samples[j] = samples[j - 1];
+        }
+        samples[j] = v;
+    }
+
+    snap->latency_samples = n;
+    snap->latency_p50_ms = percentile(samples, n, 50);
+    snap->latency_p90_ms = percentile(samples, n, 90);
+    snap->latency_p99_ms = percentile(samples, n, 99);
+    snap->latency_max_ms = samples[n - 1];
+}
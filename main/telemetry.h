@@ -0,0 +1,50 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+
+/**
+ * @brief Number of recent backend requests kept for latency percentiles
+ */
+#define TELEMETRY_LATENCY_SAMPLES 64
+
+/**
+ * @brief Application state and recent backend latencies
+ *
+ * Event counters live in metrics.h.
+ */
+typedef struct {
+    const char *state;          // Current state machine state
+    uint32_t latency_samples;   // Samples behind the percentiles
+    uint32_t latency_p50_ms;
+    uint32_t latency_p90_ms;
+    uint32_t latency_p99_ms;
+    uint32_t latency_max_ms;
+} telemetry_snapshot_t;
+
+/**
+ * @brief Record the current state machine state
+ * @param name State name; must stay valid (a string literal)
+ */
+void telemetry_set_state(const char *name);
+
+/**
+ * @brief Record how long a backend request took
+ *
+ * Long-polls are not recorded: they take as long as the backend holds
+ * them, not as long as the backend needs.
+ *
+ * @param ms Request duration in milliseconds
+ */
+void telemetry_backend_latency(uint32_t ms);
+
+/**
+ * @brief Read the state and compute latency percentiles
+ *
+ * Percentiles cover the last TELEMETRY_LATENCY_SAMPLES requests.
+ *
+ * @param snap Output snapshot
+ */
+void telemetry_get(telemetry_snapshot_t *snap);
+
+#endif // TELEMETRY_H
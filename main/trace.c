@@ -0,0 +1,186 @@
+#include <stdio.h>
+#include <stdatomic.h>
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+
+#include "trace.h"
+
+#if CONFIG_ESP_PIX_TRACE
+
+#define TRACE_EVENTS        CONFIG_ESP_PIX_TRACE_EVENTS
+
+// Output is sent in batches; one event takes well under TRACE_EVENT_MAX
+#define TRACE_BATCH_BUF     1024
+#define TRACE_EVENT_MAX     160
+
+typedef struct {
+    int64_t ts;         // esp_timer_get_time()
+    uint32_t id;        // Pairs begin and end, 0 for instants
+    uint8_t span;       // trace_span_t
+    uint8_t phase;      // Chrome trace-event phase: 'b', 'e' or 'i'
+} trace_event_t;
+
+typedef struct {
+    portMUX_TYPE lock;
+    uint32_t head;      // Events written so far; the slot is head % TRACE_EVENTS
+    trace_event_t events[TRACE_EVENTS];
+} trace_ring_t;
+
+static const char *const s_span_names[TRACE_SPAN_COUNT] = {
+    [TRACE_BUTTON] = "button",
+    [TRACE_SALE] = "sale",
+    [TRACE_CHARGE_REQUEST] = "charge_request",
+    [TRACE_QR_GENERATE] = "qr_generate",
+    [TRACE_QR_RENDER] = "qr_render",
+    [TRACE_FIRST_POLL] = "first_poll",
+    [TRACE_STATUS_POLL] = "status_poll",
+    [TRACE_APPROVAL] = "approval",
+    [TRACE_DISPENSE] = "dispense",
+};
+
+static trace_ring_t s_rings[portNUM_PROCESSORS] = {
+    [0 ... portNUM_PROCESSORS - 1] = { .lock = portMUX_INITIALIZER_UNLOCKED },
+};
+
+static atomic_uint_least32_t s_next_id = 1;
+
+static void record(trace_span_t span, uint8_t phase, uint32_t id)
+{
+    // A task moved to the other core meanwhile still writes under the lock
+    trace_ring_t *ring = &s_rings[xPortGetCoreID()];
+
+    portENTER_CRITICAL_SAFE(&ring->lock);
+    trace_event_t *e = &ring->events[ring->head % TRACE_EVENTS];
+    e->ts = esp_timer_get_time();
+    e->id = id;
+    e->span = span;
+    e->phase = phase;
+    ring->head++;
+    portEXIT_CRITICAL_SAFE(&ring->lock);
+}
+
+uint32_t trace_begin(trace_span_t span)
+{
+    uint32_t id = atomic_fetch_add_explicit(&s_next_id, 1, memory_order_relaxed);
+    record(span, 'b', id);
+    return id;
+}
+
+void trace_end(trace_span_t span, uint32_t id)
+{
+    if (id != 0) {
+        record(span, 'e', id);
+    }
+}
+
+void trace_instant(trace_span_t span)
+{
+    record(span, 'i', 0);
+}
+
+// Copy event seq out of a ring; false if it was overwritten meanwhile
+static bool read_event(trace_ring_t *ring, uint32_t seq, trace_event_t *out)
+{
+    bool valid;
+
+    portENTER_CRITICAL(&ring->lock);
+    valid = ring->head - seq <= TRACE_EVENTS;
+    if (valid) {
+        *out = ring->events[seq % TRACE_EVENTS];
+    }
+    portEXIT_CRITICAL(&ring->lock);
+    return valid;
+}
+
+static int format_event(char *buf, size_t size, const trace_event_t *e, int core)
+{
+    if (e->phase == 'i') {
+        return snprintf(buf, size,
+                        ",\n{\"name\":\"%s\",\"cat\":\"pix\",\"ph\":\"i\",\"s\":\"g\","
+                        "\"ts\":%" PRId64 ",\"pid\":1,\"tid\":%d}",
+                        s_span_names[e->span], e->ts, core);
+    }
+    return snprintf(buf, size,
+                    ",\n{\"name\":\"%s\",\"cat\":\"pix\",\"ph\":\"%c\",\"id\":%" PRIu32 ","
+                    "\"ts\":%" PRId64 ",\"pid\":1,\"tid\":%d}",
+                    s_span_names[e->span], e->phase, e->id, e->ts, core);
+}
+
+// Send the batch once the next event might not fit
+static esp_err_t make_room(trace_write_cb_t write, void *ctx, const char *buf, int *len)
+{
+    if (TRACE_BATCH_BUF - *len >= TRACE_EVENT_MAX) {
+        return ESP_OK;
+    }
+    esp_err_t err = write(ctx, buf, *len);
+    *len = 0;
+    return err;
+}
+
+esp_err_t trace_export(trace_write_cb_t write, void *ctx)
+{
+    char buf[TRACE_BATCH_BUF];
+    esp_err_t err;
+    int len = snprintf(buf, sizeof(buf),
+                       "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+                       "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+                       "\"args\":{\"name\":\"ESP-PIX\"}}");
+
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        trace_ring_t *ring = &s_rings[core];
+
+        if ((err = make_room(write, ctx, buf, &len)) != ESP_OK) {
+            return err;
+        }
+        len += snprintf(buf + len, sizeof(buf) - len,
+                        ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,"
+                        "\"args\":{\"name\":\"core %d\"}}", core, core);
+
+        // Events recorded while exporting are left for the next export
+        portENTER_CRITICAL(&ring->lock);
+        uint32_t head = ring->head;
+        portEXIT_CRITICAL(&ring->lock);
+
+        uint32_t seq = head > TRACE_EVENTS ? head - TRACE_EVENTS : 0;
+        for (; seq != head; seq++) {
+            trace_event_t e;
+            if (!read_event(ring, seq, &e)) {
+                continue;
+            }
+            if ((err = make_room(write, ctx, buf, &len)) != ESP_OK) {
+                return err;
+            }
+            len += format_event(buf + len, sizeof(buf) - len, &e, core);
+        }
+    }
+
+    if ((err = make_room(write, ctx, buf, &len)) != ESP_OK) {
+        return err;
+    }
+    len += snprintf(buf + len, sizeof(buf) - len, "\n]}\n");
+    return write(ctx, buf, len);
+}
+
+#else
+
+uint32_t trace_begin(trace_span_t span)
+{
+    return 0;
+}
+
+void trace_end(trace_span_t span, uint32_t id)
+{
+}
+
+void trace_instant(trace_span_t span)
+{
+}
+
+esp_err_t trace_export(trace_write_cb_t write, void *ctx)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif // CONFIG_ESP_PIX_TRACE
@@ -0,0 +1,75 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+/**
+ * @brief Traced steps of the payment pipeline
+ */
+typedef enum {
+    TRACE_BUTTON,           // Short press accepted (instant)
+    TRACE_SALE,             // From the button press to dispensed or cancelled
+    TRACE_CHARGE_REQUEST,   // http_create_charge()
+    TRACE_QR_GENERATE,      // qrcode_generate()
+    TRACE_QR_RENDER,        // QR code drawn on the panel
+    TRACE_FIRST_POLL,       // First status request of a payment
+    TRACE_STATUS_POLL,      // Later status requests
+    TRACE_APPROVAL,         // Approved status received (instant)
+    TRACE_DISPENSE,         // Servo cycle
+    TRACE_SPAN_COUNT
+} trace_span_t;
+
+/**
+ * @brief Record the start of a span
+ *
+ * Events go to a ring buffer of the calling core, overwriting the oldest
+ * ones once full. Safe to call from any task, timer callback or ISR.
+ * Does nothing when CONFIG_ESP_PIX_TRACE is disabled.
+ *
+ * @param span Step being started
+ * @return Id to pass to trace_end()
+ */
+uint32_t trace_begin(trace_span_t span);
+
+/**
+ * @brief Record the end of a span
+ *
+ * Begin and end may happen on different tasks and cores.
+ *
+ * @param span Step being ended
+ * @param id Value returned by trace_begin()
+ */
+void trace_end(trace_span_t span, uint32_t id);
+
+/**
+ * @brief Record an event without duration
+ * @param span Step that happened
+ */
+void trace_instant(trace_span_t span);
+
+/**
+ * @brief Output callback for trace_export()
+ * @param ctx Context passed to trace_export()
+ * @param text Text to append, not NUL-terminated
+ * @param len Length of text
+ * @return ESP_OK to continue, anything else aborts the export
+ */
+typedef esp_err_t (*trace_write_cb_t)(void *ctx, const char *text, size_t len);
+
+/**
+ * @brief Write the buffered events as Chrome trace-event JSON
+ *
+ * The output loads in chrome://tracing or Perfetto. Spans are exported as
+ * async events keyed by their id, since a span may end on another task or
+ * core than the one it started on; the tid of each event is the core that
+ * recorded it. Timestamps are esp_timer_get_time() microseconds.
+ *
+ * @param write Output callback, called with batches of events
+ * @param ctx Passed to write
+ * @return ESP_OK, or the first error returned by write
+ */
+esp_err_t trace_export(trace_write_cb_t write, void *ctx);
+
+#endif // TRACE_H
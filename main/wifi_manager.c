@@ -11,6 +11,7 @@
 #include "lwip/sys.h"
 
 #include "wifi_manager.h"
+#include "metrics.h"
 
 static const char *TAG = "wifi_manager";
 
@@ -23,12 +24,24 @@ static EventGroupHandle_t s_wifi_event_group;
 static int s_retry_num = 0;
 #define WIFI_MAXIMUM_RETRY 10
 
+// Set after the first IP, so later ones count as reconnects
+static bool s_was_connected = false;
+
+static wifi_manager_cb_t s_callback = NULL;
+
 static void event_handler(void *arg, esp_event_base_t event_base,
                           int32_t event_id, void *event_data)
 {
     if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_START) {
         esp_wifi_connect();
     } else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_DISCONNECTED) {
+        EventBits_t bits = xEventGroupClearBits(s_wifi_event_group, WIFI_CONNECTED_BIT);
+        if (bits & WIFI_CONNECTED_BIT) {
+            metrics_inc(METRIC_WIFI_DISCONNECTS);
+            if (s_callback != NULL) {
+                s_callback(false);
+            }
+        }
         if (s_retry_num < WIFI_MAXIMUM_RETRY) {
             esp_wifi_connect();
             s_retry_num++;
@@ -41,7 +54,14 @@ static void event_handler(void *arg, esp_event_base_t event_base,
         ip_event_got_ip_t *event = (ip_event_got_ip_t *)event_data;
         ESP_LOGI(TAG, "Got IP: " IPSTR, IP2STR(&event->ip_info.ip));
         s_retry_num = 0;
+        if (s_was_connected) {
+            metrics_inc(METRIC_WIFI_RECONNECTS);
+        }
+        s_was_connected = true;
         xEventGroupSetBits(s_wifi_event_group, WIFI_CONNECTED_BIT);
+        if (s_callback != NULL) {
+            s_callback(true);
+        }
     }
 }
 
@@ -97,6 +117,11 @@ esp_err_t wifi_manager_init(void)
     return ESP_OK;
 }
 
+void wifi_manager_set_callback(wifi_manager_cb_t callback)
+{
+    s_callback = callback;
+}
+
 bool wifi_manager_is_connected(void)
 {
     EventBits_t bits = xEventGroupGetBits(s_wifi_event_group);
@@ -143,3 +168,19 @@ esp_err_t wifi_manager_get_ip(char *ip_str, size_t ip_str_len)
     snprintf(ip_str, ip_str_len, IPSTR, IP2STR(&ip_info.ip));
     return ESP_OK;
 }
+
+esp_err_t wifi_manager_get_rssi(int8_t *rssi)
+{
+    if (rssi == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    wifi_ap_record_t ap_info;
+    esp_err_t err = esp_wifi_sta_get_ap_info(&ap_info);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    *rssi = ap_info.rssi;
+    return ESP_OK;
+}
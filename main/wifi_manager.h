@@ -2,14 +2,30 @@
 #define WIFI_MANAGER_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include "esp_err.h"
 
+/**
+ * @brief Callback for connection changes
+ *
+ * Runs on the default event loop task; must not block.
+ *
+ * @param connected true when an IP was obtained, false when the link dropped
+ */
+typedef void (*wifi_manager_cb_t)(bool connected);
+
 /**
  * @brief Initialize WiFi in station mode and connect
  * @return ESP_OK on success
  */
 esp_err_t wifi_manager_init(void);
 
+/**
+ * @brief Register a callback for connection changes
+ * @param callback Callback, or NULL to remove it
+ */
+void wifi_manager_set_callback(wifi_manager_cb_t callback);
+
 /**
  * @brief Check if WiFi is connected
  * @return true if connected
@@ -31,4 +47,11 @@ esp_err_t wifi_manager_wait_connected(uint32_t timeout_ms);
  */
 esp_err_t wifi_manager_get_ip(char *ip_str, size_t ip_str_len);
 
+/**
+ * @brief Get the signal strength of the connected access point
+ * @param rssi Output RSSI in dBm
+ * @return ESP_OK on success, an error if not connected
+ */
+esp_err_t wifi_manager_get_rssi(int8_t *rssi);
+
 #endif // WIFI_MANAGER_H
@@ -1,6 +1,17 @@
-from pathlib import Path
+"""Converte o logo PNG em um asset RGB565 comprimido para o display.
+
+A imagem e reduzida para no maximo --colors cores (paleta) e codificada
+linha a linha com literais, repeticoes e copias da linha de cima, no
+formato lido por main/image_codec.c. Com --colors 0 as cores RGB565 sao
+mantidas sem perda.
 
-from PIL import Image
+Uso:
+    python tools/convert_logo_rgb565.py [--colors 256]
+"""
+
+import argparse
+from collections import Counter
+from pathlib import Path
 
 # Caminhos baseados na estrutura atual do projeto
 BASE_DIR = Path(__file__).resolve().parents[1]
@@ -8,16 +19,30 @@ IMG_DIR = BASE_DIR / "main" / "images"
 
 SRC = IMG_DIR / "rapport-pix.png"
 DST_H = IMG_DIR / "rapport_pix_logo.h"
+NAME = "RAPPORT_PIX_LOGO"
 
 MAX_WIDTH = 128  # largura do display ST7735
 
+# Operacoes do formato (bits 7..6 do byte de cabecalho)
+OP_LITERAL = 0
+OP_RUN = 1
+OP_COPY = 2
+MAX_COUNT = 64 + 255
+
 
 def rgb888_to_rgb565(r: int, g: int, b: int) -> int:
     """Converte um pixel RGB888 (8 bits por canal) para RGB565 (16 bits)."""
     return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
 
 
-def main() -> None:
+def rgb565_to_rgb888(c: int) -> tuple[int, int, int]:
+    return ((c >> 11) & 0x1F) << 3, ((c >> 5) & 0x3F) << 2, (c & 0x1F) << 3
+
+
+def load_pixels() -> tuple[int, int, list[int]]:
+    """Carrega o PNG, redimensiona para MAX_WIDTH e converte para RGB565."""
+    from PIL import Image
+
     if not SRC.exists():
         raise SystemExit(f"Imagem de entrada nao encontrada: {SRC}")
 
@@ -29,30 +54,196 @@ def main() -> None:
     new_h = int(h * (new_w / w))
     img = img.resize((new_w, new_h), Image.LANCZOS)
 
-    pixels = list(img.getdata())
-
+    return new_w, new_h, [rgb888_to_rgb565(r, g, b) for r, g, b in img.getdata()]
+
+
+def median_cut(pixels: list[int], colors: int) -> tuple[list[int], list[int]]:
+    """Reduz a imagem a no maximo `colors` cores; retorna (paleta, indices)."""
+    boxes = [list(Counter(pixels).items())]
+
+    def spread(box, ch):
+        values = [rgb565_to_rgb888(c)[ch] for c, _ in box]
+        return max(values) - min(values)
+
+    while len(boxes) < colors:
+        # Divide a caixa com maior faixa de cor, ponderada pelo numero de pixels
+        candidates = [b for b in boxes if len(b) > 1]
+        if not candidates:
+            break
+        box = max(candidates, key=lambda b: max(spread(b, ch) for ch in range(3)) * sum(n for _, n in b))
+        boxes.remove(box)
+
+        ch = max(range(3), key=lambda k: spread(box, k))
+        box.sort(key=lambda e: rgb565_to_rgb888(e[0])[ch])
+        total = sum(n for _, n in box)
+        acc = 0
+        for split, (_, n) in enumerate(box, 1):
+            acc += n
+            if acc * 2 >= total:
+                break
+        split = min(split, len(box) - 1)
+        boxes += [box[:split], box[split:]]
+
+    palette = []
+    mapping = {}
+    for box in boxes:
+        total = sum(n for _, n in box)
+        avg = [sum(rgb565_to_rgb888(c)[ch] * n for c, n in box) // total for ch in range(3)]
+        for c, _ in box:
+            mapping[c] = len(palette)
+        palette.append(rgb888_to_rgb565(*avg))
+
+    return palette, [mapping[p] for p in pixels]
+
+
+def encode(values: list[int], width: int, height: int, value_bytes: int) -> bytes:
+    """Codifica as linhas em operacoes de literal, repeticao e copia."""
+    out = bytearray()
+
+    def emit(op: int, count: int, payload: list[int]) -> None:
+        if count <= 63:
+            out.append(op << 6 | (count - 1))
+        else:
+            out.append(op << 6 | 63)
+            out.append(count - 64)
+        for v in payload:
+            out.extend(v.to_bytes(value_bytes, "big"))
+
+    for y in range(height):
+        row = values[y * width:(y + 1) * width]
+        above = values[(y - 1) * width:y * width] if y > 0 else None
+        literal = []
+
+        def flush() -> None:
+            while literal:
+                n = min(len(literal), MAX_COUNT)
+                emit(OP_LITERAL, n, literal[:n])
+                del literal[:n]
+
+        x = 0
+        while x < width:
+            run = 1
+            while x + run < width and run < MAX_COUNT and row[x + run] == row[x]:
+                run += 1
+            copy = 0
+            if above is not None:
+                while x + copy < width and copy < MAX_COUNT and row[x + copy] == above[x + copy]:
+                    copy += 1
+
+            if copy >= 2 and copy >= run:
+                flush()
+                emit(OP_COPY, copy, [])
+                x += copy
+            elif run >= 2:
+                flush()
+                emit(OP_RUN, run, [row[x]])
+                x += run
+            else:
+                literal.append(row[x])
+                x += 1
+        flush()
+
+    return bytes(out)
+
+
+def decode(data: bytes, width: int, height: int, value_bytes: int) -> list[int]:
+    """Decodificador de referencia, usado para validar a saida."""
+    values = []
+    pos = 0
+
+    def value() -> int:
+        nonlocal pos
+        v = int.from_bytes(data[pos:pos + value_bytes], "big")
+        pos += value_bytes
+        return v
+
+    for y in range(height):
+        row = []
+        while len(row) < width:
+            op, count = data[pos] >> 6, (data[pos] & 0x3F) + 1
+            pos += 1
+            if count == 64:
+                count += data[pos]
+                pos += 1
+            if op == OP_LITERAL:
+                row += [value() for _ in range(count)]
+            elif op == OP_RUN:
+                row += [value()] * count
+            else:
+                row += values[(y - 1) * width + len(row):(y - 1) * width + len(row) + count]
+        values += row
+
+    return values
+
+
+def write_header(width: int, height: int, palette: list[int], data: bytes) -> None:
     DST_H.parent.mkdir(parents=True, exist_ok=True)
 
     with DST_H.open("w", encoding="utf-8") as f:
-        f.write("// Generated from rapport-pix.png\n")
-        f.write("#ifndef RAPPORT_PIX_LOGO_H\n#define RAPPORT_PIX_LOGO_H\n\n")
-        f.write("#include <stdint.h>\n\n")
-        f.write(f"#define RAPPORT_PIX_LOGO_WIDTH  {new_w}\n")
-        f.write(f"#define RAPPORT_PIX_LOGO_HEIGHT {new_h}\n\n")
-        f.write("static const uint16_t RAPPORT_PIX_LOGO_DATA[] = {\n")
-
-        for i, (r, g, b) in enumerate(pixels):
-            color = rgb888_to_rgb565(r, g, b)
-            if i % 12 == 0:
-                f.write("    ")
-            f.write(f"0x{color:04X}, ")
-            if i % 12 == 11:
-                f.write("\n")
-
-        f.write("\n};\n\n#endif // RAPPORT_PIX_LOGO_H\n")
-
-    print(f"Logo convertido com sucesso para RGB565: {DST_H}")
-    print(f"Dimensoes: {new_w}x{new_h}")
+        f.write(f"// Generated from {SRC.name} by tools/{Path(__file__).name}\n")
+        f.write(f"#ifndef {NAME}_H\n#define {NAME}_H\n\n")
+        f.write('#include "image_codec.h"\n\n')
+        f.write(f"#define {NAME}_WIDTH  {width}\n")
+        f.write(f"#define {NAME}_HEIGHT {height}\n\n")
+
+        if palette:
+            f.write(f"static const uint16_t {NAME}_PALETTE[] = {{\n")
+            for i in range(0, len(palette), 12):
+                f.write("    " + ", ".join(f"0x{c:04X}" for c in palette[i:i + 12]) + ",\n")
+            f.write("};\n\n")
+
+        f.write(f"static const uint8_t {NAME}_DATA[] = {{\n")
+        for i in range(0, len(data), 16):
+            f.write("    " + ", ".join(f"0x{b:02X}" for b in data[i:i + 16]) + ",\n")
+        f.write("};\n\n")
+
+        f.write(f"static const image_t {NAME} = {{\n")
+        f.write(f"    .width = {NAME}_WIDTH,\n")
+        f.write(f"    .height = {NAME}_HEIGHT,\n")
+        if palette:
+            f.write("    .format = IMAGE_FORMAT_INDEXED8,\n")
+            f.write(f"    .palette_size = {len(palette)},\n")
+            f.write(f"    .palette = {NAME}_PALETTE,\n")
+        else:
+            f.write("    .format = IMAGE_FORMAT_RGB565,\n")
+        f.write(f"    .data = {NAME}_DATA,\n")
+        f.write(f"    .data_size = sizeof({NAME}_DATA),\n")
+        f.write("};\n\n")
+        f.write(f"#endif // {NAME}_H\n")
+
+
+def convert(width: int, height: int, pixels: list[int], colors: int) -> None:
+    if colors > 0:
+        palette, values = median_cut(pixels, colors)
+        value_bytes = 1
+    else:
+        palette, values = [], pixels
+        value_bytes = 2
+
+    data = encode(values, width, height, value_bytes)
+    if decode(data, width, height, value_bytes) != values:
+        raise SystemExit("Erro interno: a decodificacao nao confere com a imagem")
+
+    write_header(width, height, palette, data)
+
+    raw = width * height * 2
+    stored = len(data) + len(palette) * 2
+    print(f"Logo convertido com sucesso: {DST_H}")
+    print(f"Dimensoes: {width}x{height}, {len(set(pixels))} cores -> "
+          f"{len(palette) if palette else 'RGB565 sem perda'}")
+    print(f"Tamanho: {stored} bytes (dados {len(data)}, paleta {len(palette) * 2}) "
+          f"de {raw} bytes em RGB565 puro, taxa {raw / stored:.2f}x")
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Converte o logo para o display")
+    parser.add_argument("--colors", type=int, default=256,
+                        help="maximo de cores da paleta (1..256), 0 = RGB565 sem perda")
+    args = parser.parse_args()
+    if not 0 <= args.colors <= 256:
+        raise SystemExit("--colors deve estar entre 0 e 256")
+
+    convert(*load_pixels(), args.colors)
 
 
 if __name__ == "__main__":
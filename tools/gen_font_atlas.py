@@ -0,0 +1,427 @@
+"""Gera o atlas de glifos (fonte bitmap) usado pelo driver do display.
+
+Por padrao gera a fonte 5x7 embutida, cobrindo todos os caracteres
+imprimiveis de ASCII e Latin-1 (U+0020..U+007E e U+00A0..U+00FF). As letras acentuadas sao compostas a partir da letra base
+e do acento, e alguns simbolos sao desenhados a mao.
+
+Com --ttf, rasteriza uma fonte TrueType (requer Pillow), com larguras
+proporcionais e, com --bpp 2, 4 niveis de antialiasing.
+
+Uso:
+    python tools/gen_font_atlas.py
+    python tools/gen_font_atlas.py --ttf DejaVuSans.ttf --px 10 --bpp 2 \
+        --name font_dejavu_10 --proportional
+"""
+
+import argparse
+from pathlib import Path
+
+# Caminhos baseados na estrutura atual do projeto
+BASE_DIR = Path(__file__).resolve().parents[1]
+FONT_DIR = BASE_DIR / "main" / "fonts"
+
+FIRST_CP = 0x20
+LAST_CP = 0xFF
+REPLACEMENT = "?"
+
+# Fonte 5x7 original (ASCII 32..122), uma coluna por byte, bit 0 = linha de cima
+ASCII_5X7 = [
+    0x00, 0x00, 0x00, 0x00, 0x00,  # ' '
+    0x00, 0x00, 0x5F, 0x00, 0x00,  # '!'
+    0x00, 0x07, 0x00, 0x07, 0x00,  # '"'
+    0x14, 0x7F, 0x14, 0x7F, 0x14,  # '#'
+    0x24, 0x2A, 0x7F, 0x2A, 0x12,  # '$'
+    0x23, 0x13, 0x08, 0x64, 0x62,  # '%'
+    0x36, 0x49, 0x55, 0x22, 0x50,  # '&'
+    0x00, 0x05, 0x03, 0x00, 0x00,  # "'"
+    0x00, 0x1C, 0x22, 0x41, 0x00,  # '('
+    0x00, 0x41, 0x22, 0x1C, 0x00,  # ')'
+    0x08, 0x2A, 0x1C, 0x2A, 0x08,  # '*'
+    0x08, 0x08, 0x3E, 0x08, 0x08,  # '+'
+    0x00, 0x50, 0x30, 0x00, 0x00,  # ','
+    0x08, 0x08, 0x08, 0x08, 0x08,  # '-'
+    0x00, 0x60, 0x60, 0x00, 0x00,  # '.'
+    0x20, 0x10, 0x08, 0x04, 0x02,  # '/'
+    0x3E, 0x51, 0x49, 0x45, 0x3E,  # '0'
+    0x00, 0x42, 0x7F, 0x40, 0x00,  # '1'
+    0x42, 0x61, 0x51, 0x49, 0x46,  # '2'
+    0x21, 0x41, 0x45, 0x4B, 0x31,  # '3'
+    0x18, 0x14, 0x12, 0x7F, 0x10,  # '4'
+    0x27, 0x45, 0x45, 0x45, 0x39,  # '5'
+    0x3C, 0x4A, 0x49, 0x49, 0x30,  # '6'
+    0x01, 0x71, 0x09, 0x05, 0x03,  # '7'
+    0x36, 0x49, 0x49, 0x49, 0x36,  # '8'
+    0x06, 0x49, 0x49, 0x29, 0x1E,  # '9'
+    0x00, 0x36, 0x36, 0x00, 0x00,  # ':'
+    0x00, 0x56, 0x36, 0x00, 0x00,  # ';'
+    0x00, 0x08, 0x14, 0x22, 0x41,  # '<'
+    0x14, 0x14, 0x14, 0x14, 0x14,  # '='
+    0x41, 0x22, 0x14, 0x08, 0x00,  # '>'
+    0x02, 0x01, 0x51, 0x09, 0x06,  # '?'
+    0x32, 0x49, 0x79, 0x41, 0x3E,  # '@'
+    0x7E, 0x11, 0x11, 0x11, 0x7E,  # 'A'
+    0x7F, 0x49, 0x49, 0x49, 0x36,  # 'B'
+    0x3E, 0x41, 0x41, 0x41, 0x22,  # 'C'
+    0x7F, 0x41, 0x41, 0x22, 0x1C,  # 'D'
+    0x7F, 0x49, 0x49, 0x49, 0x41,  # 'E'
+    0x7F, 0x09, 0x09, 0x01, 0x01,  # 'F'
+    0x3E, 0x41, 0x41, 0x51, 0x32,  # 'G'
+    0x7F, 0x08, 0x08, 0x08, 0x7F,  # 'H'
+    0x00, 0x41, 0x7F, 0x41, 0x00,  # 'I'
+    0x20, 0x40, 0x41, 0x3F, 0x01,  # 'J'
+    0x7F, 0x08, 0x14, 0x22, 0x41,  # 'K'
+    0x7F, 0x40, 0x40, 0x40, 0x40,  # 'L'
+    0x7F, 0x02, 0x04, 0x02, 0x7F,  # 'M'
+    0x7F, 0x04, 0x08, 0x10, 0x7F,  # 'N'
+    0x3E, 0x41, 0x41, 0x41, 0x3E,  # 'O'
+    0x7F, 0x09, 0x09, 0x09, 0x06,  # 'P'
+    0x3E, 0x41, 0x51, 0x21, 0x5E,  # 'Q'
+    0x7F, 0x09, 0x19, 0x29, 0x46,  # 'R'
+    0x46, 0x49, 0x49, 0x49, 0x31,  # 'S'
+    0x01, 0x01, 0x7F, 0x01, 0x01,  # 'T'
+    0x3F, 0x40, 0x40, 0x40, 0x3F,  # 'U'
+    0x1F, 0x20, 0x40, 0x20, 0x1F,  # 'V'
+    0x7F, 0x20, 0x18, 0x20, 0x7F,  # 'W'
+    0x63, 0x14, 0x08, 0x14, 0x63,  # 'X'
+    0x03, 0x04, 0x78, 0x04, 0x03,  # 'Y'
+    0x61, 0x51, 0x49, 0x45, 0x43,  # 'Z'
+    0x00, 0x00, 0x7F, 0x41, 0x41,  # '['
+    0x02, 0x04, 0x08, 0x10, 0x20,  # '\\'
+    0x41, 0x41, 0x7F, 0x00, 0x00,  # ']'
+    0x04, 0x02, 0x01, 0x02, 0x04,  # '^'
+    0x40, 0x40, 0x40, 0x40, 0x40,  # '_'
+    0x00, 0x01, 0x02, 0x04, 0x00,  # '`'
+    0x20, 0x54, 0x54, 0x54, 0x78,  # 'a'
+    0x7F, 0x48, 0x44, 0x44, 0x38,  # 'b'
+    0x38, 0x44, 0x44, 0x44, 0x20,  # 'c'
+    0x38, 0x44, 0x44, 0x48, 0x7F,  # 'd'
+    0x38, 0x54, 0x54, 0x54, 0x18,  # 'e'
+    0x08, 0x7E, 0x09, 0x01, 0x02,  # 'f'
+    0x08, 0x14, 0x54, 0x54, 0x3C,  # 'g'
+    0x7F, 0x08, 0x04, 0x04, 0x78,  # 'h'
+    0x00, 0x44, 0x7D, 0x40, 0x00,  # 'i'
+    0x20, 0x40, 0x44, 0x3D, 0x00,  # 'j'
+    0x00, 0x7F, 0x10, 0x28, 0x44,  # 'k'
+    0x00, 0x41, 0x7F, 0x40, 0x00,  # 'l'
+    0x7C, 0x04, 0x18, 0x04, 0x78,  # 'm'
+    0x7C, 0x08, 0x04, 0x04, 0x78,  # 'n'
+    0x38, 0x44, 0x44, 0x44, 0x38,  # 'o'
+    0x7C, 0x14, 0x14, 0x14, 0x08,  # 'p'
+    0x08, 0x14, 0x14, 0x18, 0x7C,  # 'q'
+    0x7C, 0x08, 0x04, 0x04, 0x08,  # 'r'
+    0x48, 0x54, 0x54, 0x54, 0x20,  # 's'
+    0x04, 0x3F, 0x44, 0x40, 0x20,  # 't'
+    0x3C, 0x40, 0x40, 0x20, 0x7C,  # 'u'
+    0x1C, 0x20, 0x40, 0x20, 0x1C,  # 'v'
+    0x3C, 0x40, 0x30, 0x40, 0x3C,  # 'w'
+    0x44, 0x28, 0x10, 0x28, 0x44,  # 'x'
+    0x0C, 0x50, 0x50, 0x50, 0x3C,  # 'y'
+    0x44, 0x64, 0x54, 0x4C, 0x44,  # 'z'
+]
+
+# Glifos desenhados a mao: 8 linhas, '#' = pixel aceso
+HAND_GLYPHS = {
+    "{": ["..#..", ".#...", ".#...", "#....", ".#...", ".#...", "..#..", "....."],
+    "|": ["..#..", "..#..", "..#..", "..#..", "..#..", "..#..", "..#..", "....."],
+    "}": ["..#..", "...#.", "...#.", "....#", "...#.", "...#.", "..#..", "....."],
+    "~": [".....", ".....", ".#...", "#.#.#", "...#.", ".....", ".....", "....."],
+    " ": [".....", ".....", ".....", ".....", ".....", ".....", ".....", "....."],
+    "¡": ["..#..", ".....", "..#..", "..#..", "..#..", "..#..", "..#..", "....."],
+    "¢": ["..#..", ".####", "#.#..", "#.#..", "#.#..", ".####", "..#..", "....."],
+    "£": ["..##.", ".#..#", ".#...", "###..", ".#...", ".#..#", "#.##.", "....."],
+    "¤": [".....", "#...#", ".###.", ".#.#.", ".###.", "#...#", ".....", "....."],
+    "¥": ["#...#", ".#.#.", "#####", "..#..", "#####", "..#..", "..#..", "....."],
+    "¦": ["..#..", "..#..", "..#..", ".....", "..#..", "..#..", "..#..", "....."],
+    "§": [".###.", "#....", ".##..", "#..#.", ".##..", "...#.", "###..", "....."],
+    "¨": [".#.#.", ".....", ".....", ".....", ".....", ".....", ".....", "....."],
+    "©": [".###.", "#...#", "#.###", "#.#.#", "#.###", "#...#", ".###.", "....."],
+    "ª": [".##..", "...#.", ".###.", "#..#.", ".###.", ".....", "####.", "....."],
+    "«": [".....", "..#.#", ".#.#.", "#.#..", ".#.#.", "..#.#", ".....", "....."],
+    "¬": [".....", ".....", ".....", "#####", "....#", ".....", ".....", "....."],
+    "\u00ad": [".....", ".....", ".....", ".###.", ".....", ".....", ".....", "....."],
+    "®": [".###.", "#...#", "###.#", "###.#", "##.##", "#...#", ".###.", "....."],
+    "¯": ["#####", ".....", ".....", ".....", ".....", ".....", ".....", "....."],
+    "°": [".##..", "#..#.", "#..#.", ".##..", ".....", ".....", ".....", "....."],
+    "±": ["..#..", "..#..", "#####", "..#..", "..#..", ".....", "#####", "....."],
+    "²": ["##...", "..#..", ".#...", "###..", ".....", ".....", ".....", "....."],
+    "³": ["##...", ".##..", "..#..", "##...", ".....", ".....", ".....", "....."],
+    "´": ["...#.", "..#..", ".....", ".....", ".....", ".....", ".....", "....."],
+    "µ": [".....", ".....", "#...#", "#...#", "#...#", "##.##", "#.##.", "#...."],
+    "¶": [".####", "###.#", "###.#", ".##.#", "..#.#", "..#.#", "..#.#", "....."],
+    "·": [".....", ".....", ".....", "..#..", ".....", ".....", ".....", "....."],
+    "¸": [".....", ".....", ".....", ".....", ".....", ".....", "..#..", ".##.."],
+    "¹": [".#...", "##...", ".#...", "###..", ".....", ".....", ".....", "....."],
+    "º": [".##..", "#..#.", "#..#.", ".##..", ".....", "####.", ".....", "....."],
+    "»": [".....", "#.#..", ".#.#.", "..#.#", ".#.#.", "#.#..", ".....", "....."],
+    "¼": ["#....", "#...#", "#..#.", "..#..", ".#.#.", "#.###", "....#", "....."],
+    "½": ["#....", "#...#", "#..#.", "..#..", ".#.##", "#...#", "...##", "....."],
+    "¾": ["##...", ".#..#", "##.#.", "..#..", ".#.#.", "#.###", "....#", "....."],
+    "¿": ["..#..", ".....", "..#..", ".#...", "#....", "#...#", ".###.", "....."],
+    "Æ": [".####", "#.#..", "#.#..", "#####", "#.#..", "#.#..", "#.###", "....."],
+    "Ð": ["###..", "#..#.", "#...#", "###.#", "#...#", "#..#.", "###..", "....."],
+    "×": [".....", "#...#", ".#.#.", "..#..", ".#.#.", "#...#", ".....", "....."],
+    "Ø": [".###.", "#..##", "#.#.#", "#.#.#", "#.#.#", "##..#", ".###.", "....."],
+    "Þ": ["#....", "####.", "#...#", "#...#", "####.", "#....", "#....", "....."],
+    "ß": [".##..", "#..#.", "#..#.", "#.#..", "#..#.", "#..#.", "#.##.", "....."],
+    "æ": [".....", ".....", "##.#.", "..#.#", ".####", "#.#..", ".#.##", "....."],
+    "ð": ["#.#..", ".#...", "#.#..", ".###.", "#...#", "#...#", ".###.", "....."],
+    "÷": [".....", "..#..", ".....", "#####", ".....", "..#..", ".....", "....."],
+    "ø": [".....", ".....", ".####", "#..##", "#.#.#", "##..#", "####.", "....."],
+    "þ": [".....", "#....", "####.", "#...#", "#...#", "####.", "#....", "#...."],
+}
+
+# Acentos em 2 linhas (linhas 0 e 1), 5 colunas
+ACCENTS = {
+    "grave": [".#...", "..#.."],
+    "acute": ["...#.", "..#.."],
+    "circumflex": ["..#..", ".#.#."],
+    "tilde": [".##.#", "#.##."],
+    "diaeresis": [".#.#.", "....."],
+    "ring": [".###.", ".#.#."],
+}
+
+# Letras Latin-1 compostas: caractere -> (letra base, acento)
+COMPOSED = {}
+for base, marks in {
+    "A": "ÀÁÂÃÄÅ",
+    "a": "àáâãäå",
+    "O": "ÒÓÔÕÖ",
+    "o": "òóôõö",
+}.items():
+    for ch, accent in zip(marks, ["grave", "acute", "circumflex", "tilde", "diaeresis", "ring"]):
+        COMPOSED[ch] = (base, accent)
+for base, marks in {
+    "E": "ÈÉÊË",
+    "e": "èéêë",
+    "I": "ÌÍÎÏ",
+    "i": "ìíîï",
+    "U": "ÙÚÛÜ",
+    "u": "ùúûü",
+}.items():
+    for ch, accent in zip(marks, ["grave", "acute", "circumflex", "diaeresis"]):
+        COMPOSED[ch] = (base, accent)
+COMPOSED.update({
+    "Ñ": ("N", "tilde"),
+    "ñ": ("n", "tilde"),
+    "Ý": ("Y", "acute"),
+    "ý": ("y", "acute"),
+    "ÿ": ("y", "diaeresis"),
+    "Ç": ("C", "cedilla"),
+    "ç": ("c", "cedilla"),
+})
+
+
+def columns_to_rows(cols: list[int]) -> list[list[int]]:
+    """Converte colunas (bit 0 = linha de cima) em matriz [linha][coluna]."""
+    return [[(c >> y) & 1 for c in cols] for y in range(8)]
+
+
+def parse_rows(rows: list[str]) -> list[list[int]]:
+    return [[1 if ch == "#" else 0 for ch in row] for row in rows]
+
+
+def ascii_glyph(ch: str) -> list[list[int]]:
+    if ch in HAND_GLYPHS:
+        return parse_rows(HAND_GLYPHS[ch])
+    i = (ord(ch) - 0x20) * 5
+    return columns_to_rows(ASCII_5X7[i:i + 5])
+
+
+def squash_capital(rows: list[list[int]]) -> list[list[int]]:
+    """Reduz uma maiuscula de 7 para 5 linhas, abrindo espaco para o acento.
+
+    Remove de preferencia linhas internas repetidas, que quase nao mudam a
+    forma da letra.
+    """
+    body = [r[:] for r in rows[:7]]
+    while len(body) > 5:
+        for i in range(1, len(body) - 1):
+            if body[i] == body[i + 1] or body[i] == body[i - 1]:
+                del body[i]
+                break
+        else:
+            del body[len(body) // 2]
+    return body
+
+
+def compose(base: str, accent: str) -> list[list[int]]:
+    rows = ascii_glyph(base)
+
+    if accent == "cedilla":
+        # Cedilha na linha 7, abaixo da letra
+        rows[7] = [0, 0, 1, 1, 0]
+        return rows
+
+    if base.isupper():
+        body = squash_capital(rows)
+    else:
+        # Minusculas ocupam as linhas 2..6; descarta o pingo do i
+        body = rows[2:7]
+
+    return parse_rows(ACCENTS[accent]) + body + [rows[7]]
+
+
+def builtin_glyph(ch: str) -> list[list[int]] | None:
+    """Glifo da fonte 5x7 embutida, ou None se nao houver."""
+    if ch in COMPOSED:
+        return compose(*COMPOSED[ch])
+    if ch in HAND_GLYPHS or 0x20 <= ord(ch) < 0x20 + len(ASCII_5X7) // 5:
+        return ascii_glyph(ch)
+    return None
+
+
+def trim(rows: list[list[int]]) -> tuple[list[list[int]], int]:
+    """Remove colunas vazias a esquerda e a direita (largura proporcional)."""
+    width = len(rows[0])
+    used = [x for x in range(width) if any(r[x] for r in rows)]
+    if not used:
+        # Espacos mantem metade da largura
+        w = max(1, width // 2)
+        return [r[:w] for r in rows], w
+    lo, hi = used[0], used[-1] + 1
+    return [r[lo:hi] for r in rows], hi - lo
+
+
+def ttf_glyphs(path: str, px: int, bpp: int):
+    """Rasteriza uma fonte TrueType com Pillow; retorna (altura, glifos)."""
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        raise SystemExit("Pillow nao instalado: pip install pillow")
+
+    font = ImageFont.truetype(path, px)
+    ascent, descent = font.getmetrics()
+    height = ascent + descent
+    levels = (1 << bpp) - 1
+    glyphs = {}
+
+    for cp in range(FIRST_CP, LAST_CP + 1):
+        ch = chr(cp)
+        if font.getmask(ch).getbbox() is None and not ch.isspace():
+            continue
+        width = max(1, int(round(font.getlength(ch))))
+        img = Image.new("L", (width, height), 0)
+        ImageDraw.Draw(img).text((0, 0), ch, font=font, fill=255)
+        rows = [[(img.getpixel((x, y)) * levels + 127) // 255 for x in range(width)]
+                for y in range(height)]
+        glyphs[ch] = rows
+
+    return height, glyphs
+
+
+def encode_columns(rows: list[list[int]], bpp: int) -> list[int]:
+    """Codifica as colunas do glifo: bit (y * bpp) = linha y, LSB primeiro."""
+    height = len(rows)
+    col_bytes = (height * bpp + 7) // 8
+    out = []
+    for x in range(len(rows[0]) if rows else 0):
+        value = 0
+        for y in range(height):
+            value |= rows[y][x] << (y * bpp)
+        out.extend((value >> (8 * i)) & 0xFF for i in range(col_bytes))
+    return out
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Gera atlas de glifos para o display")
+    parser.add_argument("--ttf", help="fonte TrueType de origem (padrao: fonte 5x7 embutida)")
+    parser.add_argument("--px", type=int, default=8, help="tamanho da fonte TrueType em pixels")
+    parser.add_argument("--bpp", type=int, choices=(1, 2), default=1, help="bits por pixel")
+    parser.add_argument("--proportional", action="store_true", help="larguras proporcionais")
+    parser.add_argument("--spacing", type=int, default=1, help="colunas entre glifos")
+    parser.add_argument("--name", default="font_5x7_latin1", help="nome do atlas gerado")
+    args = parser.parse_args()
+
+    if args.ttf:
+        height, glyphs = ttf_glyphs(args.ttf, args.px, args.bpp)
+        source = Path(args.ttf).name
+    else:
+        if args.bpp != 1:
+            raise SystemExit("A fonte embutida e 1 bpp; use --ttf para antialiasing")
+        height = 8
+        glyphs = {}
+        for cp in range(FIRST_CP, LAST_CP + 1):
+            rows = builtin_glyph(chr(cp))
+            if rows is not None:
+                glyphs[chr(cp)] = rows
+        # Todo caractere imprimivel tem glifo; so os controles C1 ficam sem
+        missing = [f"U+{cp:04X}" for cp in range(FIRST_CP, LAST_CP + 1)
+                   if not 0x7F <= cp < 0xA0 and chr(cp) not in glyphs]
+        if missing:
+            raise SystemExit("Fonte embutida sem glifo para " + ", ".join(missing))
+        source = "the built-in 5x7 font"
+
+    if REPLACEMENT not in glyphs:
+        raise SystemExit(f"Fonte sem o glifo de substituicao {REPLACEMENT!r}")
+
+    # Glifo 0 e o de substituicao, usado para code points sem glifo
+    order = [REPLACEMENT] + [chr(cp) for cp in range(FIRST_CP, LAST_CP + 1)
+                             if chr(cp) in glyphs and chr(cp) != REPLACEMENT]
+    if len(order) > 256:
+        raise SystemExit("Mais de 256 glifos nao cabem no indice de 8 bits")
+
+    bitmap = []
+    table = []
+    for ch in order:
+        rows = glyphs[ch]
+        if args.proportional:
+            rows, width = trim(rows)
+        else:
+            width = len(rows[0])
+        table.append((len(bitmap), width, ch))
+        bitmap.extend(encode_columns(rows, args.bpp))
+
+    if len(bitmap) > 0xFFFF:
+        raise SystemExit("Bitmap maior que 64 KB")
+
+    index = [order.index(chr(cp)) if chr(cp) in glyphs else 0
+             for cp in range(FIRST_CP, LAST_CP + 1)]
+    max_width = max(w for _, w, _ in table)
+
+    name = args.name
+    upper = name.upper()
+    dst = FONT_DIR / f"{name}.h"
+    dst.parent.mkdir(parents=True, exist_ok=True)
+
+    with dst.open("w", encoding="utf-8") as f:
+        f.write(f"// Generated by tools/gen_font_atlas.py from {source}\n")
+        f.write(f"#ifndef {upper}_H\n#define {upper}_H\n\n")
+        f.write('#include "font.h"\n\n')
+        f.write(f"#define {upper}_HEIGHT    {height}\n")
+        f.write(f"#define {upper}_MAX_WIDTH {max_width}\n")
+        f.write(f"#define {upper}_SPACING   {args.spacing}\n\n")
+
+        f.write(f"static const uint8_t {upper}_BITMAP[] = {{\n")
+        for i in range(0, len(bitmap), 12):
+            f.write("    " + ", ".join(f"0x{b:02X}" for b in bitmap[i:i + 12]) + ",\n")
+        f.write("};\n\n")
+
+        f.write(f"static const font_glyph_t {upper}_GLYPHS[] = {{\n")
+        for offset, width, ch in table:
+            f.write(f"    {{ {offset:5d}, {width} }},  // U+{ord(ch):04X}\n")
+        f.write("};\n\n")
+
+        f.write(f"static const uint8_t {upper}_INDEX[] = {{\n")
+        for i in range(0, len(index), 16):
+            f.write("    " + ", ".join(f"{v:3d}" for v in index[i:i + 16]) + ",\n")
+        f.write("};\n\n")
+
+        f.write(f"static const font_atlas_t {upper} = {{\n")
+        f.write(f"    .height = {height},\n")
+        f.write(f"    .bpp = {args.bpp},\n")
+        f.write(f"    .spacing = {args.spacing},\n")
+        f.write(f"    .max_width = {max_width},\n")
+        f.write(f"    .first = 0x{FIRST_CP:04X},\n")
+        f.write(f"    .count = {len(index)},\n")
+        f.write(f"    .index = {upper}_INDEX,\n")
+        f.write(f"    .glyphs = {upper}_GLYPHS,\n")
+        f.write(f"    .bitmap = {upper}_BITMAP,\n")
+        f.write("};\n\n")
+        f.write(f"#endif // {upper}_H\n")
+
+    print(f"Atlas gerado com sucesso: {dst}")
+    print(f"Glifos: {len(order)}, altura {height}, {args.bpp} bpp, bitmap {len(bitmap)} bytes")
+
+
+if __name__ == "__main__":
+    main()
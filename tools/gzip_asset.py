@@ -0,0 +1,36 @@
+"""Comprime um arquivo estatico com gzip para ser embarcado no firmware.
+
+Chamado pelo build (main/CMakeLists.txt). A saida e deterministica (sem
+nome de arquivo nem data no cabecalho gzip), entao o ETag calculado no
+dispositivo so muda quando o conteudo muda.
+
+Uso:
+    python tools/gzip_asset.py <entrada> <saida.gz>
+"""
+
+import gzip
+import sys
+from pathlib import Path
+
+
+def main() -> None:
+    if len(sys.argv) != 3:
+        raise SystemExit("Uso: gzip_asset.py <entrada> <saida.gz>")
+
+    src = Path(sys.argv[1])
+    dst = Path(sys.argv[2])
+
+    if not src.exists():
+        raise SystemExit(f"Arquivo de entrada nao encontrado: {src}")
+
+    data = src.read_bytes()
+    packed = gzip.compress(data, compresslevel=9, mtime=0)
+
+    dst.parent.mkdir(parents=True, exist_ok=True)
+    dst.write_bytes(packed)
+
+    print(f"{src.name}: {len(data)} -> {len(packed)} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,338 @@
+"""Backend PIX falso para testar o firmware sem cobrancas reais.
+
+Implementa a API esperada pelo firmware (POST /create_payment,
+GET /status/<id>, com long-poll via ?wait=<s>, POST /status para varios IDs
+e POST /cancel/<id>) e simula o tempo que o cliente leva para pagar, a latencia da rede e falhas
+do servidor.
+
+Uso:
+    python tools/mock_backend.py [--port 3000] [--approve-after 5] ...
+
+Com o padrao, aponte CONFIG_ESP_PIX_BACKEND_URL para
+http://<ip-do-pc>:3000/api. Para aprovar ou recusar manualmente, use
+--approve-after -1 e chame POST /api/approve/<id> ou /api/reject/<id>.
+"""
+
+import argparse
+import json
+import random
+import threading
+import time
+import uuid
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlsplit
+
+# Maior espera aceita em ?wait=, igual ao limite do menuconfig
+MAX_WAIT_S = 60
+
+# Letra de cada status na resposta de POST /status
+STATUS_CODES = {"APPROVED": "A", "PENDING": "P", "REJECTED": "R", "CANCELLED": "C"}
+
+
+class Payment:
+    def __init__(self, payment_id: str, amount_cents: int, approve_at: float | None, final: str):
+        self.payment_id = payment_id
+        self.amount_cents = amount_cents   # A resposta usa centavos, como o backend real
+        self.created_at = time.time()
+        self.approve_at = approve_at   # Quando o "cliente" paga; None = manual
+        self.final = final             # APPROVED ou REJECTED
+        self.decided_at: float | None = None
+
+
+class Backend:
+    """Estado compartilhado entre as requisicoes."""
+
+    def __init__(self, args: argparse.Namespace):
+        self.args = args
+        self.rng = random.Random(args.seed)
+        self.lock = threading.Condition()
+        self.payments: dict[str, Payment] = {}
+
+    def _rand(self) -> float:
+        with self.lock:
+            return self.rng.random()
+
+    def network_delay(self) -> None:
+        """Atraso de resposta: delay +- jitter (ms)."""
+        jitter = (self._rand() * 2 - 1) * self.args.jitter
+        delay = max(0.0, self.args.delay + jitter)
+        if delay > 0:
+            time.sleep(delay / 1000)
+
+    def failure(self) -> str | None:
+        """Sorteia uma falha injetada: 'drop', 'error' ou None."""
+        r = self._rand()
+        if r < self.args.drop_rate:
+            return "drop"
+        if r < self.args.drop_rate + self.args.fail_rate:
+            return "error"
+        return None
+
+    def create(self, amount_cents: int, payment_id: str | None = None) -> Payment:
+        with self.lock:
+            payment_id = payment_id or uuid.uuid4().hex[:12]
+            approve_at = None
+            if self.args.approve_after >= 0:
+                jitter = (self.rng.random() * 2 - 1) * self.args.approve_jitter
+                approve_at = time.time() + max(0.0, self.args.approve_after + jitter)
+            final = "REJECTED" if self.rng.random() < self.args.reject_rate else "APPROVED"
+            payment = Payment(payment_id, amount_cents, approve_at, final)
+            self.payments[payment_id] = payment
+            return payment
+
+    def _status(self, payment: Payment) -> str:
+        if payment.decided_at is None and payment.approve_at is not None \
+                and time.time() >= payment.approve_at:
+            payment.decided_at = payment.approve_at
+        return payment.final if payment.decided_at is not None else "PENDING"
+
+    def status(self, payment_id: str, wait_s: float) -> tuple[Payment, str] | None:
+        """Status atual; com wait_s > 0 segura ate decidir ou o prazo acabar."""
+        deadline = time.time() + wait_s
+        with self.lock:
+            payment = self.payments.get(payment_id)
+            if payment is None and self.args.accept_unknown:
+                # Codigo gerado no dispositivo: o txid chega primeiro aqui
+                payment = self.create(0, payment_id)
+            if payment is None:
+                return None
+            while True:
+                status = self._status(payment)
+                now = time.time()
+                if status != "PENDING" or now >= deadline:
+                    return payment, status
+                # Acorda no pagamento simulado ou num aprovar/recusar manual
+                until = deadline
+                if payment.approve_at is not None:
+                    until = min(until, payment.approve_at)
+                self.lock.wait(max(0.0, until - now))
+
+    def decide(self, payment_id: str, final: str) -> bool:
+        with self.lock:
+            payment = self.payments.get(payment_id)
+            if payment is None:
+                return False
+            if payment.decided_at is None:
+                payment.final = final
+                payment.decided_at = time.time()
+                self.lock.notify_all()
+            return True
+
+    def cancel(self, payment_id: str) -> str | None:
+        """Cancela se ainda pendente; senao mantem o status final."""
+        with self.lock:
+            payment = self.payments.get(payment_id)
+            if payment is None:
+                return None
+            if self._status(payment) == "PENDING":
+                payment.final = "CANCELLED"
+                payment.decided_at = time.time()
+                self.lock.notify_all()
+            return payment.final
+
+
+def brcode(payment: Payment) -> str:
+    """BR Code de mentira com o formato de um PIX dinamico."""
+    url = f"pix.example.com/qr/v2/{payment.payment_id}"
+    gui = "0014br.gov.bcb.pix" + f"25{len(url):02d}{url}"
+    # Dentro do BR Code o valor vai em reais
+    amount = f"{payment.amount_cents // 100}.{payment.amount_cents % 100:02d}"
+    return (
+        "000201010212"
+        f"26{len(gui):02d}{gui}"
+        "52040000530398654"
+        f"{len(amount):02d}{amount}"
+        "5802BR5914CAFE EXPRESSO6009SAO PAULO62070503***6304"
+        "0000"
+    )
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"   # Mantem a conexao, como o firmware espera
+    backend: Backend
+
+    def log_message(self, fmt: str, *args) -> None:
+        if not self.backend.args.quiet:
+            super().log_message(fmt, *args)
+
+    def _route(self) -> tuple[str, dict[str, list[str]]]:
+        parts = urlsplit(self.path)
+        path = parts.path
+        prefix = self.backend.args.prefix.rstrip("/")
+        if prefix and path.startswith(prefix + "/"):
+            path = path[len(prefix):]
+        return path, parse_qs(parts.query)
+
+    def _send_json(self, code: int, body: dict) -> None:
+        data = json.dumps(body).encode()
+        self.send_response(code)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(data)))
+        try:
+            self.end_headers()
+            self.wfile.write(data)
+        except (BrokenPipeError, ConnectionResetError):
+            # O cliente desistiu, p.ex. um long-poll abortado pelo firmware
+            self.close_connection = True
+
+    def _inject(self) -> bool:
+        """Aplica atraso e falhas; retorna True se a requisicao terminou."""
+        self.backend.network_delay()
+        failure = self.backend.failure()
+        if failure == "drop":
+            self.close_connection = True
+            self.connection.close()
+            return True
+        if failure == "error":
+            self._send_json(500, {"success": False, "error": "Injected failure"})
+            return True
+        return False
+
+    def _read_body(self) -> bytes:
+        length = int(self.headers.get("Content-Length") or 0)
+        return self.rfile.read(length) if length > 0 else b""
+
+    def do_POST(self) -> None:
+        path, _ = self._route()
+        body = self._read_body()
+
+        if path.startswith("/approve/") or path.startswith("/reject/"):
+            action, payment_id = path[1:].split("/", 1)
+            final = "APPROVED" if action == "approve" else "REJECTED"
+            if self.backend.decide(payment_id, final):
+                self._send_json(200, {"success": True, "status": final})
+            else:
+                self._send_json(404, {"success": False, "error": "Payment not found"})
+            return
+
+        if path == "/status" and not self.backend.args.no_batch:
+            if self._inject():
+                return
+            try:
+                ids = json.loads(body or b"{}")["ids"]
+                if not isinstance(ids, list) or not all(isinstance(i, str) for i in ids):
+                    raise TypeError
+            except (ValueError, TypeError, KeyError):
+                self._send_json(400, {"success": False, "error": "Invalid JSON"})
+                return
+            codes = ""
+            for payment_id in ids:
+                result = self.backend.status(payment_id, 0.0)
+                codes += STATUS_CODES[result[1]] if result is not None else "?"
+            self._send_json(200, {"statuses": codes})
+            return
+
+        if path.startswith("/cancel/"):
+            if self._inject():
+                return
+            payment_id = path[len("/cancel/"):]
+            status = self.backend.cancel(payment_id)
+            if status is None:
+                self._send_json(404, {"success": False, "error": "Payment not found"})
+            else:
+                self._send_json(200, {"paymentId": payment_id, "status": status})
+            return
+
+        if path != "/create_payment":
+            self._send_json(404, {"success": False, "error": "Not found"})
+            return
+        if self._inject():
+            return
+
+        try:
+            request = json.loads(body or b"{}")
+            # O pedido vem em reais
+            amount_cents = round(float(request.get("amount", 0)) * 100)
+        except (ValueError, TypeError, AttributeError):
+            self._send_json(400, {"success": False, "error": "Invalid JSON"})
+            return
+
+        payment = self.backend.create(amount_cents)
+        self._send_json(200, {
+            "success": True,
+            "paymentId": payment.payment_id,
+            "qrCode": brcode(payment),
+            "amount": payment.amount_cents,
+            "status": "PENDING",
+        })
+
+    def do_GET(self) -> None:
+        path, query = self._route()
+
+        if not path.startswith("/status/"):
+            self._send_json(404, {"success": False, "error": "Not found"})
+            return
+        if self._inject():
+            return
+
+        wait_s = 0.0
+        if "wait" in query and not self.backend.args.no_longpoll:
+            try:
+                wait_s = min(float(query["wait"][0]), MAX_WAIT_S)
+            except ValueError:
+                wait_s = 0.0
+
+        result = self.backend.status(path[len("/status/"):], wait_s)
+        if result is None:
+            self._send_json(404, {"success": False, "error": "Payment not found"})
+            return
+
+        payment, status = result
+        body = {"paymentId": payment.payment_id, "status": status}
+        if payment.decided_at is not None:
+            # Para o driver de latencia medir o atraso da deteccao
+            body["decidedAt"] = int(payment.decided_at * 1000)
+        self._send_json(200, body)
+
+
+def build_parser() -> argparse.ArgumentParser:
+    parser = argparse.ArgumentParser(description="Backend PIX falso para o ESP-PIX")
+    parser.add_argument("--host", default="0.0.0.0", help="Endereco de escuta (padrao: 0.0.0.0)")
+    parser.add_argument("--port", type=int, default=3000, help="Porta (padrao: 3000)")
+    parser.add_argument("--prefix", default="/api", help="Prefixo das rotas (padrao: /api)")
+    parser.add_argument("--delay", type=float, default=0, help="Atraso de cada resposta em ms")
+    parser.add_argument("--jitter", type=float, default=0, help="Variacao do atraso em ms (+-)")
+    parser.add_argument("--approve-after", type=float, default=5,
+                        help="Segundos ate o pagamento ser decidido; -1 = manual (padrao: 5)")
+    parser.add_argument("--approve-jitter", type=float, default=0,
+                        help="Variacao do tempo de pagamento em s (+-)")
+    parser.add_argument("--reject-rate", type=float, default=0,
+                        help="Fracao dos pagamentos recusados (0-1)")
+    parser.add_argument("--fail-rate", type=float, default=0,
+                        help="Fracao das requisicoes respondidas com HTTP 500 (0-1)")
+    parser.add_argument("--drop-rate", type=float, default=0,
+                        help="Fracao das requisicoes com a conexao fechada sem resposta (0-1)")
+    parser.add_argument("--accept-unknown", action="store_true",
+                        help="Trata IDs desconhecidos em /status como cobrancas geradas no "
+                             "dispositivo (CONFIG_ESP_PIX_CHARGE_SOURCE_LOCAL)")
+    parser.add_argument("--no-longpoll", action="store_true",
+                        help="Ignora ?wait= e responde na hora")
+    parser.add_argument("--no-batch", action="store_true",
+                        help="Responde 404 em POST /status, como um backend sem consulta em lote")
+    parser.add_argument("--seed", type=int, default=None, help="Semente do sorteio")
+    parser.add_argument("--quiet", action="store_true", help="Nao registra cada requisicao")
+    return parser
+
+
+def make_server(args: argparse.Namespace) -> ThreadingHTTPServer:
+    handler = type("BoundHandler", (Handler,), {"backend": Backend(args)})
+    server = ThreadingHTTPServer((args.host, args.port), handler)
+    server.daemon_threads = True
+    return server
+
+
+def main() -> None:
+    args = build_parser().parse_args()
+    server = make_server(args)
+    host, port = server.server_address[:2]
+    print(f"Backend falso em http://{host}:{port}{args.prefix}")
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        server.server_close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,227 @@
+"""Mede a latencia de ponta a ponta de vendas contra um backend PIX.
+
+Roda o fluxo de venda do proprio firmware no PC: host/sale_sim.c compila
+app_state.c, charge_pool.c, net_worker.c, payment_watch.c e reconciler.c
+como no dispositivo, sobre FreeRTOS em threads POSIX e um cliente HTTP em
+sockets no lugar de http_client.c. Cada maquina e um processo
+espix_sale_sim; o simulador faz o papel do cliente, pagando, recusando ou
+cancelando cada QR code algum tempo depois de mostra-lo.
+
+Uso:
+    cmake -S host -B host/build && cmake --build host/build
+    python tools/sale_latency.py --mock "--delay 50 --jitter 20" --sales 50
+    python tools/sale_latency.py --url http://localhost:3000/api --machines 4
+
+Com --mock o backend falso (tools/mock_backend.py) roda no mesmo processo,
+com as opcoes passadas entre aspas e sempre com --approve-after -1, ja que
+quem paga e o simulador. Um backend dado com --url precisa aceitar
+POST /approve/<id> e /reject/<id> da mesma forma.
+
+As opcoes de consulta (CONFIG_ESP_PIX_PAYMENT_LONGPOLL_S, _POLL_MIN_MS,
+_POLL_MAX_MS, _TIMEOUT_MS) e do pool de cobrancas sao as de
+host/include/sdkconfig.h; para comparar outros valores, compile o host com
+-DCMAKE_C_FLAGS="-DCONFIG_ESP_PIX_PAYMENT_LONGPOLL_S=0", por exemplo.
+"""
+
+import argparse
+import json
+import shlex
+import statistics
+import subprocess
+import sys
+import threading
+from pathlib import Path
+
+BASE_DIR = Path(__file__).resolve().parent
+DEFAULT_SIM = BASE_DIR.parent / "host" / "build" / "espix_sale_sim"
+
+
+def expected_result(number: int, args: argparse.Namespace) -> str:
+    """Resultado de cada venda, pela mesma regra de pick_customer() em sale_sim.c."""
+    if args.cancel_every > 0 and number % args.cancel_every == 0:
+        return "cancelled"
+    if args.reject_every > 0 and number % args.reject_every == 0:
+        return "rejected"
+    return "approved"
+
+
+def run_machine(args: argparse.Namespace) -> tuple[list[dict], dict, int]:
+    """Roda um espix_sale_sim e le as suas linhas JSON."""
+    cmd = [str(args.sim), "-n", str(args.sales), "-p", str(args.pay_after_ms),
+           "-g", str(args.gap_ms), "-r", str(args.reject_every),
+           "-c", str(args.cancel_every), args.url]
+    proc = subprocess.run(cmd, stdout=subprocess.PIPE, text=True,
+                          stderr=None if args.verbose else subprocess.DEVNULL)
+    sales: list[dict] = []
+    counters: dict = {}
+    for line in proc.stdout.splitlines():
+        record = json.loads(line)
+        if "sale" in record:
+            # O simulador mede em microssegundos
+            for key in ("create", "detect", "total"):
+                if f"{key}_us" in record:
+                    record[f"{key}_ms"] = record.pop(f"{key}_us") / 1000
+            sales.append(record)
+        else:
+            counters = record
+    return sales, counters, proc.returncode
+
+
+def percentile(values: list[float], pct: float) -> float:
+    """Percentil por posicao (nearest-rank), como telemetry.c."""
+    ordered = sorted(values)
+    rank = max(1, -(-len(ordered) * pct // 100))
+    return ordered[int(rank) - 1]
+
+
+def summarize(results: list[dict], counters: list[dict]) -> dict:
+    summary = {
+        "sales": len(results),
+        "approved": sum(1 for r in results if r["result"] == "approved"),
+        "rejected": sum(1 for r in results if r["result"] == "rejected"),
+        "cancelled": sum(1 for r in results if r["result"] == "cancelled"),
+        "expired": sum(1 for r in results if r["result"] == "expired"),
+        "failed": sum(1 for r in results if r["result"] == "error"),
+        "pooled": sum(1 for r in results if r.get("pooled")),
+    }
+    # Contadores do fim de cada simulador, somados
+    for c in counters:
+        for key, value in c.items():
+            summary[key] = summary.get(key, 0) + value
+    for key in ("create_ms", "detect_ms", "total_ms", "requests"):
+        values = [r[key] for r in results if key in r]
+        if not values:
+            continue
+        summary[key] = {
+            "n": len(values),
+            "mean": round(statistics.fmean(values), 1),
+            "p50": round(percentile(values, 50), 1),
+            "p90": round(percentile(values, 90), 1),
+            "p99": round(percentile(values, 99), 1),
+            "max": round(max(values), 1),
+        }
+    return summary
+
+
+def print_summary(summary: dict) -> None:
+    print(f"Vendas: {summary['sales']}  aprovadas: {summary['approved']}  "
+          f"recusadas: {summary['rejected']}  canceladas: {summary['cancelled']}  "
+          f"expiradas: {summary['expired']}  falhas: {summary['failed']}  "
+          f"do pool: {summary['pooled']}")
+    print(f"Erros de status: {summary.get('status_errors', 0)}  "
+          f"pagas apos abandono: {summary.get('late_payments', 0)}  "
+          f"abandonadas sem acerto: {summary.get('unsettled', 0)}")
+    print(f"{'':<14} {'n':>5} {'media':>9} {'p50':>9} {'p90':>9} {'p99':>9} {'max':>9}")
+    labels = {
+        "create_ms": "criar (ms)",
+        "detect_ms": "detectar (ms)",
+        "total_ms": "total (ms)",
+        "requests": "consultas",
+    }
+    for key, label in labels.items():
+        s = summary.get(key)
+        if s is None:
+            continue
+        print(f"{label:<14} {s['n']:>5} {s['mean']:>9.1f} {s['p50']:>9.1f} {s['p90']:>9.1f} "
+              f"{s['p99']:>9.1f} {s['max']:>9.1f}")
+
+
+def start_mock(options: str) -> tuple[str, object]:
+    sys.path.insert(0, str(BASE_DIR))
+    import mock_backend
+
+    # Depois das opcoes do usuario, para prevalecer
+    mock_args = mock_backend.build_parser().parse_args(
+        ["--host", "127.0.0.1", "--port", "0", "--quiet"] + shlex.split(options) +
+        ["--approve-after", "-1"])
+    server = mock_backend.make_server(mock_args)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    host, port = server.server_address[:2]
+    return f"http://{host}:{port}{mock_args.prefix}", server
+
+
+def check(results: list[dict], counters: list[dict], codes: list[int],
+          args: argparse.Namespace) -> list[str]:
+    """Problemas encontrados na execucao, para --check."""
+    problems = [f"simulador saiu com {code}" for code in codes if code != 0]
+    if len(results) != args.sales * args.machines:
+        problems.append(f"{len(results)} vendas de {args.sales * args.machines}")
+    for r in results:
+        want = expected_result(r["sale"], args)
+        if r["result"] != want:
+            problems.append(f"venda {r['sale']}: {r['result']}, esperado {want}")
+    for c in counters:
+        for key in ("unsettled", "late_payments"):
+            if c.get(key, 0) != 0:
+                problems.append(f"{key} = {c[key]}")
+    return problems
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Latencia de vendas PIX de ponta a ponta")
+    parser.add_argument("--url", default="http://localhost:3000/api",
+                        help="URL do backend, como CONFIG_ESP_PIX_BACKEND_URL")
+    parser.add_argument("--mock", metavar="OPCOES", default=None,
+                        help="Roda tools/mock_backend.py neste processo com estas opcoes")
+    parser.add_argument("--sim", type=Path, default=DEFAULT_SIM,
+                        help=f"Executavel espix_sale_sim (padrao: {DEFAULT_SIM})")
+    parser.add_argument("--sales", type=int, default=20, help="Vendas por maquina (padrao: 20)")
+    parser.add_argument("--machines", type=int, default=1, help="Maquinas em paralelo (padrao: 1)")
+    parser.add_argument("--pay-after-ms", type=int, default=1000,
+                        help="Tempo do cliente entre ver o QR code e pagar (padrao: 1000)")
+    parser.add_argument("--reject-every", type=int, default=0,
+                        help="Recusa toda N-esima venda")
+    parser.add_argument("--cancel-every", type=int, default=0,
+                        help="Cancela toda N-esima venda com o botao")
+    parser.add_argument("--gap-ms", type=int, default=1000,
+                        help="Intervalo entre as vendas de uma maquina (padrao: 1000)")
+    parser.add_argument("--json", action="store_true", help="Imprime o resumo em JSON")
+    parser.add_argument("--check", action="store_true",
+                        help="Falha se alguma venda ou cobranca abandonada terminar errado")
+    parser.add_argument("--verbose", action="store_true", help="Mostra o log dos simuladores")
+    args = parser.parse_args()
+
+    if not args.sim.exists():
+        sys.exit(f"{args.sim} nao encontrado; compile com cmake -S host -B host/build")
+
+    server = None
+    if args.mock is not None:
+        args.url, server = start_mock(args.mock)
+
+    results: list[dict] = []
+    counters: list[dict] = []
+    codes: list[int] = []
+    lock = threading.Lock()
+
+    def machine() -> None:
+        sales, machine_counters, code = run_machine(args)
+        with lock:
+            results.extend(sales)
+            counters.append(machine_counters)
+            codes.append(code)
+
+    threads = [threading.Thread(target=machine) for _ in range(args.machines)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    if server is not None:
+        server.shutdown()
+
+    summary = summarize(results, counters)
+    if args.json:
+        print(json.dumps(summary, indent=2))
+    else:
+        print_summary(summary)
+
+    if args.check:
+        problems = check(results, counters, codes, args)
+        for p in problems:
+            print(f"FALHA: {p}")
+        if problems:
+            sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()